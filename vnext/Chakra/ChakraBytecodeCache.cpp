@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "ChakraBytecodeCache.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace facebook {
+namespace react {
+
+//=============================================================================
+// BytecodePrefix implementation
+//=============================================================================
+
+BytecodePrefix::BytecodePrefix(uint64_t bundleVersion, const BytecodeEngineVersion &engineVersion) noexcept
+    : m_bytecodeFileFormatVersion{s_bytecodeFileFormatVersion},
+      m_bundleVersion{bundleVersion},
+      m_engineVersion{engineVersion} {}
+
+bool BytecodePrefix::operator==(const BytecodePrefix &rhs) const noexcept {
+  return std::memcmp(this, &rhs, sizeof(BytecodePrefix)) == 0;
+}
+
+bool BytecodePrefix::operator!=(const BytecodePrefix &rhs) const noexcept {
+  return !(*this == rhs);
+}
+
+//=============================================================================
+// Bytecode file validation and writing
+//=============================================================================
+
+BytecodeCheckResult checkBytecode(const void *fileData, size_t fileSize, const BytecodePrefix &expected) noexcept {
+  if (!fileData) {
+    return BytecodeCheckResult::Missing;
+  }
+
+  // A file that holds only the prefix has no bytecode to run.
+  if (fileSize <= sizeof(BytecodePrefix)) {
+    return BytecodeCheckResult::Truncated;
+  }
+
+  // The file data does not have to be aligned, so we compare bytes instead of
+  // casting it to BytecodePrefix.
+  if (std::memcmp(fileData, &expected, sizeof(BytecodePrefix)) != 0) {
+    return BytecodeCheckResult::Stale;
+  }
+
+  return BytecodeCheckResult::Valid;
+}
+
+namespace {
+
+std::filesystem::path makeTempBytecodePath(const std::filesystem::path &bytecodePath) {
+  // Several writers, possibly in different processes, may generate the same
+  // file concurrently. Each of them must use its own temporary file.
+  static std::atomic<uint32_t> s_tempFileCounter{0};
+  auto uniqueId = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" +
+      std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "-" +
+      std::to_string(++s_tempFileCounter);
+
+  auto tempPath = bytecodePath;
+  tempPath += "." + uniqueId + ".tmp";
+  return tempPath;
+}
+
+} // namespace
+
+bool writeBytecodeFile(
+    const std::string &bytecodeFileName,
+    const BytecodePrefix &prefix,
+    const uint8_t *bytecode,
+    size_t bytecodeSize) noexcept {
+  try {
+    const auto bytecodePath = std::filesystem::u8path(bytecodeFileName);
+    const auto tempPath = makeTempBytecodePath(bytecodePath);
+
+    {
+      std::ofstream tempFile(tempPath, std::ios::binary | std::ios::trunc);
+      tempFile.write(reinterpret_cast<const char *>(&prefix), sizeof(prefix));
+      tempFile.write(reinterpret_cast<const char *>(bytecode), bytecodeSize);
+      tempFile.close();
+      if (!tempFile) {
+        std::error_code ec;
+        std::filesystem::remove(tempPath, ec);
+        return false;
+      }
+    }
+
+    // Renaming fails if the current file is still mapped by a reader. The
+    // existing file is kept in that case and we try again on the next launch.
+    std::error_code ec;
+    std::filesystem::rename(tempPath, bytecodePath, ec);
+    if (ec) {
+      std::filesystem::remove(tempPath, ec);
+      return false;
+    }
+
+    return true;
+  } catch (...) {
+    return false;
+  }
+}
+
+//=============================================================================
+// BytecodeSerializationWorker implementation
+//=============================================================================
+
+BytecodeSerializationWorker::BytecodeSerializationWorker() noexcept = default;
+
+BytecodeSerializationWorker::~BytecodeSerializationWorker() noexcept {
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_isShuttingDown = true;
+    m_jobs.clear();
+  }
+
+  m_jobsChanged.notify_all();
+
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void BytecodeSerializationWorker::post(std::function<void()> &&job) noexcept {
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_isShuttingDown) {
+      return;
+    }
+
+    m_jobs.push_back(std::move(job));
+    if (!m_thread.joinable()) {
+      m_thread = std::thread([this]() noexcept { run(); });
+    }
+  }
+
+  m_jobsChanged.notify_all();
+}
+
+void BytecodeSerializationWorker::waitForIdle() noexcept {
+  std::unique_lock<std::mutex> lock{m_mutex};
+  m_jobsChanged.wait(lock, [this]() noexcept { return m_jobs.empty() && !m_isRunningJob; });
+}
+
+void BytecodeSerializationWorker::run() noexcept {
+  std::unique_lock<std::mutex> lock{m_mutex};
+  for (;;) {
+    m_jobsChanged.wait(lock, [this]() noexcept { return m_isShuttingDown || !m_jobs.empty(); });
+    if (m_isShuttingDown) {
+      break;
+    }
+
+    auto job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    m_isRunningJob = true;
+
+    lock.unlock();
+    job();
+    job = nullptr;
+    lock.lock();
+
+    m_isRunningJob = false;
+    m_jobsChanged.notify_all();
+  }
+
+  m_isRunningJob = false;
+  m_jobsChanged.notify_all();
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+// This file holds the engine-independent part of the bytecode cache: the
+// on-disk prefix format, its validation and the crash-safe file writer. It must
+// not depend on Windows or ChakraCore headers so that it can be tested on any
+// platform.
+
+namespace facebook {
+namespace react {
+
+// Version of the script engine that produced a bytecode file. Bytecode is only
+// valid for the exact engine build that generated it.
+struct BytecodeEngineVersion {
+  uint32_t fileVersionMS;
+  uint32_t fileVersionLS;
+  uint32_t productVersionMS;
+  uint32_t productVersionLS;
+};
+
+// Header written in front of the serialized bytecode. The layout is part of
+// the file format: any change must bump s_bytecodeFileFormatVersion.
+class BytecodePrefix {
+ public:
+  static constexpr uint64_t s_bytecodeFileFormatVersion = 2;
+
+  BytecodePrefix(uint64_t bundleVersion, const BytecodeEngineVersion &engineVersion) noexcept;
+
+  bool operator==(const BytecodePrefix &rhs) const noexcept;
+  bool operator!=(const BytecodePrefix &rhs) const noexcept;
+
+ private:
+  uint64_t m_bytecodeFileFormatVersion;
+  uint64_t m_bundleVersion;
+  BytecodeEngineVersion m_engineVersion;
+};
+
+static_assert(std::is_trivially_copyable<BytecodePrefix>::value, "BytecodePrefix is written to disk as is");
+static_assert(sizeof(BytecodePrefix) == 32, "BytecodePrefix must not contain padding");
+
+enum class BytecodeCheckResult {
+  Valid,
+  Missing, // There is no file or it could not be read.
+  Truncated, // The file is too short to contain a prefix and bytecode.
+  Stale, // The prefix does not match the current bundle or engine.
+};
+
+// Checks the contents of a bytecode file against the prefix expected for the
+// current bundle and engine.
+BytecodeCheckResult checkBytecode(const void *fileData, size_t fileSize, const BytecodePrefix &expected) noexcept;
+
+// Writes the prefix followed by the bytecode to a temporary file next to
+// bytecodeFileName and atomically renames it over bytecodeFileName. Readers
+// either see the previous file or the complete new one, never a torn write.
+// Returns false if the file could not be written or replaced.
+bool writeBytecodeFile(
+    const std::string &bytecodeFileName,
+    const BytecodePrefix &prefix,
+    const uint8_t *bytecode,
+    size_t bytecodeSize) noexcept;
+
+// Runs bytecode serialization jobs in order on a background thread that is
+// started on first use. Destroying the worker waits for the running job and
+// discards the jobs that have not started yet.
+class BytecodeSerializationWorker {
+ public:
+  BytecodeSerializationWorker() noexcept;
+  ~BytecodeSerializationWorker() noexcept;
+
+  BytecodeSerializationWorker(const BytecodeSerializationWorker &) = delete;
+  BytecodeSerializationWorker &operator=(const BytecodeSerializationWorker &) = delete;
+
+  void post(std::function<void()> &&job) noexcept;
+
+  // Blocks until all posted jobs are completed.
+  void waitForIdle() noexcept;
+
+ private:
+  void run() noexcept;
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_jobsChanged;
+  std::deque<std::function<void()>> m_jobs;
+  bool m_isRunningJob{false};
+  bool m_isShuttingDown{false};
+  std::thread m_thread;
+};
+
+} // namespace react
+} // namespace facebook
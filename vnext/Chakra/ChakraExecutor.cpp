@@ -511,7 +511,11 @@ void ChakraExecutor::loadBundle(std::unique_ptr<const JSBigString> script, std::
     evaluateScript(std::move(script), jsSourceURL);
   } else {
     evaluateScriptWithBytecode(
-        std::move(script), bundleMetadata->version, jsSourceURL, std::string(bundleMetadata->bytecodeFilename));
+        std::move(script),
+        bundleMetadata->version,
+        jsSourceURL,
+        std::string(bundleMetadata->bytecodeFilename),
+        &m_bytecodeWorker);
   }
 
 #if !defined(USE_EDGEMODE_JSRT)
@@ -12,6 +12,7 @@
 
 #include <cxxreact\JSExecutor.h>
 
+#include "ChakraBytecodeCache.h"
 #include "ChakraHelpers.h"
 #include "ChakraInstanceArgs.h"
 #include "ChakraNativeModules.h"
@@ -103,6 +104,11 @@ class ChakraExecutor final : public JSExecutor {
   bool m_bridgeEstablished = false;
   ChakraInstanceArgs m_instanceArgs;
 
+  // Serialization jobs only use the data they captured. Destroying the worker
+  // waits for the running job and drops the pending ones, so no job outlives
+  // the executor.
+  BytecodeSerializationWorker m_bytecodeWorker;
+
   folly::Optional<ChakraObject> m_invokeCallbackAndReturnFlushedQueueJS;
   folly::Optional<ChakraObject> m_callFunctionReturnFlushedQueueJS;
   folly::Optional<ChakraObject> m_flushedQueueJS;
@@ -4,9 +4,9 @@
 #include "pch.h"
 
 #include "ChakraHelpers.h"
+#include "ChakraBytecodeCache.h"
 #include "ChakraUtils.h"
 #include "ChakraValue.h"
-#include "Unicode.h"
 
 #ifdef WITH_FBSYSTRACE
 #include <fbsystrace.h>
@@ -22,7 +22,6 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
-#include <future>
 #include <memory>
 #include <string>
 #include <thread>
@@ -34,17 +33,6 @@ namespace react {
 #if !defined(USE_EDGEMODE_JSRT)
 namespace {
 
-template <class T>
-size_t fwrite(T *p, size_t count, FILE *file) noexcept {
-  static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable to be serialized into a file");
-  return fwrite(p, sizeof(*p), count, file);
-}
-
-template <class T>
-bool fwrite(const T &val, FILE *file) noexcept {
-  return fwrite(&val, 1, file) == 1;
-}
-
 #if !defined(CHAKRACORE_UWP)
 struct FileVersionInfoResource {
   uint16_t len;
@@ -100,13 +88,8 @@ class ChakraVersionInfo {
     return true;
   }
 
-  bool operator==(const ChakraVersionInfo &rhs) const noexcept {
-    return (m_fileVersionMS == rhs.m_fileVersionMS) && (m_fileVersionLS == rhs.m_fileVersionLS) &&
-        (m_productVersionMS == rhs.m_productVersionMS) && (m_productVersionLS == rhs.m_productVersionLS);
-  }
-
-  bool operator!=(const ChakraVersionInfo &rhs) const noexcept {
-    return !(*this == rhs);
+  BytecodeEngineVersion engineVersion() const noexcept {
+    return BytecodeEngineVersion{m_fileVersionMS, m_fileVersionLS, m_productVersionMS, m_productVersionLS};
   }
 
  private:
@@ -116,81 +99,40 @@ class ChakraVersionInfo {
   uint32_t m_productVersionLS;
 };
 
-class BytecodePrefix {
- public:
-  static std::pair<bool, BytecodePrefix> getBytecodePrefix(uint64_t bundleVersion) noexcept {
-    std::pair<bool, BytecodePrefix> result{false, BytecodePrefix{bundleVersion}};
-    result.first = result.second.m_chakraVersionInfo.initialize();
-    return result;
-  }
-
-  bool operator==(const BytecodePrefix &rhs) const noexcept {
-    return (m_bytecodeFileFormatVersion == rhs.m_bytecodeFileFormatVersion) &&
-        (m_bundleVersion == rhs.m_bundleVersion) && (m_chakraVersionInfo == rhs.m_chakraVersionInfo);
-  }
-
-  bool operator!=(const BytecodePrefix &rhs) const noexcept {
-    return !(*this == rhs);
-  }
-
- private:
-  uint64_t m_bytecodeFileFormatVersion;
-  uint64_t m_bundleVersion;
-  ChakraVersionInfo m_chakraVersionInfo;
-
-  static constexpr uint32_t s_bytecodeFileFormatVersion = 2;
-
-  BytecodePrefix(uint64_t bundleVersion) noexcept
-      : m_bytecodeFileFormatVersion{s_bytecodeFileFormatVersion},
-        m_bundleVersion{bundleVersion},
-        m_chakraVersionInfo{} {}
-};
+std::pair<bool, BytecodePrefix> getBytecodePrefix(uint64_t bundleVersion) noexcept {
+  ChakraVersionInfo chakraVersionInfo;
+  bool succeeded = chakraVersionInfo.initialize();
+  return {succeeded, BytecodePrefix{bundleVersion, chakraVersionInfo.engineVersion()}};
+}
 
 void serializeBytecodeToFileCore(
     const std::shared_ptr<const JSBigString> &script,
     const BytecodePrefix &bytecodePrefix,
     const std::string &bytecodeFileName) {
-  FILE *bytecodeFilePtr;
-  // bytecode is a binary representation, so we need to pass in the "b" flag to
-  // fopen_s
-  if (_wfopen_s(&bytecodeFilePtr, Microsoft::Common::Unicode::Utf8ToUtf16(bytecodeFileName).c_str(), L"wb")) {
-    return;
-  }
-  std::unique_ptr<FILE, decltype(&fclose)> bytecodeFilePtrWrapper(bytecodeFilePtr, fclose);
-
-  const std::wstring scriptUTF16 = Microsoft::Common::Unicode::Utf8ToUtf16(script->c_str(), script->size());
-
-  unsigned int bytecodeSize = 0;
-  if (JsSerializeScript(scriptUTF16.c_str(), nullptr, &bytecodeSize) != JsNoError) {
-    return;
-  }
+  // The script is passed to the engine as an UTF-8 array buffer that wraps the
+  // bundle memory, so we do not make an UTF-16 copy of the whole bundle.
+  JsValueRefUniquePtr jsScript = jsArrayBufferFromBigString(script);
 
-  std::unique_ptr<uint8_t[]> bytecode(std::make_unique<uint8_t[]>(bytecodeSize));
-  if (JsSerializeScript(scriptUTF16.c_str(), bytecode.get(), &bytecodeSize) != JsNoError) {
+  JsValueRef bytecodeBuffer = JS_INVALID_REFERENCE;
+  if (JsSerialize(jsScript.get(), &bytecodeBuffer, JsParseScriptAttributeNone) != JsNoError) {
     return;
   }
 
-  constexpr size_t bytecodePrefixSize = sizeof(bytecodePrefix);
-  uint8_t zeroArray[sizeof(bytecodePrefix)]{};
-
-  if (fwrite(zeroArray, bytecodePrefixSize, bytecodeFilePtrWrapper.get()) != bytecodePrefixSize ||
-      fwrite(bytecode.get(), bytecodeSize, bytecodeFilePtrWrapper.get()) != bytecodeSize ||
-      fflush(bytecodeFilePtrWrapper.get())) {
+  BYTE *bytecode = nullptr;
+  unsigned int bytecodeSize = 0;
+  if (JsGetArrayBufferStorage(bytecodeBuffer, &bytecode, &bytecodeSize) != JsNoError) {
     return;
   }
 
-  fseek(bytecodeFilePtrWrapper.get(), 0, SEEK_SET);
-  if (!fwrite(bytecodePrefix, bytecodeFilePtrWrapper.get()) || fflush(bytecodeFilePtrWrapper.get())) {
-    return;
-  }
+  writeBytecodeFile(bytecodeFileName, bytecodePrefix, bytecode, bytecodeSize);
 }
 
 std::unique_ptr<JSBigString> tryGetBytecode(const BytecodePrefix &bytecodePrefix, const std::string &bytecodeFileName) {
   auto bytecodeBigStringPtr =
       std::make_unique<FileMappingBigString>(bytecodeFileName, static_cast<uint32_t>(sizeof(BytecodePrefix)));
 
-  if (!bytecodeBigStringPtr->file_data() || bytecodeBigStringPtr->file_size() < sizeof(bytecodePrefix) ||
-      *reinterpret_cast<const BytecodePrefix *>(bytecodeBigStringPtr->file_data()) != bytecodePrefix) {
+  if (checkBytecode(bytecodeBigStringPtr->file_data(), bytecodeBigStringPtr->file_size(), bytecodePrefix) !=
+      BytecodeCheckResult::Valid) {
     return nullptr;
   }
 
@@ -201,21 +143,20 @@ void serializeBytecodeToFile(
     const std::shared_ptr<const JSBigString> &script,
     const BytecodePrefix &bytecodePrefix,
     std::string &&bytecodeFileName,
-    bool async) {
-  std::future<void> bytecodeSerializationFuture = std::async(
-      std::launch::async,
-      [](const std::shared_ptr<const JSBigString> &script,
-         const BytecodePrefix &bytecodePrefix,
-         const std::string &bytecodeFileName) {
-        MinimalChakraRuntime chakraRuntime(false /* multithreaded */);
-        serializeBytecodeToFileCore(script, bytecodePrefix, bytecodeFileName);
-      },
-      script,
-      bytecodePrefix,
-      std::move(bytecodeFileName));
-
-  if (!async) {
-    bytecodeSerializationFuture.wait();
+    BytecodeSerializationWorker *worker) {
+  auto serialize = [script, bytecodePrefix, bytecodeFileName = std::move(bytecodeFileName)]() noexcept {
+    // Serialization needs its own runtime because the worker thread must not
+    // touch the runtime that executes the bundle.
+    MinimalChakraRuntime chakraRuntime(false /* multithreaded */);
+    serializeBytecodeToFileCore(script, bytecodePrefix, bytecodeFileName);
+  };
+
+  if (worker) {
+    worker->post(std::move(serialize));
+  } else {
+    // Without a worker the caller asked for the bytecode to be generated
+    // before we return. We still need a separate thread for the runtime.
+    std::thread(std::move(serialize)).join();
   }
 }
 
@@ -402,7 +343,7 @@ JsValueRef evaluateScriptWithBytecode(
     [[maybe_unused]] uint64_t scriptVersion,
     JsValueRef scriptFileName,
     [[maybe_unused]] std::string &&bytecodeFileName,
-    [[maybe_unused]] bool asyncBytecodeGeneration) {
+    [[maybe_unused]] BytecodeSerializationWorker *bytecodeWorker) {
 #if defined(WINRT)
   // TODO: yicyao
   // ChakraRT does not support the JsRunSerialized() API.
@@ -410,7 +351,7 @@ JsValueRef evaluateScriptWithBytecode(
   // code right now.
   return evaluateScript(std::move(script), scriptFileName);
 #else
-  auto bytecodePrefixOptional = BytecodePrefix::getBytecodePrefix(scriptVersion);
+  auto bytecodePrefixOptional = getBytecodePrefix(scriptVersion);
   if (!bytecodePrefixOptional.first) {
     return evaluateScript(std::move(script), scriptFileName);
   }
@@ -419,7 +360,7 @@ JsValueRef evaluateScriptWithBytecode(
   std::unique_ptr<const JSBigString> bytecode = tryGetBytecode(bytecodePrefix, bytecodeFileName);
   if (!bytecode) {
     std::shared_ptr<const JSBigString> sharedScript(script.release());
-    serializeBytecodeToFile(sharedScript, bytecodePrefix, std::move(bytecodeFileName), asyncBytecodeGeneration);
+    serializeBytecodeToFile(sharedScript, bytecodePrefix, std::move(bytecodeFileName), bytecodeWorker);
     ReactMarker::logMarker(ReactMarker::JS_BUNDLE_STRING_CONVERT_START);
     JsValueRefUniquePtr jsScript = jsArrayBufferFromBigString(sharedScript);
     ReactMarker::logMarker(ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP);
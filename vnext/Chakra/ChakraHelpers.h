@@ -13,6 +13,8 @@
 namespace facebook {
 namespace react {
 
+class BytecodeSerializationWorker;
+
 class MinimalChakraRuntime {
  public:
   MinimalChakraRuntime(bool multithreaded);
@@ -95,12 +97,15 @@ JsValueRef evaluateScript(JsValueRef script, JsValueRef sourceURL);
 
 JsValueRef evaluateScript(std::unique_ptr<const JSBigString> &&script, JsValueRef sourceURL);
 
+// When the bytecode file is missing or stale, the script is run from source
+// and the bytecode is generated on bytecodeWorker. If bytecodeWorker is
+// nullptr, the bytecode file is written before this function returns.
 JsValueRef evaluateScriptWithBytecode(
     std::unique_ptr<const JSBigString> &&script,
     uint64_t scriptVersion,
     JsValueRef scriptFileName,
     std::string &&bytecodeFileName,
-    bool asyncBytecodeGeneration = true);
+    BytecodeSerializationWorker *bytecodeWorker = nullptr);
 
 #if WITH_FBJSCEXTENSIONS
 JsValueRef evaluateSourceCode(JSSourceCodeRef source, JsValueRef sourceURL);
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 
 #include "pch.h"
+#include <winrt/Microsoft.Internal.h>
+#include <winrt/Microsoft.ReactNative.h>
 #include <winrt/facebook.react.h>
 
 #include <Shared/Logging.h>
@@ -56,6 +58,49 @@ TEST_CLASS (PerfTests) {
     PrintResult("TimeOldAbiInitializeLogging", iterations, accu.QuadPart);
   }
 
+  TEST_METHOD(TimeModuleMethodCalls) {
+    constexpr uint32_t methodIterations = 1000000;
+
+    auto context = Microsoft::Internal::TestController::CreateContext(
+        Microsoft::ReactNative::ReactPropertyBagHelper::CreatePropertyBag(),
+        Microsoft::ReactNative::ReactNotificationServiceHelper::CreateNotificationService());
+
+    for (uint32_t argumentCount : {0u, 3u, 10u}) {
+      auto builder = Microsoft::Internal::TestController::CreateReactModuleBuilder(context);
+      builder.AddMethod(
+          L"Sum",
+          Microsoft::ReactNative::MethodReturnType::Callback,
+          [](Microsoft::ReactNative::IJSValueReader const &inputReader,
+             Microsoft::ReactNative::IJSValueWriter const &outputWriter,
+             Microsoft::ReactNative::MethodResultCallback const &resolve,
+             Microsoft::ReactNative::MethodResultCallback const & /*reject*/) {
+            int64_t sum = 0;
+            while (inputReader.GetNextArrayItem()) {
+              sum += inputReader.GetInt64();
+            }
+
+            outputWriter.WriteArrayBegin();
+            outputWriter.WriteInt64(sum);
+            outputWriter.WriteArrayEnd();
+            resolve(outputWriter);
+          });
+
+      LARGE_INTEGER a{0}, b{0}, freq{0};
+      QueryPerformanceFrequency(&freq);
+      QueryPerformanceCounter(&a);
+      Microsoft::Internal::TestController::InvokeMethod(builder, L"Sum", argumentCount, methodIterations);
+      QueryPerformanceCounter(&b);
+
+      std::string testName = "TimeModuleMethodCalls_" + std::to_string(argumentCount) + "Args";
+      PrintResult(testName.c_str(), methodIterations, b.QuadPart - a.QuadPart);
+
+      std::stringstream ss;
+      double time = static_cast<double>(b.QuadPart - a.QuadPart) / freq.QuadPart;
+      ss << testName << ": calls/s=" << methodIterations / time;
+      Logger::WriteMessage(ss.str().c_str());
+    }
+  }
+
   static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
     LARGE_INTEGER freq{0};
     Assert::IsTrue(QueryPerformanceFrequency(&freq));
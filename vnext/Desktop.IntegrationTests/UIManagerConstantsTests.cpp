@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <IUIManager.h>
+#include <TestInstance.h>
+
+// Standard library includes
+#include <atomic>
+#include <chrono>
+#include <sstream>
+
+using namespace facebook::react;
+using namespace Microsoft::React::Test;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using folly::dynamic;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace {
+
+// View manager with constants of about the size of the core view managers.
+class ConstantsViewManager : public TestViewManager {
+  std::atomic<int> &m_getConstantsCount;
+
+ public:
+  ConstantsViewManager(const char *name, std::atomic<int> &getConstantsCount)
+      : TestViewManager(name), m_getConstantsCount{getConstantsCount} {}
+
+  dynamic GetNativeProps() const override {
+    auto props = dynamic::object();
+    for (int i = 0; i < 60; ++i)
+      props.insert("prop" + std::to_string(i), i % 2 ? "number" : "string");
+    return props;
+  }
+
+  dynamic GetExportedCustomBubblingEventTypeConstants() const override {
+    auto events = dynamic::object();
+    for (const char *name : {"Press", "Change", "Focus", "Blur", "KeyDown", "KeyUp", "TouchStart", "TouchEnd"}) {
+      string eventName = string("top") + name;
+      events[eventName] = dynamic::object(
+          "phasedRegistrationNames",
+          dynamic::object("bubbled", string("on") + name)("captured", string("on") + name + "Capture"));
+    }
+    return events;
+  }
+
+  dynamic GetConstants() const override {
+    ++m_getConstantsCount;
+    return TestViewManager::GetConstants();
+  }
+};
+
+string ViewManagerName(int index) {
+  return "TestViewManager" + std::to_string(index);
+}
+
+// Owns a UIManager with the given number of view managers.
+class UIManagerHolder {
+  // Declared first, so that it outlives the UIManager that uses it.
+  TestNativeUIManager m_nativeUIManager;
+
+ public:
+  UIManagerHolder(int viewManagerCount) {
+    vector<unique_ptr<IViewManager>> viewManagers;
+    for (int i = 0; i < viewManagerCount; ++i)
+      viewManagers.push_back(std::make_unique<ConstantsViewManager>(ViewManagerName(i).c_str(), GetConstantsCount));
+
+    UIManager = createIUIManager(std::move(viewManagers), &m_nativeUIManager);
+  }
+
+  std::atomic<int> GetConstantsCount{0};
+  std::shared_ptr<IUIManager> UIManager;
+};
+
+} // namespace
+
+TEST_CLASS (UIManagerConstantsTest) {
+  TEST_METHOD(EagerConstantsIncludeAllViewManagers) {
+    UIManagerHolder holder{5};
+    auto module = createUIManagerModule(std::shared_ptr<IUIManager>(holder.UIManager), nullptr, false);
+
+    auto constants = module->getConstants();
+    Assert::AreEqual(5, holder.GetConstantsCount.load());
+    Assert::AreEqual(size_t{5}, constants.size());
+    for (int i = 0; i < 5; ++i)
+      Assert::IsTrue(constants.find(ViewManagerName(i)) != constants.end());
+  }
+
+  TEST_METHOD(LazyConstantsIncludeOnlyViewManagerNames) {
+    UIManagerHolder holder{5};
+    auto module = createUIManagerModule(std::shared_ptr<IUIManager>(holder.UIManager), nullptr, true);
+
+    auto constants = module->getConstants();
+    Assert::AreEqual(0, holder.GetConstantsCount.load());
+    Assert::IsTrue(constants["LazyViewManagersEnabled"].asBool());
+
+    auto &names = constants["ViewManagerNames"];
+    Assert::AreEqual(size_t{5}, names.size());
+    for (int i = 0; i < 5; ++i)
+      Assert::AreEqual(ViewManagerName(i), names[i].asString());
+  }
+
+  TEST_METHOD(GetConstantsForViewManagerIsCached) {
+    UIManagerHolder holder{5};
+
+    auto constants = holder.UIManager->getConstantsForViewManager(ViewManagerName(3));
+    Assert::AreEqual(1, holder.GetConstantsCount.load());
+    Assert::IsTrue(constants.isObject());
+    Assert::IsTrue(constants.count("NativeProps") == 1);
+
+    Assert::IsTrue(constants == holder.UIManager->getConstantsForViewManager(ViewManagerName(3)));
+    Assert::AreEqual(1, holder.GetConstantsCount.load());
+
+    Assert::IsTrue(holder.UIManager->getConstantsForViewManager("NotRegistered").isNull());
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(StartupConstantsCost) {
+    using clock = std::chrono::steady_clock;
+    constexpr int iterations = 20;
+
+    // Startup needs the module constants and the constants of the few view managers used by the first screen.
+    auto measure = [](int viewManagerCount, bool lazy) {
+      auto elapsed = clock::duration::zero();
+      for (int i = 0; i < iterations; ++i) {
+        UIManagerHolder holder{viewManagerCount};
+        auto module = createUIManagerModule(std::shared_ptr<IUIManager>(holder.UIManager), nullptr, lazy);
+
+        auto start = clock::now();
+        auto constants = module->getConstants();
+        if (lazy) {
+          for (int j = 0; j < 10; ++j)
+            holder.UIManager->getConstantsForViewManager(ViewManagerName(j));
+        }
+        elapsed += clock::now() - start;
+      }
+
+      return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / iterations;
+    };
+
+    for (int viewManagerCount : {30, 300}) {
+      std::ostringstream result;
+      result << "UIManager startup constants with " << viewManagerCount << " view managers (us): eager "
+             << measure(viewManagerCount, false) << ", lazy " << measure(viewManagerCount, true);
+      Logger::WriteMessage(result.str().c_str());
+    }
+  }
+#endif // PERF_TESTS
+};
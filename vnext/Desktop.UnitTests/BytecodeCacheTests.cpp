@@ -0,0 +1,292 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../Chakra/ChakraBytecodeCache.h"
+
+using facebook::react::BytecodeCheckResult;
+using facebook::react::BytecodeEngineVersion;
+using facebook::react::BytecodePrefix;
+using facebook::react::BytecodeSerializationWorker;
+using facebook::react::checkBytecode;
+using facebook::react::writeBytecodeFile;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+namespace {
+
+constexpr const char *const c_bytecodeFileName = "bytecodeCacheTest.bytecode";
+constexpr BytecodeEngineVersion c_engineVersion{1, 11, 13, 0};
+
+std::vector<char> ReadFile(const char *filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::vector<char> MakeFileContent(const BytecodePrefix &prefix, const std::vector<uint8_t> &bytecode) {
+  std::vector<char> content(sizeof(prefix) + bytecode.size());
+  std::copy_n(reinterpret_cast<const char *>(&prefix), sizeof(prefix), content.begin());
+  std::copy(bytecode.begin(), bytecode.end(), content.begin() + sizeof(prefix));
+  return content;
+}
+
+BytecodeCheckResult CheckBytecodeFile(const BytecodePrefix &prefix) {
+  auto content = ReadFile(c_bytecodeFileName);
+  return checkBytecode(content.empty() ? nullptr : content.data(), content.size(), prefix);
+}
+
+size_t CountTempFiles() {
+  size_t count = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(std::filesystem::current_path())) {
+    auto fileName = entry.path().filename().string();
+    if (fileName.rfind(c_bytecodeFileName, 0) == 0 && entry.path().extension() == ".tmp") {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (BytecodeCacheTests) {
+  TEST_METHOD_INITIALIZE(DeleteBytecodeFile) {
+    std::error_code ec;
+    std::filesystem::remove(c_bytecodeFileName, ec);
+  }
+
+  TEST_METHOD(CheckBytecode_Valid) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    auto content = MakeFileContent(prefix, {1, 2, 3});
+    Assert::IsTrue(checkBytecode(content.data(), content.size(), prefix) == BytecodeCheckResult::Valid);
+  }
+
+  TEST_METHOD(CheckBytecode_Missing) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    Assert::IsTrue(checkBytecode(nullptr, 0, prefix) == BytecodeCheckResult::Missing);
+  }
+
+  TEST_METHOD(CheckBytecode_Truncated) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    auto content = MakeFileContent(prefix, {1, 2, 3});
+
+    // Empty file, partial prefix and a prefix without bytecode.
+    for (size_t size : {size_t{0}, size_t{1}, sizeof(BytecodePrefix) - 1, sizeof(BytecodePrefix)}) {
+      Assert::IsTrue(checkBytecode(content.data(), size, prefix) == BytecodeCheckResult::Truncated);
+    }
+  }
+
+  TEST_METHOD(CheckBytecode_StaleBundleVersion) {
+    auto content = MakeFileContent(BytecodePrefix{41, c_engineVersion}, {1, 2, 3});
+    Assert::IsTrue(
+        checkBytecode(content.data(), content.size(), BytecodePrefix{42, c_engineVersion}) ==
+        BytecodeCheckResult::Stale);
+  }
+
+  TEST_METHOD(CheckBytecode_StaleEngineVersion) {
+    auto content = MakeFileContent(BytecodePrefix{42, BytecodeEngineVersion{1, 11, 12, 0}}, {1, 2, 3});
+    Assert::IsTrue(
+        checkBytecode(content.data(), content.size(), BytecodePrefix{42, c_engineVersion}) ==
+        BytecodeCheckResult::Stale);
+  }
+
+  TEST_METHOD(CheckBytecode_StaleFileFormatVersion) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    auto content = MakeFileContent(prefix, {1, 2, 3});
+    constexpr uint64_t oldFileFormatVersion = BytecodePrefix::s_bytecodeFileFormatVersion - 1;
+    std::copy_n(reinterpret_cast<const char *>(&oldFileFormatVersion), sizeof(oldFileFormatVersion), content.begin());
+    Assert::IsTrue(checkBytecode(content.data(), content.size(), prefix) == BytecodeCheckResult::Stale);
+  }
+
+  TEST_METHOD(CheckBytecode_Unaligned) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    auto content = MakeFileContent(prefix, {1, 2, 3});
+    content.insert(content.begin(), 'x');
+    Assert::IsTrue(checkBytecode(content.data() + 1, content.size() - 1, prefix) == BytecodeCheckResult::Valid);
+  }
+
+  TEST_METHOD(WriteBytecodeFile_CreatesFile) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    std::vector<uint8_t> bytecode{1, 2, 3, 4, 5};
+    Assert::IsTrue(writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size()));
+
+    Assert::IsTrue(ReadFile(c_bytecodeFileName) == MakeFileContent(prefix, bytecode));
+    Assert::IsTrue(CheckBytecodeFile(prefix) == BytecodeCheckResult::Valid);
+    Assert::IsTrue(CountTempFiles() == 0);
+  }
+
+  TEST_METHOD(WriteBytecodeFile_ReplacesStaleFile) {
+    BytecodePrefix stalePrefix{41, c_engineVersion};
+    std::vector<uint8_t> staleBytecode(1000, 7);
+    Assert::IsTrue(writeBytecodeFile(c_bytecodeFileName, stalePrefix, staleBytecode.data(), staleBytecode.size()));
+
+    BytecodePrefix prefix{42, c_engineVersion};
+    Assert::IsTrue(CheckBytecodeFile(prefix) == BytecodeCheckResult::Stale);
+
+    std::vector<uint8_t> bytecode{1, 2, 3};
+    Assert::IsTrue(writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size()));
+
+    Assert::IsTrue(ReadFile(c_bytecodeFileName) == MakeFileContent(prefix, bytecode));
+    Assert::IsTrue(CountTempFiles() == 0);
+  }
+
+  TEST_METHOD(WriteBytecodeFile_ReplacesTruncatedFile) {
+    {
+      std::ofstream truncatedFile(c_bytecodeFileName, std::ios::binary);
+      truncatedFile.write("\0\0\0\0", 4);
+    }
+
+    BytecodePrefix prefix{42, c_engineVersion};
+    Assert::IsTrue(CheckBytecodeFile(prefix) == BytecodeCheckResult::Truncated);
+
+    std::vector<uint8_t> bytecode{1, 2, 3};
+    Assert::IsTrue(writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size()));
+    Assert::IsTrue(CheckBytecodeFile(prefix) == BytecodeCheckResult::Valid);
+  }
+
+  TEST_METHOD(WriteBytecodeFile_ConcurrentWriters) {
+    // Each writer produces a different but complete file. Whoever renames last
+    // wins, and the result must be exactly one of the complete files.
+    constexpr uint64_t writerCount = 8;
+    constexpr size_t bytecodeSize = 256 * 1024;
+    std::vector<std::vector<char>> expectedContents;
+    std::vector<std::thread> writers;
+    std::atomic<bool> start{false};
+    std::atomic<uint32_t> failedWrites{0};
+
+    for (uint64_t i = 0; i < writerCount; ++i) {
+      expectedContents.push_back(
+          MakeFileContent(BytecodePrefix{i, c_engineVersion}, std::vector<uint8_t>(bytecodeSize, uint8_t(i))));
+    }
+
+    for (uint64_t i = 0; i < writerCount; ++i) {
+      writers.emplace_back([i, &start, &failedWrites]() {
+        while (!start) {
+          std::this_thread::yield();
+        }
+
+        BytecodePrefix prefix{i, c_engineVersion};
+        std::vector<uint8_t> bytecode(bytecodeSize, uint8_t(i));
+        for (int repeat = 0; repeat < 10; ++repeat) {
+          if (!writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size())) {
+            ++failedWrites;
+          }
+        }
+      });
+    }
+
+    start = true;
+    for (auto &writer : writers) {
+      writer.join();
+    }
+
+    // Rename may fail while another writer replaces the same file on some
+    // platforms, but at least one writer must succeed.
+    Assert::IsTrue(failedWrites < writerCount * 10);
+
+    auto content = ReadFile(c_bytecodeFileName);
+    Assert::IsTrue(std::find(expectedContents.begin(), expectedContents.end(), content) != expectedContents.end());
+    Assert::IsTrue(CountTempFiles() == 0);
+  }
+
+  TEST_METHOD(WriteBytecodeFile_ReaderNeverSeesTornFile) {
+    BytecodePrefix prefix{42, c_engineVersion};
+    std::vector<uint8_t> bytecode(64 * 1024, 9);
+    Assert::IsTrue(writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size()));
+    auto expectedContent = MakeFileContent(prefix, bytecode);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+      for (int i = 0; i < 50; ++i) {
+        writeBytecodeFile(c_bytecodeFileName, prefix, bytecode.data(), bytecode.size());
+      }
+
+      done = true;
+    });
+
+    while (!done) {
+      auto content = ReadFile(c_bytecodeFileName);
+      // The file may be briefly unavailable while it is replaced, but it is
+      // never partially written.
+      Assert::IsTrue(content.empty() || content == expectedContent);
+    }
+
+    writer.join();
+  }
+
+  TEST_METHOD(SerializationWorker_RunsJobsInOrder) {
+    std::vector<int> results;
+    BytecodeSerializationWorker worker;
+    for (int i = 0; i < 10; ++i) {
+      worker.post([i, &results]() noexcept { results.push_back(i); });
+    }
+
+    worker.waitForIdle();
+    Assert::IsTrue(results == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  }
+
+  TEST_METHOD(SerializationWorker_DoesNotBlockPoster) {
+    std::atomic<bool> canFinish{false};
+    std::atomic<bool> finished{false};
+    BytecodeSerializationWorker worker;
+
+    // The job cannot complete until post returns, so post must not wait for it.
+    worker.post([&]() noexcept {
+      while (!canFinish) {
+        std::this_thread::yield();
+      }
+
+      finished = true;
+    });
+
+    canFinish = true;
+    worker.waitForIdle();
+    Assert::IsTrue(finished);
+  }
+
+  TEST_METHOD(SerializationWorker_DestructorDropsPendingJobs) {
+    std::atomic<bool> canFinish{false};
+    std::atomic<bool> firstStarted{false};
+    std::atomic<int> completedJobs{0};
+    std::thread releaser;
+
+    {
+      BytecodeSerializationWorker worker;
+      worker.post([&]() noexcept {
+        firstStarted = true;
+        while (!canFinish) {
+          std::this_thread::yield();
+        }
+
+        ++completedJobs;
+      });
+      worker.post([&]() noexcept { ++completedJobs; });
+
+      while (!firstStarted) {
+        std::this_thread::yield();
+      }
+
+      releaser = std::thread([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        canFinish = true;
+      });
+    }
+
+    releaser.join();
+
+    // The running job completes, the pending one never starts.
+    Assert::IsTrue(completedJobs == 1);
+  }
+};
+
+} // namespace Microsoft::React::Test
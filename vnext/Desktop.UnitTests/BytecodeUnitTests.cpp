@@ -96,7 +96,7 @@ TEST_CLASS (BytecodeUnitTests) {
         scirptVersion,
         testScriptFriendlyName(),
         testScriptBytecodeFilename,
-        false /* asyncBytecodeGeneration */);
+        nullptr /* bytecodeWorker */);
     Assert::IsTrue(isCorrectTestScriptResult(result));
   }
 
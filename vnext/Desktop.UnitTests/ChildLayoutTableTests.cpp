@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <ChildLayoutTable.h>
+#include <CppUnitTest.h>
+#include <vector>
+
+#ifdef PERF_TESTS
+#include <chrono>
+#include <sstream>
+#endif // PERF_TESTS
+
+using namespace facebook::react;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+
+namespace {
+
+// Stands for the platform view of a child.
+struct FakeChild {
+  int measureCount = 0;
+};
+
+// Measures and arranges children the way a panel does in its layout
+// overrides.
+void MeasureAndArrange(ChildLayoutTable &table, std::vector<FakeChild> &children) {
+  for (auto &child : children) {
+    if (table.TakeNeedsMeasure(&child)) {
+      ++child.measureCount;
+    }
+  }
+
+  for (auto &child : children) {
+    table.ArrangeChild(&child);
+  }
+  table.EndArrange();
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (ChildLayoutTableTests) {
+  TEST_METHOD(ChildLayoutTable_ArrangesCommittedFrames) {
+    ChildLayoutTable table;
+    FakeChild child;
+    Assert::IsNull(table.ArrangeChild(&child));
+
+    table.CommitLayout(&child, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto frame = table.ArrangeChild(&child);
+    Assert::IsNotNull(frame);
+    Assert::IsTrue(*frame == LayoutFrame{1.0f, 2.0f, 3.0f, 4.0f});
+
+    table.CommitLayout(&child, {5.0f, 6.0f, 3.0f, 4.0f});
+    Assert::IsTrue(*table.ArrangeChild(&child) == LayoutFrame{5.0f, 6.0f, 3.0f, 4.0f});
+  }
+
+  TEST_METHOD(ChildLayoutTable_MeasuresNewChildrenOnce) {
+    ChildLayoutTable table;
+    std::vector<FakeChild> children(3);
+
+    MeasureAndArrange(table, children);
+    MeasureAndArrange(table, children);
+    for (const auto &child : children) {
+      Assert::AreEqual(1, child.measureCount);
+    }
+  }
+
+  TEST_METHOD(ChildLayoutTable_MeasuresChildrenWhoseSizeChanged) {
+    ChildLayoutTable table;
+    std::vector<FakeChild> children(3);
+    for (auto &child : children) {
+      table.CommitLayout(&child, {0.0f, 0.0f, 10.0f, 10.0f});
+    }
+    MeasureAndArrange(table, children);
+
+    // Moving a child does not change its measure.
+    table.CommitLayout(&children[0], {5.0f, 5.0f, 10.0f, 10.0f});
+    table.CommitLayout(&children[1], {0.0f, 0.0f, 20.0f, 10.0f});
+    table.CommitLayout(&children[2], {0.0f, 0.0f, 10.0f, 20.0f});
+    MeasureAndArrange(table, children);
+
+    Assert::AreEqual(1, children[0].measureCount);
+    Assert::AreEqual(2, children[1].measureCount);
+    Assert::AreEqual(2, children[2].measureCount);
+  }
+
+  TEST_METHOD(ChildLayoutTable_RemoveChildForgetsLayout) {
+    ChildLayoutTable table;
+    FakeChild child;
+    table.CommitLayout(&child, {1.0f, 2.0f, 3.0f, 4.0f});
+    table.TakeNeedsMeasure(&child);
+
+    // A new child may reuse the address of a removed one.
+    table.RemoveChild(&child);
+    Assert::IsNull(table.ArrangeChild(&child));
+    Assert::IsTrue(table.TakeNeedsMeasure(&child));
+
+    table.Clear();
+    Assert::AreEqual(size_t{0}, table.Size());
+  }
+
+  TEST_METHOD(ChildLayoutTable_ForgetsChildrenThatAreNotArranged) {
+    ChildLayoutTable table;
+    std::vector<FakeChild> children(4);
+    for (auto &child : children) {
+      table.CommitLayout(&child, {0.0f, 0.0f, 10.0f, 10.0f});
+    }
+    MeasureAndArrange(table, children);
+    Assert::AreEqual(size_t{4}, table.Size());
+
+    // Two children leave the panel without RemoveChild.
+    std::vector<FakeChild *> remaining{&children[0], &children[2]};
+    for (auto child : remaining) {
+      Assert::IsNotNull(table.ArrangeChild(child));
+    }
+    table.EndArrange();
+
+    Assert::AreEqual(size_t{2}, table.Size());
+    Assert::IsNull(table.ArrangeChild(&children[1]));
+    Assert::IsNotNull(table.ArrangeChild(&children[2]));
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(ChildLayoutTable_LayoutPassCost) {
+    using clock = std::chrono::steady_clock;
+    constexpr int passCount = 100;
+
+    for (size_t childCount : {10, 100, 1000, 10000}) {
+      ChildLayoutTable table;
+      std::vector<FakeChild> children(childCount);
+      for (size_t i = 0; i < childCount; ++i) {
+        table.CommitLayout(&children[i], {0.0f, static_cast<float>(i) * 10.0f, 100.0f, 10.0f});
+      }
+      MeasureAndArrange(table, children);
+
+      // Each pass resizes one child in a hundred and moves the others, like
+      // content inserted at the top of a list.
+      int measureCount = 0;
+      auto start = clock::now();
+      for (int pass = 0; pass < passCount; ++pass) {
+        for (size_t i = 0; i < childCount; ++i) {
+          const float height = (i % 100 == 0) ? static_cast<float>(10 + pass % 2) : 10.0f;
+          table.CommitLayout(&children[i], {0.0f, static_cast<float>(i + pass) * 10.0f, 100.0f, height});
+        }
+
+        for (auto &child : children) {
+          if (table.TakeNeedsMeasure(&child)) {
+            ++measureCount;
+          }
+        }
+        for (auto &child : children) {
+          table.ArrangeChild(&child);
+        }
+        table.EndArrange();
+      }
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+
+      std::ostringstream result;
+      result << "ChildLayoutTable layout pass for " << childCount << " children: " << elapsed / passCount << " ns, "
+             << static_cast<double>(measureCount) / passCount << " children measured";
+      Logger::WriteMessage(result.str().c_str());
+    }
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <ContentName.h>
+#include <CppUnitTest.h>
+#include <vector>
+
+using namespace facebook::react;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+namespace {
+
+// Stands for the children of a view: text blocks, elements that can be
+// converted to a string and other elements.
+struct FakeChild {
+  enum class Kind { Text, Stringable, Other } kind;
+  std::wstring value;
+  int id{0};
+};
+
+// Same rule as DynamicAutomationPeer: text blocks are named by their text,
+// other elements by their string conversion if they have one.
+std::wstring ChildNameOf(const FakeChild &child) {
+  switch (child.kind) {
+    case FakeChild::Kind::Text:
+      return child.value;
+    case FakeChild::Kind::Stringable:
+      return L"[" + child.value + L"]";
+    default:
+      return {};
+  }
+}
+
+// Same as DynamicAutomationPeer: the string conversion of other elements may
+// change without a new content version.
+std::wstring CacheableChildNameOf(const FakeChild &child, bool &isCacheable) {
+  if (child.kind == FakeChild::Kind::Stringable) {
+    isCacheable = false;
+  }
+  return ChildNameOf(child);
+}
+
+int ChildIdOf(const FakeChild &child) {
+  return child.id;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (ContentNameTests) {
+  TEST_METHOD(ComposeContentName_NoChildren) {
+    Assert::IsTrue(ComposeContentName(std::vector<FakeChild>{}, ChildNameOf).empty());
+  }
+
+  TEST_METHOD(ComposeContentName_KeepsDocumentOrder) {
+    std::vector<FakeChild> children{
+        {FakeChild::Kind::Text, L"one"}, {FakeChild::Kind::Text, L"two"}, {FakeChild::Kind::Text, L"three"}};
+    Assert::IsTrue(ComposeContentName(children, ChildNameOf) == L"one two three");
+  }
+
+  TEST_METHOD(ComposeContentName_MixesTextAndStringableChildren) {
+    std::vector<FakeChild> children{
+        {FakeChild::Kind::Stringable, L"a"},
+        {FakeChild::Kind::Text, L"b"},
+        {FakeChild::Kind::Other, L"ignored"},
+        {FakeChild::Kind::Stringable, L"c"},
+        {FakeChild::Kind::Text, L"d"}};
+    Assert::IsTrue(ComposeContentName(children, ChildNameOf) == L"[a] b [c] d");
+  }
+
+  TEST_METHOD(ComposeContentName_SkipsChildrenWithoutName) {
+    std::vector<FakeChild> children{
+        {FakeChild::Kind::Text, L""},
+        {FakeChild::Kind::Other, L"ignored"},
+        {FakeChild::Kind::Text, L"one"},
+        {FakeChild::Kind::Text, L""},
+        {FakeChild::Kind::Text, L"two"},
+        {FakeChild::Kind::Other, L"ignored"}};
+    Assert::IsTrue(ComposeContentName(children, ChildNameOf) == L"one two");
+  }
+
+  TEST_METHOD(ComposeContentName_ManyChildren) {
+    std::vector<FakeChild> children;
+    std::wstring expected;
+    for (int i = 0; i < 10000; ++i) {
+      children.push_back({i % 2 ? FakeChild::Kind::Text : FakeChild::Kind::Stringable, std::to_wstring(i)});
+      expected += (i == 0 ? L"" : L" ") + ChildNameOf(children.back());
+    }
+    Assert::IsTrue(ComposeContentName(children, ChildNameOf) == expected);
+  }
+
+  TEST_METHOD(AppendContentName_SeparatesNames) {
+    std::wstring name;
+    AppendContentName(name, L"one");
+    Assert::IsTrue(name == L"one");
+    AppendContentName(name, L"");
+    Assert::IsTrue(name == L"one");
+    AppendContentName(name, L"two");
+    Assert::IsTrue(name == L"one two");
+  }
+
+  TEST_METHOD(ContentNameCache_ReusesNameForSameVersionAndChildren) {
+    std::vector<FakeChild> children{{FakeChild::Kind::Text, L"one", 1}, {FakeChild::Kind::Text, L"two", 2}};
+    ContentNameCache<int> cache;
+
+    Assert::IsTrue(cache.Update(1, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"one two");
+    Assert::IsFalse(cache.Update(1, children, ChildIdOf, CacheableChildNameOf));
+
+    // A text change comes with a new version.
+    children[0].value = L"three";
+    Assert::IsTrue(cache.Update(2, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"three two");
+  }
+
+  TEST_METHOD(ContentNameCache_TracksChildrenChangedWithoutNewVersion) {
+    std::vector<FakeChild> children{{FakeChild::Kind::Text, L"one", 1}, {FakeChild::Kind::Text, L"two", 2}};
+    ContentNameCache<int> cache;
+    cache.Update(1, children, ChildIdOf, CacheableChildNameOf);
+
+    // The view removes the deleted child and gets a new version. A layout
+    // animation then appends it again, and removes it once the animation
+    // ended, without going through the view.
+    FakeChild deleted = children[0];
+    children.erase(children.begin());
+    Assert::IsTrue(cache.Update(2, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"two");
+
+    children.push_back(deleted);
+    Assert::IsTrue(cache.Update(2, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"two one");
+
+    children.pop_back();
+    Assert::IsTrue(cache.Update(2, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"two");
+  }
+
+  TEST_METHOD(ContentNameCache_RebuildsNamesOfStringableChildren) {
+    std::vector<FakeChild> children{{FakeChild::Kind::Text, L"one", 1}, {FakeChild::Kind::Stringable, L"a", 2}};
+    ContentNameCache<int> cache;
+    cache.Update(1, children, ChildIdOf, CacheableChildNameOf);
+    Assert::IsTrue(cache.Name() == L"one [a]");
+
+    children[1].value = L"b";
+    Assert::IsTrue(cache.Update(1, children, ChildIdOf, CacheableChildNameOf));
+    Assert::IsTrue(cache.Name() == L"one [b]");
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using facebook::react::CxxMessageQueue;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Runs the runloop of a CxxMessageQueue on its own thread.
+class QueueThread {
+ public:
+  QueueThread() : m_queue{std::make_shared<CxxMessageQueue>()}, m_thread{CxxMessageQueue::getRunLoop(m_queue)} {}
+
+  ~QueueThread() {
+    Quit();
+  }
+
+  CxxMessageQueue &Queue() {
+    return *m_queue;
+  }
+
+  std::shared_ptr<CxxMessageQueue> SharedQueue() {
+    return m_queue;
+  }
+
+  void Quit() {
+    if (m_thread.joinable()) {
+      m_queue->quitSynchronous();
+      m_thread.join();
+    }
+  }
+
+ private:
+  std::shared_ptr<CxxMessageQueue> m_queue;
+  std::thread m_thread;
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (CxxMessageQueueTests) {
+  TEST_METHOD(CxxMessageQueue_RunsTasksInPostOrder) {
+    QueueThread queueThread;
+    std::vector<int> order;
+
+    for (int i = 0; i < 100; ++i) {
+      queueThread.Queue().runOnQueue([&order, i]() { order.push_back(i); });
+    }
+    queueThread.Queue().runOnQueueSync([]() {});
+
+    Assert::AreEqual(size_t{100}, order.size());
+    for (int i = 0; i < 100; ++i) {
+      Assert::AreEqual(i, order[i]);
+    }
+  }
+
+  TEST_METHOD(CxxMessageQueue_MultipleProducersStress) {
+    constexpr int producerCount = 8;
+    constexpr int postsPerProducer = 20000;
+
+    QueueThread queueThread;
+    // Only accessed on the queue thread.
+    std::vector<int> lastSeen(producerCount, -1);
+    bool inOrder = true;
+    int runCount = 0;
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerCount; ++producer) {
+      producers.emplace_back([&, producer]() {
+        while (!start) {
+          std::this_thread::yield();
+        }
+
+        for (int i = 0; i < postsPerProducer; ++i) {
+          // Alternate between callables that fit in the inline buffer of
+          // std::function and ones that do not.
+          if (i % 2 == 0) {
+            queueThread.Queue().runOnQueue([&, producer, i]() {
+              inOrder = inOrder && lastSeen[producer] == i - 1;
+              lastSeen[producer] = i;
+              ++runCount;
+            });
+          } else {
+            std::array<int, 16> payload{};
+            payload.back() = i;
+            queueThread.Queue().runOnQueue([&, producer, payload]() {
+              inOrder = inOrder && lastSeen[producer] == payload.back() - 1;
+              lastSeen[producer] = payload.back();
+              ++runCount;
+            });
+          }
+        }
+      });
+    }
+
+    start = true;
+    for (auto &producer : producers) {
+      producer.join();
+    }
+    queueThread.Queue().runOnQueueSync([]() {});
+
+    Assert::AreEqual(producerCount * postsPerProducer, runCount);
+    Assert::IsTrue(inOrder);
+  }
+
+  TEST_METHOD(CxxMessageQueue_ReleasesCallablesAfterRunning) {
+    QueueThread queueThread;
+    auto token = std::make_shared<int>(0);
+    std::weak_ptr<int> weakToken = token;
+
+    queueThread.Queue().runOnQueue([token = std::move(token)]() {});
+    queueThread.Queue().runOnQueueSync([]() {});
+
+    // The task is kept for reuse, but not the state it captured.
+    Assert::IsTrue(weakToken.expired());
+  }
+
+  TEST_METHOD(CxxMessageQueue_CurrentIsSetOnQueueThread) {
+    QueueThread queueThread;
+    std::shared_ptr<CxxMessageQueue> current;
+
+    queueThread.Queue().runOnQueueSync([&current]() { current = CxxMessageQueue::current().lock(); });
+
+    Assert::IsTrue(current == queueThread.SharedQueue());
+    Assert::IsTrue(CxxMessageQueue::current().expired());
+  }
+
+  TEST_METHOD(CxxMessageQueue_CurrentIsClearedAfterQuit) {
+    auto queue = std::make_shared<CxxMessageQueue>();
+    std::thread thread{[runLoop = CxxMessageQueue::getRunLoop(queue)]() {
+      runLoop();
+      Assert::IsTrue(CxxMessageQueue::current().expired());
+    }};
+
+    queue->quitSynchronous();
+    thread.join();
+  }
+
+  TEST_METHOD(CxxMessageQueue_RunsDelayedTasksAfterImmediateOnes) {
+    QueueThread queueThread;
+    std::vector<int> order;
+    std::atomic<bool> done{false};
+
+    queueThread.Queue().runOnQueueDelayed(
+        [&]() {
+          order.push_back(2);
+          done = true;
+        },
+        20);
+    queueThread.Queue().runOnQueue([&]() { order.push_back(1); });
+
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!done && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(1ms);
+    }
+
+    queueThread.Quit();
+    Assert::AreEqual(size_t{2}, order.size());
+    Assert::AreEqual(1, order[0]);
+    Assert::AreEqual(2, order[1]);
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(CxxMessageQueue_PostToRunLatency) {
+    constexpr size_t iterations = 200000;
+    using clock = std::chrono::steady_clock;
+
+    QueueThread queueThread;
+    std::vector<clock::duration> latencies;
+    latencies.reserve(iterations);
+
+    for (size_t i = 0; i < iterations; ++i) {
+      auto posted = clock::now();
+      queueThread.Queue().runOnQueue([&latencies, posted]() { latencies.push_back(clock::now() - posted); });
+
+      // Keep a few tasks in flight so that both the wake up and the steady
+      // state paths are measured.
+      if (i % 16 == 15) {
+        queueThread.Queue().runOnQueueSync([]() {});
+      }
+    }
+    queueThread.Queue().runOnQueueSync([]() {});
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+      auto index = static_cast<size_t>(p * (latencies.size() - 1));
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(latencies[index]).count();
+    };
+
+    std::ostringstream result;
+    result << "CxxMessageQueue post-to-run latency (ns) over " << latencies.size() << " tasks: p50 "
+           << percentile(0.5) << ", p90 " << percentile(0.9) << ", p99 " << percentile(0.99) << ", p99.9 "
+           << percentile(0.999) << ", max " << percentile(1.0);
+    Logger::WriteMessage(result.str().c_str());
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
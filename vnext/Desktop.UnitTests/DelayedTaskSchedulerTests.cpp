@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <DelayedTaskScheduler.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+using facebook::react::DelayedTaskQueue;
+using facebook::react::DelayedTaskScheduler;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Clock that only moves when a test advances it.
+struct FakeClock {
+  using duration = std::chrono::nanoseconds;
+  using rep = duration::rep;
+  using period = duration::period;
+  using time_point = std::chrono::time_point<FakeClock>;
+  static constexpr bool is_steady = true;
+
+  static time_point now() noexcept {
+    return time_point{duration{s_now.load()}};
+  }
+
+  static void Advance(duration delta) noexcept {
+    s_now += delta.count();
+  }
+
+  static std::atomic<rep> s_now;
+};
+
+std::atomic<FakeClock::rep> FakeClock::s_now{0};
+
+// Records the tasks handed to the dispatcher and lets tests wait for them.
+class DispatchLog {
+ public:
+  std::function<void(std::function<void()> &&)> Dispatcher() {
+    return [this](std::function<void()> &&task) {
+      task();
+      std::lock_guard<std::mutex> lock{m_mutex};
+      ++m_dispatchCount;
+      m_dispatched.notify_all();
+    };
+  }
+
+  bool WaitForDispatchCount(size_t count, std::chrono::milliseconds timeout = 5s) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_dispatched.wait_for(lock, timeout, [&]() { return m_dispatchCount >= count; });
+  }
+
+  size_t DispatchCount() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_dispatchCount;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_dispatched;
+  size_t m_dispatchCount{0};
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (DelayedTaskSchedulerTests) {
+  TEST_METHOD(DelayedTaskQueue_TaskIsDueExactlyAtDeadline) {
+    DelayedTaskQueue<FakeClock> queue;
+    auto start = FakeClock::now();
+    queue.Push(start + 100ms, []() {});
+
+    Assert::IsTrue(queue.PopDueTasks(start + 100ms - 1ns).empty());
+    Assert::IsTrue(queue.NextDeadline() == start + 100ms);
+    Assert::IsTrue(queue.PopDueTasks(start + 100ms).size() == 1);
+    Assert::IsTrue(queue.Empty());
+    Assert::IsFalse(queue.NextDeadline().has_value());
+  }
+
+  TEST_METHOD(DelayedTaskQueue_OrdersByDeadline) {
+    DelayedTaskQueue<FakeClock> queue;
+    auto start = FakeClock::now();
+    std::vector<int> order;
+    queue.Push(start + 30ms, [&]() { order.push_back(3); });
+    queue.Push(start + 10ms, [&]() { order.push_back(1); });
+    queue.Push(start + 20ms, [&]() { order.push_back(2); });
+
+    Assert::IsTrue(queue.NextDeadline() == start + 10ms);
+    for (auto &task : queue.PopDueTasks(start + 25ms)) {
+      task();
+    }
+
+    Assert::IsTrue(order == std::vector<int>{1, 2});
+    Assert::IsTrue(queue.Size() == 1);
+    Assert::IsTrue(queue.NextDeadline() == start + 30ms);
+  }
+
+  TEST_METHOD(DelayedTaskQueue_KeepsPostingOrderForSameDeadline) {
+    DelayedTaskQueue<FakeClock> queue;
+    auto deadline = FakeClock::now() + 10ms;
+    std::vector<int> order;
+    for (int i = 0; i < 100; ++i) {
+      queue.Push(deadline, [&order, i]() { order.push_back(i); });
+    }
+
+    for (auto &task : queue.PopDueTasks(deadline)) {
+      task();
+    }
+
+    Assert::IsTrue(order.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+      Assert::IsTrue(order[i] == i);
+    }
+  }
+
+  TEST_METHOD(DelayedTaskScheduler_DispatchesAtFakeDeadline) {
+    DispatchLog log;
+    DelayedTaskScheduler<FakeClock> scheduler{log.Dispatcher()};
+    scheduler.PostDelayedTask([]() {}, 10s);
+
+    // Posting a task wakes up the timer thread, so it notices the clock change.
+    FakeClock::Advance(10s - 1ns);
+    scheduler.PostDelayedTask([]() {}, 1h);
+    Assert::IsFalse(log.WaitForDispatchCount(1, 50ms));
+    Assert::IsTrue(scheduler.PendingTaskCount() == 2);
+
+    FakeClock::Advance(1ns);
+    scheduler.PostDelayedTask([]() {}, 1h);
+    Assert::IsTrue(log.WaitForDispatchCount(1));
+    Assert::IsTrue(log.DispatchCount() == 1);
+    Assert::IsTrue(scheduler.PendingTaskCount() == 2);
+  }
+
+  TEST_METHOD(DelayedTaskScheduler_DispatchesWithoutPolling) {
+    DispatchLog log;
+    DelayedTaskScheduler<> scheduler{log.Dispatcher()};
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point runTime;
+    scheduler.PostDelayedTask([&]() { runTime = std::chrono::steady_clock::now(); }, 30ms);
+
+    Assert::IsTrue(log.WaitForDispatchCount(1));
+    Assert::IsTrue(runTime - start >= 30ms);
+    // The timer waits for the exact deadline. Allow for a loaded test machine,
+    // but stay well below the old one second polling interval.
+    Assert::IsTrue(runTime - start < 500ms);
+  }
+
+  TEST_METHOD(DelayedTaskScheduler_EarlierTaskPostedLaterRunsFirst) {
+    DispatchLog log;
+    DelayedTaskScheduler<> scheduler{log.Dispatcher()};
+    std::atomic<int> ranTask{0};
+    scheduler.PostDelayedTask([&]() { ranTask = 1; }, 1h);
+    scheduler.PostDelayedTask([&]() { ranTask = 2; }, 10ms);
+
+    Assert::IsTrue(log.WaitForDispatchCount(1, 500ms));
+    Assert::IsTrue(ranTask == 2);
+    Assert::IsTrue(scheduler.PendingTaskCount() == 1);
+  }
+
+  TEST_METHOD(DelayedTaskScheduler_ShutdownJoinsAndDropsPendingTasks) {
+    DispatchLog log;
+    auto start = std::chrono::steady_clock::now();
+    {
+      DelayedTaskScheduler<> scheduler{log.Dispatcher()};
+      scheduler.PostDelayedTask([]() {}, 1h);
+      scheduler.PostDelayedTask([]() {}, 1s);
+    }
+
+    Assert::IsTrue(std::chrono::steady_clock::now() - start < 1s);
+    Assert::IsTrue(log.DispatchCount() == 0);
+  }
+
+  TEST_METHOD(DelayedTaskScheduler_IgnoresTasksAfterShutdown) {
+    DispatchLog log;
+    DelayedTaskScheduler<> scheduler{log.Dispatcher()};
+    scheduler.Shutdown();
+    scheduler.PostDelayedTask([]() {}, 0ms);
+    scheduler.Shutdown();
+
+    Assert::IsTrue(scheduler.PendingTaskCount() == 0);
+    Assert::IsTrue(log.DispatchCount() == 0);
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <DimensionsUpdateCoalescer.h>
+#include <chrono>
+
+using Microsoft::ReactNative::DeviceDimensions;
+using Microsoft::ReactNative::DimensionsUpdateCoalescer;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using UpdateResult = DimensionsUpdateCoalescer::UpdateResult;
+using TimePoint = DimensionsUpdateCoalescer::Clock::time_point;
+
+constexpr auto FrameInterval = 16ms;
+
+DeviceDimensions WindowSize(float width, float height) noexcept {
+  DeviceDimensions dimensions;
+  dimensions.windowWidth = width;
+  dimensions.windowHeight = height;
+  dimensions.scale = 1.5f;
+  dimensions.textScaleFactor = 1.0;
+  dimensions.dpi = 144;
+  dimensions.screenWidth = 2560;
+  dimensions.screenHeight = 1440;
+  return dimensions;
+}
+
+// A fake clock that starts at an arbitrary time.
+struct FakeClock {
+  TimePoint now{1000s};
+
+  TimePoint Advance(DimensionsUpdateCoalescer::Clock::duration duration) noexcept {
+    now += duration;
+    return now;
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (DimensionsUpdateCoalescerTests) {
+  TEST_METHOD(DimensionsUpdateCoalescer_UnchangedDimensionsAreNotReported) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsTrue(UpdateResult::None == coalescer.Update(WindowSize(800, 600), clock.now));
+    Assert::IsTrue(UpdateResult::None == coalescer.Update(WindowSize(800, 600), clock.Advance(1s)));
+    Assert::IsFalse(coalescer.HasDeferredReport());
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_EachFieldIsCompared) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    auto changes = {
+        &DeviceDimensions::windowWidth,
+        &DeviceDimensions::windowHeight,
+        &DeviceDimensions::scale,
+        &DeviceDimensions::dpi,
+    };
+    for (auto field : changes) {
+      DeviceDimensions dimensions = coalescer.Dimensions();
+      dimensions.*field += 1;
+      Assert::IsTrue(UpdateResult::Report == coalescer.Update(dimensions, clock.Advance(1s)));
+    }
+
+    DeviceDimensions dimensions = coalescer.Dimensions();
+    dimensions.textScaleFactor = 1.25;
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(dimensions, clock.Advance(1s)));
+    dimensions.screenWidth = 1920;
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(dimensions, clock.Advance(1s)));
+    dimensions.screenHeight = 1080;
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(dimensions, clock.Advance(1s)));
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_FirstChangeIsReportedImmediately) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(801, 600), clock.now));
+    Assert::IsFalse(coalescer.HasDeferredReport());
+    Assert::IsTrue(WindowSize(801, 600) == coalescer.Dimensions());
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_BurstIsReportedOncePerInterval) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(801, 600), clock.now));
+    TimePoint firstReport = clock.now;
+
+    // Only the first update within the interval asks for a timer.
+    Assert::IsTrue(UpdateResult::Defer == coalescer.Update(WindowSize(802, 600), clock.Advance(2ms)));
+    Assert::IsTrue(coalescer.HasDeferredReport());
+    Assert::IsTrue(firstReport + FrameInterval == coalescer.DeferredReportTime());
+    for (int i = 0; i < 5; ++i) {
+      Assert::IsTrue(UpdateResult::None == coalescer.Update(WindowSize(803.0f + i, 600), clock.Advance(2ms)));
+    }
+
+    // The deferred report sends the latest dimensions.
+    clock.now = coalescer.DeferredReportTime();
+    Assert::IsTrue(coalescer.OnTimer(clock.now));
+    Assert::IsFalse(coalescer.HasDeferredReport());
+    Assert::IsTrue(WindowSize(807, 600) == coalescer.Dimensions());
+
+    // The next interval starts at the deferred report.
+    Assert::IsTrue(UpdateResult::Defer == coalescer.Update(WindowSize(808, 600), clock.Advance(1ms)));
+    Assert::IsTrue(clock.now - 1ms + FrameInterval == coalescer.DeferredReportTime());
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_FinalUpdateOfBurstIsReported) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    int reportCount = 0;
+    DeviceDimensions reported = WindowSize(800, 600);
+    bool timerScheduled = false;
+    TimePoint timerTime{};
+
+    // Resizes every 3ms for 200ms, and fires the timer when due.
+    for (int step = 1; step <= 67; ++step) {
+      clock.Advance(3ms);
+      if (timerScheduled && clock.now >= timerTime) {
+        timerScheduled = false;
+        if (coalescer.OnTimer(clock.now)) {
+          ++reportCount;
+          reported = coalescer.Dimensions();
+        }
+      }
+
+      switch (coalescer.Update(WindowSize(800.0f + step, 600), clock.now)) {
+        case UpdateResult::Report:
+          ++reportCount;
+          reported = coalescer.Dimensions();
+          break;
+        case UpdateResult::Defer:
+          Assert::IsFalse(timerScheduled);
+          timerScheduled = true;
+          timerTime = coalescer.DeferredReportTime();
+          break;
+        case UpdateResult::None:
+          break;
+      }
+    }
+
+    // The resize settles; the timer reports the final size.
+    Assert::IsTrue(timerScheduled);
+    Assert::IsTrue(coalescer.OnTimer(timerTime));
+    ++reportCount;
+    reported = coalescer.Dimensions();
+
+    Assert::IsTrue(WindowSize(867, 600) == reported);
+    // At most one report per frame interval.
+    Assert::IsTrue(reportCount <= 201 / 16 + 2);
+    Assert::IsTrue(reportCount >= 201 / 16);
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_DeferredReportIsDroppedWhenDimensionsGoBack) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(900, 600), clock.now));
+    Assert::IsTrue(UpdateResult::Defer == coalescer.Update(WindowSize(950, 600), clock.Advance(1ms)));
+    Assert::IsTrue(UpdateResult::None == coalescer.Update(WindowSize(900, 600), clock.Advance(1ms)));
+
+    Assert::IsFalse(coalescer.OnTimer(coalescer.DeferredReportTime()));
+    Assert::IsFalse(coalescer.HasDeferredReport());
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_TimerWithoutDeferredReportDoesNothing) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsFalse(coalescer.OnTimer(clock.now));
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(801, 600), clock.Advance(1ms)));
+    Assert::IsFalse(coalescer.OnTimer(clock.Advance(1s)));
+  }
+
+  TEST_METHOD(DimensionsUpdateCoalescer_ChangeAfterIntervalIsReportedImmediately) {
+    FakeClock clock;
+    DimensionsUpdateCoalescer coalescer{FrameInterval, WindowSize(800, 600)};
+
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(801, 600), clock.now));
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(802, 600), clock.Advance(FrameInterval)));
+    Assert::IsTrue(UpdateResult::Report == coalescer.Update(WindowSize(803, 600), clock.Advance(1s)));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <AsyncStorage/FollyDynamicConverter.h>
+#include <chrono>
+#include <sstream>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+// Long enough to not fit in the small string buffer, so that a move keeps the
+// same character buffer and a copy allocates a new one.
+std::string MakeString(char c, size_t length = 64) {
+  return std::string(length, c);
+}
+
+folly::dynamic MakeKeysArgs(size_t count, size_t length = 64) {
+  folly::dynamic keys = folly::dynamic::array;
+  for (size_t i = 0; i < count; ++i) {
+    keys.push_back(MakeString(static_cast<char>('a' + i % 26), length));
+  }
+  return folly::dynamic::array(std::move(keys));
+}
+
+folly::dynamic MakeKeyValuesArgs(size_t count, size_t length = 64) {
+  folly::dynamic keyValues = folly::dynamic::array;
+  for (size_t i = 0; i < count; ++i) {
+    keyValues.push_back(folly::dynamic::array(
+        MakeString(static_cast<char>('a' + i % 26), length), MakeString(static_cast<char>('A' + i % 26), length)));
+  }
+  return folly::dynamic::array(std::move(keyValues));
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (FollyDynamicConverterTest) {
+  TEST_METHOD(FollyDynamicConverter_StringVectorRoundTrip) {
+    auto args = MakeKeysArgs(3);
+    auto copied = FollyDynamicConverter::jsArgAsStringVector(args);
+    auto moved = FollyDynamicConverter::jsArgAsStringVector(folly::dynamic(args));
+    Assert::IsTrue(copied == moved);
+    Assert::IsTrue(args[0] == FollyDynamicConverter::stringVectorAsRetVal(copied));
+    Assert::IsTrue(args[0] == FollyDynamicConverter::stringVectorAsRetVal(std::move(moved)));
+  }
+
+  TEST_METHOD(FollyDynamicConverter_TupleStringVectorRoundTrip) {
+    auto args = MakeKeyValuesArgs(3);
+    auto copied = FollyDynamicConverter::jsArgAsTupleStringVector(args);
+    auto moved = FollyDynamicConverter::jsArgAsTupleStringVector(folly::dynamic(args));
+    Assert::IsTrue(copied == moved);
+    Assert::IsTrue(args[0] == FollyDynamicConverter::tupleStringVectorAsRetVal(copied));
+    Assert::IsTrue(args[0] == FollyDynamicConverter::tupleStringVectorAsRetVal(std::move(moved)));
+  }
+
+  TEST_METHOD(FollyDynamicConverter_EmptyArgs) {
+    Assert::IsTrue(FollyDynamicConverter::jsArgAsStringVector(MakeKeysArgs(0)).empty());
+    Assert::IsTrue(FollyDynamicConverter::jsArgAsTupleStringVector(MakeKeyValuesArgs(0)).empty());
+    Assert::IsTrue(folly::dynamic::array() == FollyDynamicConverter::stringVectorAsRetVal(std::vector<string>{}));
+  }
+
+  TEST_METHOD(FollyDynamicConverter_MovesKeysOutOfArgs) {
+    auto args = MakeKeysArgs(2);
+    const char *buffer0 = args[0][0].getString().data();
+    const char *buffer1 = args[0][1].getString().data();
+
+    auto keys = FollyDynamicConverter::jsArgAsStringVector(std::move(args));
+    Assert::IsTrue(buffer0 == keys[0].data());
+    Assert::IsTrue(buffer1 == keys[1].data());
+
+    auto jsRetVal = FollyDynamicConverter::stringVectorAsRetVal(std::move(keys));
+    Assert::IsTrue(buffer0 == jsRetVal[0].getString().data());
+    Assert::IsTrue(buffer1 == jsRetVal[1].getString().data());
+  }
+
+  TEST_METHOD(FollyDynamicConverter_MovesKeyValuesOutOfArgs) {
+    auto args = MakeKeyValuesArgs(1);
+    const char *keyBuffer = args[0][0][0].getString().data();
+    const char *valueBuffer = args[0][0][1].getString().data();
+
+    auto keyValues = FollyDynamicConverter::jsArgAsTupleStringVector(std::move(args));
+    Assert::IsTrue(keyBuffer == std::get<0>(keyValues[0]).data());
+    Assert::IsTrue(valueBuffer == std::get<1>(keyValues[0]).data());
+
+    auto jsRetVal = FollyDynamicConverter::tupleStringVectorAsRetVal(std::move(keyValues));
+    Assert::IsTrue(keyBuffer == jsRetVal[0][0].getString().data());
+    Assert::IsTrue(valueBuffer == jsRetVal[0][1].getString().data());
+  }
+
+  TEST_METHOD(FollyDynamicConverter_CopiesFromConstArgs) {
+    const auto args = MakeKeysArgs(1);
+    auto keys = FollyDynamicConverter::jsArgAsStringVector(args);
+    Assert::IsFalse(args[0][0].getString().data() == keys[0].data());
+    Assert::IsTrue(args[0][0].getString() == keys[0]);
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(FollyDynamicConverter_MultiSetThroughput) {
+    // 64 values of 64KB each, as produced by a large AsyncStorage.multiSet.
+    constexpr size_t pairCount = 64;
+    constexpr size_t valueLength = 64 * 1024;
+    constexpr int iterations = 100;
+    using clock = std::chrono::steady_clock;
+
+    const auto args = MakeKeyValuesArgs(pairCount, valueLength);
+    auto measure = [&](const char *name, auto &&convert) {
+      clock::duration elapsed{};
+      for (int i = 0; i < iterations; ++i) {
+        folly::dynamic argsCopy = args;
+        auto start = clock::now();
+        auto jsRetVal = convert(std::move(argsCopy));
+        elapsed += clock::now() - start;
+        Assert::AreEqual(pairCount, jsRetVal.size());
+      }
+
+      auto seconds = std::chrono::duration<double>(elapsed).count();
+      auto megabytes = 2.0 * pairCount * valueLength * iterations / (1024 * 1024);
+      std::ostringstream result;
+      result << name << ": " << megabytes / seconds << " MB/s";
+      Logger::WriteMessage(result.str().c_str());
+    };
+
+    measure("Copy", [](folly::dynamic &&jsArgs) {
+      const folly::dynamic &constArgs = jsArgs;
+      auto keyValues = FollyDynamicConverter::jsArgAsTupleStringVector(constArgs);
+      const auto &constKeyValues = keyValues;
+      return FollyDynamicConverter::tupleStringVectorAsRetVal(constKeyValues);
+    });
+
+    measure("Move", [](folly::dynamic &&jsArgs) {
+      auto keyValues = FollyDynamicConverter::jsArgAsTupleStringVector(std::move(jsArgs));
+      return FollyDynamicConverter::tupleStringVectorAsRetVal(std::move(keyValues));
+    });
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
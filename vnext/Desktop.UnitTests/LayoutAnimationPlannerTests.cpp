@@ -0,0 +1,311 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <LayoutAnimationPlanner.h>
+#include <algorithm>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+constexpr int64_t c_rootTag = 1;
+
+using AnimationType = LayoutAnimation::AnimationType;
+using AnimatableProperty = LayoutAnimation::AnimatableProperty;
+
+LayoutAnimation::LayoutAnimationProperties MakeProps(
+    AnimationType animationType,
+    AnimatableProperty animatedProp = AnimatableProperty::Opacity,
+    float duration = 300.0f) {
+  LayoutAnimation::LayoutAnimationProperties props;
+  props.duration = duration;
+  props.animationType = animationType;
+  props.animatedProp = animatedProp;
+  props.springAnimationProperties = {0.4f, 0.0f};
+  return props;
+}
+
+LayoutAnimation::LayoutAnimations MakeAnimations(
+    AnimationType animationType,
+    AnimatableProperty animatedProp = AnimatableProperty::Opacity) {
+  return {
+      MakeProps(animationType, animatedProp),
+      MakeProps(animationType, animatedProp),
+      MakeProps(animationType, animatedProp),
+  };
+}
+
+const LayoutTransitionChannel *FindChannel(const LayoutTransition &transition, LayoutTransitionProperty property) {
+  auto it = std::find_if(
+      transition.channels.begin(), transition.channels.end(), [property](const LayoutTransitionChannel &c) noexcept {
+        return c.property == property;
+      });
+  return it != transition.channels.end() ? &*it : nullptr;
+}
+
+// Lays out a node and plans once without animations, so that the next pass
+// starts from a known frame.
+void AddLaidOutNode(LayoutAnimationPlanner &planner, int64_t tag, const LayoutFrame &frame) {
+  planner.UpdateNodeLayout(tag, c_rootTag, frame);
+  planner.DiscardChanges();
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (LayoutAnimationPlannerTests) {
+  TEST_METHOD(CreatedNodeFadesIn) {
+    LayoutAnimationPlanner planner;
+    planner.UpdateNodeLayout(2, c_rootTag, {10, 20, 100, 50});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::EaseInEaseOut));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::IsTrue(transitions[0].change == LayoutChange::Created);
+    Assert::IsTrue(transitions[0].frame == LayoutFrame{10, 20, 100, 50});
+    Assert::AreEqual(300.0f, transitions[0].duration);
+    Assert::AreEqual(size_t{1}, transitions[0].channels.size());
+
+    auto opacity = FindChannel(transitions[0], LayoutTransitionProperty::Opacity);
+    Assert::IsNotNull(opacity);
+    Assert::AreEqual(0.0f, opacity->from);
+    Assert::AreEqual(1.0f, opacity->to);
+    Assert::IsFalse(planner.HasChanges());
+  }
+
+  TEST_METHOD(CreatedNodeScales) {
+    LayoutAnimationPlanner planner;
+    planner.UpdateNodeLayout(2, c_rootTag, {0, 0, 100, 50});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear, AnimatableProperty::ScaleXY));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::AreEqual(size_t{2}, transitions[0].channels.size());
+    Assert::IsNotNull(FindChannel(transitions[0], LayoutTransitionProperty::ScaleX));
+    Assert::IsNotNull(FindChannel(transitions[0], LayoutTransitionProperty::ScaleY));
+  }
+
+  TEST_METHOD(OnlyRootOfCreatedSubtreeIsAnimated) {
+    LayoutAnimationPlanner planner;
+    planner.UpdateNodeLayout(2, c_rootTag, {0, 0, 100, 100});
+    planner.UpdateNodeLayout(3, 2, {10, 10, 20, 20});
+    planner.UpdateNodeLayout(4, 3, {1, 1, 5, 5});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::AreEqual(int64_t{2}, transitions[0].tag);
+  }
+
+  TEST_METHOD(UpdatedNodeAnimatesChangedFrameValues) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {10, 20, 100, 50});
+    planner.UpdateNodeLayout(2, c_rootTag, {30, 20, 100, 80});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::EaseOut));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::IsTrue(transitions[0].change == LayoutChange::Updated);
+    Assert::AreEqual(size_t{2}, transitions[0].channels.size());
+
+    auto left = FindChannel(transitions[0], LayoutTransitionProperty::Left);
+    Assert::IsNotNull(left);
+    Assert::AreEqual(10.0f, left->from);
+    Assert::AreEqual(30.0f, left->to);
+
+    auto height = FindChannel(transitions[0], LayoutTransitionProperty::Height);
+    Assert::IsNotNull(height);
+    Assert::AreEqual(50.0f, height->from);
+    Assert::AreEqual(80.0f, height->to);
+  }
+
+  TEST_METHOD(UnchangedNodeIsNotAnimated) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {10, 20, 100, 50});
+    planner.UpdateNodeLayout(2, c_rootTag, {10, 20, 100, 50});
+
+    Assert::IsFalse(planner.HasChanges());
+    Assert::IsTrue(planner.PlanTransitions(MakeAnimations(AnimationType::Linear)).empty());
+  }
+
+  TEST_METHOD(ConsecutivePassesAreCoalesced) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {8, 0, 10, 10});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    auto left = FindChannel(transitions[0], LayoutTransitionProperty::Left);
+    Assert::IsNotNull(left);
+    Assert::AreEqual(0.0f, left->from);
+    Assert::AreEqual(8.0f, left->to);
+  }
+
+  TEST_METHOD(UpdateBackToOriginalFrameIsNotAnimated) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {0, 0, 10, 10});
+
+    Assert::IsTrue(planner.PlanTransitions(MakeAnimations(AnimationType::Linear)).empty());
+  }
+
+  TEST_METHOD(DeletedNodeFadesOut) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {10, 20, 100, 50});
+
+    Assert::IsTrue(planner.DeleteNode(2));
+    // Dropping the view after it is handed to the animation does not cancel it.
+    planner.RemoveNode(2);
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::EaseIn));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::IsTrue(transitions[0].change == LayoutChange::Deleted);
+    Assert::IsTrue(transitions[0].frame == LayoutFrame{10, 20, 100, 50});
+
+    auto opacity = FindChannel(transitions[0], LayoutTransitionProperty::Opacity);
+    Assert::IsNotNull(opacity);
+    Assert::AreEqual(1.0f, opacity->from);
+    Assert::AreEqual(0.0f, opacity->to);
+  }
+
+  TEST_METHOD(DeletedNodeWithoutLayoutIsNotAnimated) {
+    LayoutAnimationPlanner planner;
+    Assert::IsFalse(planner.DeleteNode(2));
+
+    planner.UpdateNodeLayout(3, c_rootTag, {0, 0, 10, 10});
+    Assert::IsFalse(planner.DeleteNode(3));
+    Assert::IsTrue(planner.PlanTransitions(MakeAnimations(AnimationType::Linear)).empty());
+  }
+
+  TEST_METHOD(RemovedNodeIsForgotten) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    planner.RemoveNode(2);
+
+    Assert::IsFalse(planner.HasChanges());
+
+    // A node with the same tag is created again.
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::IsTrue(transitions[0].change == LayoutChange::Created);
+  }
+
+  TEST_METHOD(NoneAnimationTypeSkipsChange) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    AddLaidOutNode(planner, 3, {0, 10, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    planner.UpdateNodeLayout(4, c_rootTag, {0, 20, 10, 10});
+    planner.DeleteNode(3);
+
+    auto animations = MakeAnimations(AnimationType::Linear);
+    animations.updateAnimationProps.animationType = AnimationType::None;
+    animations.deleteAnimationProps.animationType = AnimationType::None;
+
+    auto transitions = planner.PlanTransitions(animations);
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::AreEqual(int64_t{4}, transitions[0].tag);
+    Assert::IsFalse(planner.HasChanges());
+  }
+
+  TEST_METHOD(DiscardChangesKeepsFrames) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+    planner.DiscardChanges();
+    planner.UpdateNodeLayout(2, c_rootTag, {7, 0, 10, 10});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::AreEqual(5.0f, FindChannel(transitions[0], LayoutTransitionProperty::Left)->from);
+  }
+
+  TEST_METHOD(AddedFrameIsOriginOfUpdate) {
+    LayoutAnimationPlanner planner;
+    planner.AddNodeFrame(2, {0, 0, 10, 10});
+    planner.AddNodeFrame(2, {3, 0, 10, 10}); // Ignored, the node already has a frame.
+    Assert::IsFalse(planner.HasChanges());
+    planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Linear));
+    Assert::AreEqual(size_t{1}, transitions.size());
+    Assert::IsTrue(LayoutChange::Updated == transitions[0].change);
+    Assert::AreEqual(0.0f, FindChannel(transitions[0], LayoutTransitionProperty::Left)->from);
+  }
+
+  TEST_METHOD(ClearForgetsFrames) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(3, c_rootTag, {0, 0, 10, 10});
+    planner.Clear();
+    Assert::IsFalse(planner.HasChanges());
+    Assert::IsFalse(planner.DeleteNode(2));
+  }
+
+  TEST_METHOD(BezierTimingPerAnimationType) {
+    struct Expected {
+      AnimationType type;
+      std::array<float, 4> controlPoints;
+    };
+
+    for (const auto &expected : {
+             Expected{AnimationType::Linear, {0.0f, 0.0f, 1.0f, 1.0f}},
+             Expected{AnimationType::EaseIn, {0.42f, 0.0f, 1.0f, 1.0f}},
+             Expected{AnimationType::EaseOut, {0.0f, 0.0f, 0.58f, 1.0f}},
+             Expected{AnimationType::EaseInEaseOut, {0.42f, 0.0f, 0.58f, 1.0f}},
+             Expected{AnimationType::Keyboard, {0.17f, 0.59f, 0.4f, 0.77f}},
+         }) {
+      LayoutAnimationPlanner planner;
+      AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+      planner.UpdateNodeLayout(2, c_rootTag, {5, 0, 10, 10});
+
+      auto transitions = planner.PlanTransitions(MakeAnimations(expected.type));
+      Assert::AreEqual(size_t{1}, transitions.size());
+      Assert::IsTrue(transitions[0].animationType == expected.type);
+      Assert::IsTrue(transitions[0].timing.kind == LayoutTransitionTiming::Kind::CubicBezier);
+      Assert::IsTrue(transitions[0].timing.controlPoints == expected.controlPoints);
+      Assert::IsTrue(transitions[0].timing.keyFrames.empty());
+    }
+  }
+
+  TEST_METHOD(SpringTimingIsSampledIntoKeyFrames) {
+    LayoutAnimationPlanner planner;
+    AddLaidOutNode(planner, 2, {0, 0, 10, 10});
+    planner.UpdateNodeLayout(2, c_rootTag, {100, 0, 10, 10});
+
+    auto transitions = planner.PlanTransitions(MakeAnimations(AnimationType::Spring));
+    Assert::AreEqual(size_t{1}, transitions.size());
+
+    const auto &timing = transitions[0].timing;
+    Assert::IsTrue(timing.kind == LayoutTransitionTiming::Kind::KeyFrames);
+    Assert::IsFalse(timing.keyFrames.empty());
+    Assert::AreEqual(1.0f, timing.keyFrames.back().time);
+    Assert::AreEqual(1.0f, timing.keyFrames.back().progress);
+
+    float previousTime = 0.0f;
+    float maxProgress = 0.0f;
+    for (const auto &keyFrame : timing.keyFrames) {
+      Assert::IsTrue(keyFrame.time > previousTime);
+      previousTime = keyFrame.time;
+      maxProgress = std::max(maxProgress, keyFrame.progress);
+    }
+
+    // An underdamped spring overshoots its target.
+    Assert::IsTrue(maxProgress > 1.0f);
+  }
+
+  TEST_METHOD(CriticallyDampedSpringDoesNotOvershoot) {
+    auto props = MakeProps(AnimationType::Spring);
+    props.springAnimationProperties.springDamping = 1.0f;
+
+    auto timing = LayoutAnimationPlanner::TimingFor(props);
+    for (const auto &keyFrame : timing.keyFrames) {
+      Assert::IsTrue(keyFrame.progress <= 1.0f);
+    }
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <SoftExceptionLimiter.h>
+#include <chrono>
+#include <string>
+
+using facebook::react::ErrorFingerprint;
+using facebook::react::SoftExceptionLimiter;
+using facebook::react::SoftExceptionLimits;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using Action = SoftExceptionLimiter::Action;
+
+constexpr SoftExceptionLimiter::Clock::time_point Start{};
+
+SoftExceptionLimits TestLimits() {
+  SoftExceptionLimits limits;
+  limits.Window = 1000ms;
+  limits.MaxReportsPerError = 1;
+  limits.MaxReports = 3;
+  limits.MaxTrackedErrors = 4;
+  return limits;
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (SoftExceptionLimiterTests) {
+  TEST_METHOD(ErrorFingerprint_NormalizesFrames) {
+    ErrorFingerprint fromServer{"message", 2};
+    Assert::IsTrue(fromServer.AddFrame("http://localhost:8081/index.bundle?platform=windows&dev=true", "f", 10, 5));
+    Assert::IsTrue(fromServer.AddFrame("http://localhost:8081/index.bundle?platform=windows&dev=true", "g", 20, 7));
+    Assert::IsFalse(fromServer.AddFrame("http://localhost:8081/index.bundle", "h", 30, 1));
+
+    ErrorFingerprint fromFile{"message", 2};
+    fromFile.AddFrame("C:\\app\\index.bundle", "f", 10, 5);
+    fromFile.AddFrame("C:\\app\\index.bundle", "g", 20, 7);
+    fromFile.AddFrame("C:\\app\\index.bundle", "other", 1, 1);
+
+    Assert::AreEqual(fromServer.Value(), fromFile.Value());
+  }
+
+  TEST_METHOD(ErrorFingerprint_DiffersByMessageAndFrames) {
+    ErrorFingerprint first{"message", 5};
+    first.AddFrame("index.bundle", "f", 10, 5);
+
+    ErrorFingerprint otherMessage{"other message", 5};
+    otherMessage.AddFrame("index.bundle", "f", 10, 5);
+
+    ErrorFingerprint otherLine{"message", 5};
+    otherLine.AddFrame("index.bundle", "f", 11, 5);
+
+    Assert::AreNotEqual(first.Value(), otherMessage.Value());
+    Assert::AreNotEqual(first.Value(), otherLine.Value());
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_ForwardsFirstReportAndSummarizesRepeats) {
+    SoftExceptionLimiter limiter{TestLimits()};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 100ms) == Action::StartSummary);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 200ms) == Action::Count);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 300ms) == Action::Count);
+
+    Assert::IsTrue(limiter.HasPendingSummary());
+    Assert::IsTrue(limiter.NextSummaryTime() == Start + 1100ms);
+    Assert::IsTrue(limiter.TakeDueSummaries(Start + 1099ms).empty());
+
+    auto summaries = limiter.TakeDueSummaries(Start + 1100ms);
+    Assert::AreEqual(size_t{1}, summaries.size());
+    Assert::AreEqual(std::string{"a"}, summaries[0].Fingerprint);
+    Assert::AreEqual(uint32_t{3}, summaries[0].Count);
+    Assert::IsTrue(summaries[0].FirstReportTime == Start + 100ms);
+    Assert::IsTrue(summaries[0].LastReportTime == Start + 300ms);
+    Assert::IsFalse(limiter.HasPendingSummary());
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_ForwardsAgainAfterWindow) {
+    SoftExceptionLimiter limiter{TestLimits()};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 999ms) == Action::StartSummary);
+    limiter.TakeDueSummaries(Start + 2000ms);
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 2000ms) == Action::Forward);
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_CountsUntilSummaryIsTaken) {
+    SoftExceptionLimiter limiter{TestLimits()};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 500ms) == Action::StartSummary);
+
+    // The forwarded report left the window, but the summary is still open.
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 1200ms) == Action::Count);
+
+    auto summaries = limiter.TakeDueSummaries(Start + 1500ms);
+    Assert::AreEqual(size_t{1}, summaries.size());
+    Assert::AreEqual(uint32_t{2}, summaries[0].Count);
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_NeverSuppressesFatalErrors) {
+    SoftExceptionLimiter limiter{TestLimits()};
+
+    for (int i = 0; i < 10; ++i) {
+      Assert::IsTrue(limiter.OnReport("a", true, Start) == Action::Forward);
+    }
+
+    Assert::IsFalse(limiter.HasPendingSummary());
+    Assert::AreEqual(size_t{0}, limiter.TrackedErrorCount());
+
+    // Fatal errors do not use up the limits of soft ones.
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_AppliesGlobalLimit) {
+    SoftExceptionLimiter limiter{TestLimits()};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("b", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("c", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("d", false, Start) == Action::StartSummary);
+
+    Assert::IsTrue(limiter.OnReport("e", false, Start + 1000ms) == Action::Forward);
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_AppliesLimitPerError) {
+    auto limits = TestLimits();
+    limits.MaxReportsPerError = 2;
+    SoftExceptionLimiter limiter{limits};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 10ms) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("a", false, Start + 20ms) == Action::StartSummary);
+    Assert::IsTrue(limiter.OnReport("b", false, Start + 30ms) == Action::Forward);
+  }
+
+  TEST_METHOD(SoftExceptionLimiter_CountsUntrackedErrorsTogether) {
+    auto limits = TestLimits();
+    limits.MaxReports = 100;
+    limits.MaxTrackedErrors = 2;
+    SoftExceptionLimiter limiter{limits};
+
+    Assert::IsTrue(limiter.OnReport("a", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("b", false, Start) == Action::Forward);
+    Assert::IsTrue(limiter.OnReport("c", false, Start) == Action::StartSummary);
+    Assert::IsTrue(limiter.OnReport("d", false, Start + 10ms) == Action::Count);
+    Assert::AreEqual(size_t{2}, limiter.TrackedErrorCount());
+    Assert::IsTrue(limiter.IsTracked("a"));
+    Assert::IsFalse(limiter.IsTracked("c"));
+
+    auto summaries = limiter.TakeDueSummaries(Start + 1010ms);
+    Assert::AreEqual(size_t{1}, summaries.size());
+    Assert::IsTrue(summaries[0].Fingerprint.empty());
+    Assert::AreEqual(uint32_t{2}, summaries[0].Count);
+
+    // Idle errors are forgotten, which makes room for new ones.
+    Assert::AreEqual(size_t{0}, limiter.TrackedErrorCount());
+    Assert::IsTrue(limiter.OnReport("c", false, Start + 1010ms) == Action::Forward);
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,272 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <TextInputReconciler.h>
+#include <random>
+#include <string>
+
+#ifdef PERF_TESTS
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <chrono>
+#include <sstream>
+#include "Unicode.h"
+#endif // PERF_TESTS
+
+using namespace facebook::react;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+
+namespace {
+
+bool IsHighSurrogate(wchar_t ch) {
+  return ch >= 0xD800 && ch <= 0xDBFF;
+}
+
+bool IsLowSurrogate(wchar_t ch) {
+  return ch >= 0xDC00 && ch <= 0xDFFF;
+}
+
+// Random text made of a small alphabet, so that edits often produce texts with
+// long common prefixes and suffixes, mixed with surrogate pairs.
+std::wstring RandomText(std::mt19937 &random, size_t maxLength) {
+  static constexpr wchar_t c_alphabet[] = L"ab \n";
+  std::wstring text;
+  size_t length = std::uniform_int_distribution<size_t>{0, maxLength}(random);
+  while (text.size() < length) {
+    switch (random() % 6) {
+      case 0:
+        // U+1F600 and U+1F601 share their high surrogate.
+        text += static_cast<wchar_t>(0xD83D);
+        text += static_cast<wchar_t>(random() % 2 ? 0xDE00 : 0xDE01);
+        break;
+      default:
+        text += c_alphabet[random() % 4];
+        break;
+    }
+  }
+  return text;
+}
+
+// Returns an offset of text that does not split a surrogate pair.
+size_t RandomOffset(std::mt19937 &random, const std::wstring &text) {
+  size_t offset = std::uniform_int_distribution<size_t>{0, text.size()}(random);
+  if (offset > 0 && offset < text.size() && IsLowSurrogate(text[offset])) {
+    --offset;
+  }
+  return offset;
+}
+
+// Applies a random insertion, deletion or replacement to text, like a user
+// typing, deleting a selection or pasting over it.
+void RandomEdit(std::mt19937 &random, std::wstring &text) {
+  size_t start = RandomOffset(random, text);
+  size_t end = RandomOffset(random, text);
+  if (start > end) {
+    std::swap(start, end);
+  }
+  if (random() % 2) {
+    end = start;
+  }
+  text.replace(start, end - start, RandomText(random, 3));
+}
+
+void AssertKeepsSurrogatePairs(const std::wstring &oldText, const TextInputEdit &edit) {
+  Assert::IsFalse(edit.start < oldText.size() && IsLowSurrogate(oldText[edit.start]));
+  Assert::IsFalse(edit.end < oldText.size() && IsLowSurrogate(oldText[edit.end]));
+  Assert::IsFalse(!edit.text.empty() && IsLowSurrogate(edit.text.front()));
+  Assert::IsFalse(!edit.text.empty() && IsHighSurrogate(edit.text.back()));
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (TextInputReconcilerTests) {
+  TEST_METHOD(DiffText_Insert) {
+    auto edit = DiffText(L"Hello world", L"Hello, world");
+    Assert::AreEqual(size_t{5}, edit.start);
+    Assert::AreEqual(size_t{5}, edit.end);
+    Assert::IsTrue(edit.text == L",");
+  }
+
+  TEST_METHOD(DiffText_Delete) {
+    auto edit = DiffText(L"Hello, world", L"Hello world");
+    Assert::AreEqual(size_t{5}, edit.start);
+    Assert::AreEqual(size_t{6}, edit.end);
+    Assert::IsTrue(edit.text.empty());
+  }
+
+  TEST_METHOD(DiffText_Replace) {
+    auto edit = DiffText(L"Hello world", L"Hello there");
+    Assert::AreEqual(size_t{6}, edit.start);
+    Assert::AreEqual(size_t{11}, edit.end);
+    Assert::IsTrue(edit.text == L"there");
+  }
+
+  TEST_METHOD(DiffText_SameText) {
+    auto edit = DiffText(L"abc", L"abc");
+    Assert::AreEqual(edit.start, edit.end);
+    Assert::IsTrue(edit.text.empty());
+  }
+
+  TEST_METHOD(DiffText_RepeatedCharacter) {
+    // Typing at the end of a run of identical characters is ambiguous. The
+    // edit is placed after the common prefix.
+    auto edit = DiffText(L"aa", L"aaa");
+    Assert::AreEqual(size_t{2}, edit.start);
+    Assert::AreEqual(size_t{2}, edit.end);
+    Assert::IsTrue(edit.text == L"a");
+  }
+
+  TEST_METHOD(DiffText_KeepsSurrogatePairs) {
+    // U+1F600 replaced by U+1F601: the texts only differ in the low surrogate.
+    const std::wstring oldText{L'a', wchar_t(0xD83D), wchar_t(0xDE00), L'b'};
+    const std::wstring newText{L'a', wchar_t(0xD83D), wchar_t(0xDE01), L'b'};
+    auto edit = DiffText(oldText, newText);
+    Assert::AreEqual(size_t{1}, edit.start);
+    Assert::AreEqual(size_t{3}, edit.end);
+    Assert::IsTrue(edit.text == newText.substr(1, 2));
+
+    // U+1F600 inserted before U+1F600: the common suffix starts with a low
+    // surrogate.
+    const std::wstring repeatedText{wchar_t(0xD83D), wchar_t(0xDE00), wchar_t(0xD83D), wchar_t(0xDE00)};
+    edit = DiffText(repeatedText.substr(2), repeatedText);
+    AssertKeepsSurrogatePairs(repeatedText.substr(2), edit);
+    std::wstring text = repeatedText.substr(2);
+    ApplyTextInputEdit(text, edit);
+    Assert::IsTrue(text == repeatedText);
+  }
+
+  TEST_METHOD(TextInputReconciler_NoBaselineUntilReset) {
+    TextInputReconciler reconciler;
+    Assert::IsFalse(reconciler.HasBaseline());
+
+    reconciler.Reset(L"abc");
+    Assert::IsTrue(reconciler.HasBaseline());
+    Assert::IsTrue(reconciler.Text() == L"abc");
+
+    reconciler.Clear();
+    Assert::IsFalse(reconciler.HasBaseline());
+    Assert::IsTrue(reconciler.Text().empty());
+  }
+
+  TEST_METHOD(TextInputReconciler_MergesEditsBetweenReports) {
+    TextInputReconciler reconciler;
+    reconciler.Reset(L"abc");
+
+    // "d", "e" and "f" are typed before the first change is reported.
+    auto edit = reconciler.TakeEdit(L"abcdef");
+    Assert::AreEqual(size_t{3}, edit.start);
+    Assert::AreEqual(size_t{3}, edit.end);
+    Assert::IsTrue(edit.text == L"def");
+    Assert::IsTrue(reconciler.Text() == L"abcdef");
+
+    // Nothing changed since the last report.
+    edit = reconciler.TakeEdit(L"abcdef");
+    Assert::AreEqual(edit.start, edit.end);
+    Assert::IsTrue(edit.text.empty());
+  }
+
+  TEST_METHOD(TextInputReconciler_RandomEditScripts) {
+    std::mt19937 random{42};
+
+    for (int script = 0; script < 200; ++script) {
+      TextInputReconciler reconciler;
+      std::wstring nativeText = RandomText(random, 64);
+      std::wstring jsText = nativeText;
+      reconciler.Reset(nativeText);
+
+      for (int step = 0; step < 100; ++step) {
+        RandomEdit(random, nativeText);
+
+        // Some changes are merged with the next ones.
+        if (random() % 3 == 0) {
+          continue;
+        }
+
+        auto edit = reconciler.TakeEdit(nativeText);
+        AssertKeepsSurrogatePairs(jsText, edit);
+        Assert::IsTrue(edit.start <= edit.end && edit.end <= jsText.size());
+
+        ApplyTextInputEdit(jsText, edit);
+        Assert::IsTrue(jsText == nativeText);
+        Assert::IsTrue(reconciler.Text() == nativeText);
+      }
+    }
+  }
+
+  TEST_METHOD(DiffText_RandomEditsAreMinimal) {
+    std::mt19937 random{7};
+
+    for (int i = 0; i < 10000; ++i) {
+      const std::wstring oldText = RandomText(random, 64);
+      size_t start = RandomOffset(random, oldText);
+      size_t end = RandomOffset(random, oldText);
+      if (start > end) {
+        std::swap(start, end);
+      }
+      const std::wstring inserted = RandomText(random, 8);
+      std::wstring newText = oldText;
+      newText.replace(start, end - start, inserted);
+
+      // The edit never touches more text than the edit that was made.
+      auto edit = DiffText(oldText, newText);
+      AssertKeepsSurrogatePairs(oldText, edit);
+      Assert::IsTrue(edit.end - edit.start <= end - start);
+      Assert::IsTrue(edit.text.size() <= inserted.size());
+
+      std::wstring text = oldText;
+      ApplyTextInputEdit(text, edit);
+      Assert::IsTrue(text == newText);
+    }
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(TextInputReconciler_KeystrokeCost) {
+    using clock = std::chrono::steady_clock;
+    using Microsoft::Common::Unicode::Utf16ToUtf8;
+    constexpr int keystrokeCount = 1000;
+
+    for (size_t documentSize : {1000, 10000, 100000, 1000000}) {
+      std::wstring text(documentSize, L'a');
+      const size_t caret = documentSize / 2;
+
+      // Event payload of a full text change.
+      auto fullStart = clock::now();
+      for (int i = 0; i < keystrokeCount; ++i) {
+        text.insert(caret, 1, L'b');
+        folly::dynamic eventData = folly::dynamic::object("target", 1)("text", Utf16ToUtf8(text))("eventCount", i);
+        folly::toJson(eventData);
+      }
+      auto fullElapsed = clock::now() - fullStart;
+
+      // Event payload of a text change reported as an edit.
+      TextInputReconciler reconciler;
+      reconciler.Reset(text);
+      auto deltaStart = clock::now();
+      for (int i = 0; i < keystrokeCount; ++i) {
+        text.insert(caret, 1, L'b');
+        auto edit = reconciler.TakeEdit(text);
+        folly::dynamic eventData = folly::dynamic::object("target", 1)("text", Utf16ToUtf8(edit.text))(
+            "range", folly::dynamic::object("start", static_cast<int64_t>(edit.start))(
+                "end", static_cast<int64_t>(edit.end)))("eventCount", i);
+        folly::toJson(eventData);
+      }
+      auto deltaElapsed = clock::now() - deltaStart;
+
+      auto perKeystroke = [](clock::duration elapsed) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / keystrokeCount;
+      };
+
+      std::ostringstream result;
+      result << "TextInput change event for " << documentSize << " characters (ns per keystroke): full text "
+             << perKeystroke(fullElapsed) << ", edit " << perKeystroke(deltaElapsed);
+      Logger::WriteMessage(result.str().c_str());
+    }
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
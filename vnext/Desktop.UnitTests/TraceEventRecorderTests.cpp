@@ -0,0 +1,286 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <TraceEventRecorder.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using facebook::react::TraceEvent;
+using facebook::react::TraceEventBatch;
+using facebook::react::TraceEventBuffer;
+using facebook::react::TraceEventKind;
+using facebook::react::TraceEventRecorder;
+using facebook::react::TraceNameTable;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+
+namespace {
+
+// Describes the events as "<kind>:<name>:<value>:<args>" strings to compare them easily.
+std::vector<std::string> FlushToStrings(TraceEventRecorder &recorder) {
+  std::vector<std::string> result;
+  recorder.Flush([&](const TraceEventBatch &events) {
+    for (auto const &event : events) {
+      std::ostringstream text;
+      text << static_cast<int>(event.Kind) << ':' << recorder.Name(event.NameId) << ':' << event.Value << ':'
+           << event.Args;
+      result.push_back(text.str());
+    }
+  });
+  return result;
+}
+
+std::string EventString(TraceEventKind kind, const char *name, int64_t value, const char *args) {
+  std::ostringstream text;
+  text << static_cast<int>(kind) << ':' << name << ':' << value << ':' << args;
+  return text.str();
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (TraceEventRecorderTests) {
+  TEST_METHOD(TraceNameTable_InternsNames) {
+    TraceNameTable names;
+    uint32_t a = names.Intern("a");
+    uint32_t b = names.Intern("b");
+    Assert::AreEqual(0u, a);
+    Assert::AreEqual(1u, b);
+    Assert::AreEqual(a, names.Intern(std::string{"a"}));
+    Assert::AreEqual(size_t{2}, names.Size());
+    Assert::AreEqual(std::string{"b"}, names.Name(b));
+  }
+
+  TEST_METHOD(TraceEventBuffer_KeepsOrderAndRejectsWhenFull) {
+    TraceEventBuffer buffer{3}; // Rounded up to 4.
+    for (int i = 0; i < 4; ++i) {
+      Assert::IsTrue(buffer.TryPush(TraceEventKind::JSCounter, 0, i, nullptr, {}));
+    }
+    Assert::IsFalse(buffer.TryPush(TraceEventKind::JSCounter, 0, 4, nullptr, {}));
+
+    std::vector<TraceEvent> events;
+    Assert::AreEqual(size_t{4}, buffer.Drain(events, 0));
+    for (int i = 0; i < 4; ++i) {
+      Assert::AreEqual(int64_t{i}, events[i].Value);
+    }
+
+    // The slots can be reused after they are drained.
+    Assert::IsTrue(buffer.TryPush(TraceEventKind::JSCounter, 0, 5, "args", {}));
+    Assert::AreEqual(size_t{5}, buffer.Drain(events, 4));
+    Assert::AreEqual(std::string{"args"}, events[4].Args);
+  }
+
+  TEST_METHOD(TraceEventBuffer_DrainKeepsArgsBuffers) {
+    TraceEventBuffer buffer{1};
+    const std::string longArgs(256, 'a');
+    Assert::IsTrue(buffer.TryPush(TraceEventKind::NativeBeginSection, 0, 0, longArgs.c_str(), {}));
+
+    std::vector<TraceEvent> events;
+    Assert::AreEqual(size_t{1}, buffer.Drain(events, 0));
+    const char *drainedArgs = events[0].Args.data();
+
+    // The drained event is overwritten in place by the next drain, so its string is not allocated again.
+    const std::string otherArgs(200, 'b');
+    Assert::IsTrue(buffer.TryPush(TraceEventKind::NativeBeginSection, 0, 0, otherArgs.c_str(), {}));
+    Assert::AreEqual(size_t{1}, buffer.Drain(events, 0));
+    Assert::AreEqual(otherArgs, events[0].Args);
+    Assert::IsTrue(drainedArgs == events[0].Args.data());
+  }
+
+  TEST_METHOD(TraceEventRecorder_FlushKeepsArgsBuffers) {
+    TraceEventRecorder recorder;
+    const std::string longArgs(256, 'a');
+    const char *flushedArgs = nullptr;
+    recorder.NativeBeginSection("section", longArgs.c_str());
+    recorder.Flush([&](const TraceEventBatch &events) { flushedArgs = events[0].Args.data(); });
+
+    const std::string otherArgs(200, 'b');
+    recorder.NativeBeginSection("section", otherArgs.c_str());
+    recorder.Flush([&](const TraceEventBatch &events) {
+      Assert::AreEqual(otherArgs, events[0].Args);
+      Assert::IsTrue(flushedArgs == events[0].Args.data());
+    });
+  }
+
+  TEST_METHOD(TraceEventRecorder_RecordsAllEventKinds) {
+    TraceEventRecorder recorder;
+    recorder.JSBeginSection("js", "jsArgs");
+    recorder.JSEndSection();
+    recorder.JSBeginAsyncSection("async", 7);
+    recorder.JSEndAsyncSection("async", 7);
+    recorder.JSCounter("counter", 42);
+    recorder.NativeBeginSection("native", "nativeArgs");
+    recorder.NativeEndSection("native", "nativeArgs", std::chrono::nanoseconds{100});
+
+    std::vector<std::string> expected{
+        EventString(TraceEventKind::JSBeginSection, "js", 0, "jsArgs"),
+        EventString(TraceEventKind::JSEndSection, "", 0, ""),
+        EventString(TraceEventKind::JSBeginAsyncSection, "async", 7, ""),
+        EventString(TraceEventKind::JSEndAsyncSection, "async", 7, ""),
+        EventString(TraceEventKind::JSCounter, "counter", 42, ""),
+        EventString(TraceEventKind::NativeBeginSection, "native", 0, "nativeArgs"),
+        EventString(TraceEventKind::NativeEndSection, "native", 100, "nativeArgs"),
+    };
+    Assert::IsTrue(expected == FlushToStrings(recorder));
+    Assert::AreEqual(size_t{0}, recorder.Flush([](auto &) {}));
+  }
+
+  TEST_METHOD(TraceEventRecorder_RecordsTimeAndThreadOfEvents) {
+    using clock = std::chrono::steady_clock;
+    TraceEventRecorder recorder;
+    auto start = clock::now();
+    recorder.JSBeginSection("main", "");
+    std::thread{[&recorder]() { recorder.JSBeginSection("other", ""); }}.join();
+    recorder.JSEndSection();
+    auto end = clock::now();
+
+    std::vector<TraceEvent> events;
+    recorder.Flush([&](const TraceEventBatch &batch) { events.assign(batch.begin(), batch.end()); });
+    Assert::AreEqual(size_t{3}, events.size());
+
+    // The events are grouped by thread when they are flushed, but keep the time and thread they were recorded on.
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent &a, const TraceEvent &b) noexcept {
+      return a.Timestamp < b.Timestamp;
+    });
+    Assert::AreEqual(std::string{"main"}, recorder.Name(events[0].NameId));
+    Assert::AreEqual(std::string{"other"}, recorder.Name(events[1].NameId));
+    Assert::IsTrue(TraceEventKind::JSEndSection == events[2].Kind);
+    Assert::IsTrue(start <= events[0].Timestamp && events[2].Timestamp <= end);
+    Assert::AreEqual(events[0].ThreadId, events[2].ThreadId);
+    Assert::AreNotEqual(events[0].ThreadId, events[1].ThreadId);
+  }
+
+  TEST_METHOD(TraceEventRecorder_InternsNamesOfReusedBuffers) {
+    TraceEventRecorder recorder;
+    char name[16] = "first";
+    recorder.JSCounter(name, 1);
+    recorder.JSCounter(name, 2);
+    std::snprintf(name, sizeof(name), "second");
+    recorder.JSCounter(name, 3);
+
+    std::vector<std::string> expected{
+        EventString(TraceEventKind::JSCounter, "first", 1, ""),
+        EventString(TraceEventKind::JSCounter, "first", 2, ""),
+        EventString(TraceEventKind::JSCounter, "second", 3, ""),
+    };
+    Assert::IsTrue(expected == FlushToStrings(recorder));
+  }
+
+  TEST_METHOD(TraceEventRecorder_CountsDroppedEvents) {
+    TraceEventRecorder recorder{2};
+    for (int i = 0; i < 5; ++i) {
+      recorder.JSCounter("counter", i);
+    }
+
+    Assert::AreEqual(size_t{2}, FlushToStrings(recorder).size());
+    Assert::AreEqual(uint64_t{3}, recorder.DroppedEventCount());
+  }
+
+  TEST_METHOD(TraceEventRecorder_SamplesTopLevelSectionsWithNestedOnes) {
+    TraceEventRecorder recorder;
+    recorder.SetSampleRate(2);
+    for (int i = 0; i < 4; ++i) {
+      recorder.JSBeginSection("outer", "");
+      recorder.JSBeginSection("inner", "");
+      recorder.JSEndSection();
+      recorder.JSEndSection();
+    }
+
+    // The first and the third outer sections are kept with their inner sections, so begins and ends stay balanced.
+    auto events = FlushToStrings(recorder);
+    Assert::AreEqual(size_t{8}, events.size());
+    Assert::AreEqual(EventString(TraceEventKind::JSBeginSection, "outer", 0, ""), events[0]);
+    Assert::AreEqual(EventString(TraceEventKind::JSBeginSection, "inner", 0, ""), events[1]);
+    Assert::AreEqual(EventString(TraceEventKind::JSBeginSection, "outer", 0, ""), events[4]);
+  }
+
+  TEST_METHOD(TraceEventRecorder_SamplesAsyncSectionsByCookie) {
+    TraceEventRecorder recorder;
+    recorder.SetSampleRate(3);
+    for (int cookie = 0; cookie < 6; ++cookie) {
+      recorder.JSBeginAsyncSection("async", cookie);
+      recorder.JSEndAsyncSection("async", cookie);
+    }
+
+    auto events = FlushToStrings(recorder);
+    Assert::AreEqual(size_t{4}, events.size());
+    Assert::AreEqual(EventString(TraceEventKind::JSEndAsyncSection, "async", 3, ""), events[3]);
+  }
+
+  TEST_METHOD(TraceEventRecorder_FlushesFromBackgroundThread) {
+    constexpr int threadCount = 4;
+    constexpr int sectionsPerThread = 1000;
+
+    TraceEventRecorder recorder{2 * sectionsPerThread};
+    std::atomic<size_t> flushedCount{0};
+
+    recorder.StartFlushing(
+        [&](const TraceEventBatch &events) { flushedCount += events.size(); }, std::chrono::milliseconds{1});
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&recorder]() {
+        for (int j = 0; j < sectionsPerThread; ++j) {
+          recorder.NativeBeginSection("section", "args");
+          recorder.NativeEndSection("section", "args", std::chrono::nanoseconds{j});
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    // StopFlushing delivers everything that was recorded before it.
+    recorder.StopFlushing();
+    Assert::AreEqual(size_t{2 * threadCount * sectionsPerThread}, flushedCount.load());
+    Assert::AreEqual(uint64_t{0}, recorder.DroppedEventCount());
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(TraceEventRecorder_RecordingThroughput) {
+    constexpr int threadCount = 4;
+    constexpr int sectionsPerThread = 1000000;
+    using clock = std::chrono::steady_clock;
+
+    TraceEventRecorder recorder;
+    std::atomic<size_t> flushedCount{0};
+    recorder.StartFlushing(
+        [&](const TraceEventBatch &events) { flushedCount += events.size(); }, std::chrono::milliseconds{5});
+
+    auto start = clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&recorder]() {
+        for (int j = 0; j < sectionsPerThread; ++j) {
+          recorder.JSBeginSection("RCTUIManager.createView", "{\"tag\":42}");
+          recorder.JSEndSection();
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    auto seconds = std::chrono::duration<double>(clock::now() - start).count();
+    recorder.StopFlushing();
+
+    std::ostringstream result;
+    result << "TraceEventRecorder: " << static_cast<int64_t>(2 * threadCount * sectionsPerThread / seconds)
+           << " events per second on " << threadCount << " threads, " << flushedCount.load() << " flushed, "
+           << recorder.DroppedEventCount() << " dropped";
+    Logger::WriteMessage(result.str().c_str());
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
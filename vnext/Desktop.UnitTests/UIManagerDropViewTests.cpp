@@ -0,0 +1,390 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <INativeUIManager.h>
+#include <IReactRootView.h>
+#include <IUIManager.h>
+#include <ShadowNode.h>
+#include <ViewManager.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+struct DropCounters {
+  int DropViewInstanceCount{0};
+  int RemoveAllChildrenCount{0};
+  int RemoveChildAtCount{0};
+  int DestroyedCount{0};
+  int RemoveViewsCount{0};
+  bool RemoveChildren{false};
+  std::vector<int64_t> RemovedTags;
+};
+
+class MockShadowNode : public ShadowNode {
+ public:
+  MockShadowNode(DropCounters &counters, bool isWindowed) : m_counters{counters}, m_isWindowed{isWindowed} {}
+
+  ~MockShadowNode() override {
+    ++m_counters.DestroyedCount;
+  }
+
+  void onDropViewInstance() override {
+    ++m_counters.DropViewInstanceCount;
+  }
+
+  void removeAllChildren() override {
+    ++m_counters.RemoveAllChildrenCount;
+  }
+
+  void AddView(ShadowNode & /*child*/, int64_t /*index*/) override {}
+
+  void RemoveChildAt(int64_t /*indexToRemove*/) override {
+    ++m_counters.RemoveChildAtCount;
+  }
+
+  void createView() override {}
+
+  bool IsWindowed() override {
+    return m_isWindowed;
+  }
+
+ private:
+  DropCounters &m_counters;
+  bool m_isWindowed;
+};
+
+class MockViewManager : public IViewManager {
+ public:
+  MockViewManager(const char *name, DropCounters &counters, bool isWindowed = false)
+      : m_name{name}, m_counters{counters}, m_isWindowed{isWindowed} {}
+
+  const char *GetName() const override {
+    return m_name;
+  }
+
+  folly::dynamic GetExportedViewConstants() const override {
+    return folly::dynamic::object();
+  }
+
+  folly::dynamic GetCommands() const override {
+    return folly::dynamic::object();
+  }
+
+  folly::dynamic GetNativeProps() const override {
+    return folly::dynamic::object();
+  }
+
+  ShadowNode *createShadow() const override {
+    return new MockShadowNode(m_counters, m_isWindowed);
+  }
+
+  void destroyShadow(ShadowNode *node) const override {
+    delete node;
+  }
+
+  folly::dynamic GetConstants() const override {
+    return folly::dynamic::object();
+  }
+
+  folly::dynamic GetExportedCustomBubblingEventTypeConstants() const override {
+    return folly::dynamic::object();
+  }
+
+  folly::dynamic GetExportedCustomDirectEventTypeConstants() const override {
+    return folly::dynamic::object();
+  }
+
+ private:
+  const char *m_name;
+  DropCounters &m_counters;
+  bool m_isWindowed;
+};
+
+class MockNativeUIManager : public INativeUIManager {
+ public:
+  MockNativeUIManager(DropCounters &counters) : m_counters{counters} {}
+
+  bool DeferRemove{false};
+
+  void destroy() override {}
+  ShadowNode *createRootShadowNode(IReactRootView * /*rootView*/) override {
+    return new MockShadowNode(m_counters, false);
+  }
+  void configureNextLayoutAnimation(
+      folly::dynamic && /*config*/,
+      facebook::xplat::module::CxxModule::Callback /*success*/,
+      facebook::xplat::module::CxxModule::Callback /*error*/) override {}
+  void destroyRootShadowNode(ShadowNode *node) override {
+    delete node;
+  }
+  void removeRootView(ShadowNode & /*rootNode*/) override {}
+  void setHost(INativeUIManagerHost * /*host*/) override {}
+  INativeUIManagerHost *getHost() override {
+    return nullptr;
+  }
+  void AddRootView(ShadowNode & /*shadowNode*/, IReactRootView * /*pReactRootView*/) override {}
+  void CreateView(ShadowNode & /*shadowNode*/, folly::dynamic /*props*/) override {}
+  void AddView(ShadowNode & /*parentShadowNode*/, ShadowNode & /*childShadowNode*/, uint64_t /*index*/) override {}
+  void RemoveView(ShadowNode & /*shadowNode*/, bool /*removeChildren*/) override {
+    Assert::Fail(L"Dropped views must be removed with RemoveViews.");
+  }
+  void RemoveViews(const std::vector<ShadowNode *> &nodes, bool removeChildren) override {
+    ++m_counters.RemoveViewsCount;
+    m_counters.RemoveChildren = removeChildren;
+    for (auto node : nodes)
+      m_counters.RemovedTags.push_back(node->m_tag);
+  }
+  bool DeferRemoveView(ShadowNode & /*shadowNode*/) override {
+    return DeferRemove;
+  }
+  void ReplaceView(ShadowNode & /*shadowNode*/) override {}
+  void UpdateView(ShadowNode & /*shadowNode*/, folly::dynamic /*props*/) override {}
+  void onBatchComplete() override {}
+  void ensureInBatch() override {}
+  void measure(
+      ShadowNode & /*shadowNode*/,
+      ShadowNode & /*shadowRoot*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+  void measureInWindow(ShadowNode & /*shadowNode*/, facebook::xplat::module::CxxModule::Callback /*callback*/)
+      override {}
+  void measureLayout(
+      ShadowNode & /*shadowNode*/,
+      ShadowNode & /*ancestorShadowNode*/,
+      facebook::xplat::module::CxxModule::Callback /*errorCallback*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+  void focus(int64_t /*reactTag*/) override {}
+  void blur(int64_t /*reactTag*/) override {}
+  void findSubviewIn(
+      ShadowNode & /*shadowNode*/,
+      float /*x*/,
+      float /*y*/,
+      facebook::xplat::module::CxxModule::Callback /*callback*/) override {}
+
+ private:
+  DropCounters &m_counters;
+};
+
+struct MockRootView : IReactRootView {
+  void ResetView() override {}
+  std::string JSComponentName() const noexcept override {
+    return "MockRootView";
+  }
+  int64_t GetActualHeight() const override {
+    return 100;
+  }
+  int64_t GetActualWidth() const override {
+    return 100;
+  }
+  int64_t GetTag() const override {
+    return m_tag;
+  }
+  void SetTag(int64_t tag) override {
+    m_tag = tag;
+  }
+
+ private:
+  int64_t m_tag{0};
+};
+
+// Owns a UIManager that uses the mock native UIManager.
+class DropViewFixture {
+  // Declared first, so that they outlive the UIManager.
+  MockNativeUIManager m_nativeUIManager{Counters};
+  MockRootView m_rootView;
+
+ public:
+  DropViewFixture() {
+    std::vector<std::unique_ptr<IViewManager>> viewManagers;
+    viewManagers.push_back(std::make_unique<MockViewManager>("RCTView", Counters));
+    viewManagers.push_back(std::make_unique<MockViewManager>("WindowedView", Counters, /*isWindowed:*/ true));
+    UIManager = createIUIManager(std::move(viewManagers), &m_nativeUIManager);
+    RootTag = UIManager->AddMeasuredRootView(&m_rootView);
+  }
+
+  ~DropViewFixture() {
+    UIManager = nullptr;
+  }
+
+  void CreateView(int64_t tag, const char *className = "RCTView") {
+    UIManager->createView(tag, className, RootTag, nullptr);
+  }
+
+  void SetChildren(int64_t tag, const std::vector<int64_t> &childTags) {
+    auto tags = folly::dynamic::array();
+    for (auto childTag : childTags)
+      tags.push_back(childTag);
+    UIManager->setChildren(tag, std::move(tags));
+  }
+
+  void RemoveChild(int64_t tag, int64_t index) {
+    folly::dynamic empty = folly::dynamic::array();
+    folly::dynamic removeFrom = folly::dynamic::array(index);
+    UIManager->manageChildren(tag, empty, empty, empty, empty, removeFrom);
+  }
+
+  void SetDeferRemove(bool value) {
+    m_nativeUIManager.DeferRemove = value;
+  }
+
+  DropCounters Counters;
+  std::shared_ptr<IUIManager> UIManager;
+  int64_t RootTag{0};
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (UIManagerDropViewTests) {
+  TEST_METHOD(DropView_DeepTree) {
+    constexpr int64_t depth = 100000;
+    DropViewFixture fixture;
+
+    // Each view is the only child of the previous one.
+    int64_t parentTag = fixture.RootTag;
+    for (int64_t tag = 1000; tag < 1000 + depth; ++tag) {
+      fixture.CreateView(tag);
+      fixture.SetChildren(parentTag, {tag});
+      parentTag = tag;
+    }
+
+    fixture.RemoveChild(fixture.RootTag, 0);
+
+    Assert::AreEqual(1, fixture.Counters.RemoveViewsCount);
+    Assert::IsTrue(fixture.Counters.RemoveChildren);
+    Assert::AreEqual(static_cast<size_t>(depth), fixture.Counters.RemovedTags.size());
+    for (int64_t i = 0; i < depth; ++i)
+      Assert::AreEqual(1000 + i, fixture.Counters.RemovedTags[static_cast<size_t>(i)]);
+
+    Assert::AreEqual(static_cast<int>(depth), fixture.Counters.DropViewInstanceCount);
+    Assert::AreEqual(static_cast<int>(depth), fixture.Counters.DestroyedCount);
+    // Only the subtree root is detached from its children.
+    Assert::AreEqual(1, fixture.Counters.RemoveAllChildrenCount);
+    Assert::IsNull(fixture.UIManager->FindShadowNodeForTag(1000));
+    Assert::IsNull(fixture.UIManager->FindShadowNodeForTag(1000 + depth - 1));
+    Assert::IsNotNull(fixture.UIManager->FindShadowNodeForTag(fixture.RootTag));
+  }
+
+  TEST_METHOD(DropView_WideTree) {
+    constexpr int64_t childCount = 10000;
+    constexpr int64_t grandchildCount = 5;
+    DropViewFixture fixture;
+
+    // Two containers, so that the views of the kept one are next to the
+    // dropped ones in the registry.
+    int64_t nextTag = 1000;
+    std::vector<int64_t> containerTags;
+    for (int container = 0; container < 2; ++container) {
+      int64_t containerTag = nextTag++;
+      fixture.CreateView(containerTag);
+      containerTags.push_back(containerTag);
+
+      std::vector<int64_t> childTags;
+      for (int64_t i = 0; i < childCount; ++i) {
+        int64_t childTag = nextTag++;
+        fixture.CreateView(childTag);
+        childTags.push_back(childTag);
+
+        std::vector<int64_t> grandchildTags;
+        for (int64_t j = 0; j < grandchildCount; ++j) {
+          grandchildTags.push_back(nextTag);
+          fixture.CreateView(nextTag++);
+        }
+        fixture.SetChildren(childTag, grandchildTags);
+      }
+      fixture.SetChildren(containerTag, childTags);
+    }
+    fixture.SetChildren(fixture.RootTag, containerTags);
+
+    fixture.RemoveChild(fixture.RootTag, 0);
+
+    constexpr int64_t subtreeSize = 1 + childCount * (1 + grandchildCount);
+    Assert::AreEqual(1, fixture.Counters.RemoveViewsCount);
+    Assert::AreEqual(static_cast<size_t>(subtreeSize), fixture.Counters.RemovedTags.size());
+    Assert::AreEqual(containerTags[0], fixture.Counters.RemovedTags.front());
+    Assert::AreEqual(static_cast<int>(subtreeSize), fixture.Counters.DestroyedCount);
+    Assert::AreEqual(1, fixture.Counters.RemoveAllChildrenCount);
+
+    for (int64_t tag = containerTags[0]; tag < containerTags[1]; ++tag)
+      Assert::IsNull(fixture.UIManager->FindShadowNodeForTag(tag));
+    for (int64_t tag = containerTags[1]; tag < nextTag; ++tag)
+      Assert::IsNotNull(fixture.UIManager->FindShadowNodeForTag(tag));
+  }
+
+  TEST_METHOD(DropView_PreOrder) {
+    DropViewFixture fixture;
+    for (int64_t tag = 1000; tag < 1006; ++tag)
+      fixture.CreateView(tag);
+
+    // 1000 -> (1001 -> (1003, 1004), 1002 -> (1005))
+    fixture.SetChildren(1001, {1003, 1004});
+    fixture.SetChildren(1002, {1005});
+    fixture.SetChildren(1000, {1001, 1002});
+    fixture.SetChildren(fixture.RootTag, {1000});
+
+    fixture.RemoveChild(fixture.RootTag, 0);
+
+    std::vector<int64_t> expected{1000, 1001, 1003, 1004, 1002, 1005};
+    Assert::IsTrue(expected == fixture.Counters.RemovedTags);
+  }
+
+  TEST_METHOD(DropView_DetachesWindowedViews) {
+    DropViewFixture fixture;
+    fixture.CreateView(1000);
+    fixture.CreateView(1001);
+    fixture.CreateView(1002, "WindowedView");
+    fixture.CreateView(1003);
+    fixture.SetChildren(1002, {1003});
+    fixture.SetChildren(1001, {1002});
+    fixture.SetChildren(1000, {1001});
+    fixture.SetChildren(fixture.RootTag, {1000});
+
+    fixture.RemoveChild(fixture.RootTag, 0);
+
+    // The subtree root and the windowed view.
+    Assert::AreEqual(2, fixture.Counters.RemoveAllChildrenCount);
+    Assert::AreEqual(4, fixture.Counters.DestroyedCount);
+  }
+
+  TEST_METHOD(DropView_DeferredKeepsChildren) {
+    DropViewFixture fixture;
+    fixture.CreateView(1000);
+    fixture.CreateView(1001);
+    fixture.SetChildren(1000, {1001});
+    fixture.SetChildren(fixture.RootTag, {1000});
+    fixture.SetDeferRemove(true);
+
+    fixture.RemoveChild(fixture.RootTag, 0);
+
+    Assert::AreEqual(1, fixture.Counters.RemoveViewsCount);
+    Assert::IsFalse(fixture.Counters.RemoveChildren);
+    Assert::AreEqual(0, fixture.Counters.RemoveAllChildrenCount);
+    Assert::AreEqual(2, fixture.Counters.DestroyedCount);
+  }
+
+  TEST_METHOD(RemoveRootView_DropsAllViews) {
+    DropViewFixture fixture;
+    fixture.CreateView(1000);
+    fixture.CreateView(1001);
+    fixture.SetChildren(1000, {1001});
+    fixture.SetChildren(fixture.RootTag, {1000});
+
+    fixture.UIManager->removeRootView(fixture.RootTag);
+
+    Assert::AreEqual(1, fixture.Counters.RemoveViewsCount);
+    Assert::AreEqual(fixture.RootTag, fixture.Counters.RemovedTags.front());
+    Assert::AreEqual(size_t{3}, fixture.Counters.RemovedTags.size());
+    // The root shadow node is destroyed by the native UIManager.
+    Assert::AreEqual(3, fixture.Counters.DestroyedCount);
+    Assert::IsNull(fixture.UIManager->FindShadowNodeForTag(1001));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,297 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Executors/WebSocketCallPipeline.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+using react::uwp::WebSocketCallPipeline;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// Stands in for the WebSocket and the debugger proxy. Each sent message is a
+// request id; a proxy thread replies to it after the given latency with the
+// result "r<id>". Writing a batch takes one latency, as a round trip would.
+class LoopbackProxy {
+ public:
+  explicit LoopbackProxy(std::chrono::microseconds latency) : m_latency{latency} {
+    m_pipeline = std::make_unique<WebSocketCallPipeline>([this](std::vector<std::string> &&messages) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_batchSizes.push_back(messages.size());
+      m_writes.push_back(std::move(messages));
+      m_cv.notify_all();
+    });
+    m_thread = std::thread([this]() { Run(); });
+  }
+
+  ~LoopbackProxy() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_quit = true;
+      m_cv.notify_all();
+    }
+    m_thread.join();
+  }
+
+  WebSocketCallPipeline &Pipeline() {
+    return *m_pipeline;
+  }
+
+  std::vector<size_t> BatchSizes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_batchSizes;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+      m_cv.wait(lock, [this]() { return m_quit || !m_writes.empty(); });
+      if (m_quit) {
+        return;
+      }
+
+      auto messages = std::move(m_writes.front());
+      m_writes.pop_front();
+      lock.unlock();
+
+      while (!messages.empty()) {
+        std::this_thread::sleep_for(m_latency);
+        auto nextMessages = m_pipeline->OnBatchSent();
+        for (auto &message : messages) {
+          m_pipeline->OnReply(std::stoi(message), "r" + message);
+        }
+
+        if (!nextMessages.empty()) {
+          std::lock_guard<std::mutex> batchLock(m_mutex);
+          m_batchSizes.push_back(nextMessages.size());
+        }
+        messages = std::move(nextMessages);
+      }
+
+      lock.lock();
+    }
+  }
+
+  std::chrono::microseconds m_latency;
+  std::unique_ptr<WebSocketCallPipeline> m_pipeline;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::vector<std::string>> m_writes;
+  std::vector<size_t> m_batchSizes;
+  bool m_quit{false};
+  std::thread m_thread;
+};
+
+// Collects the results delivered by a pipeline.
+class Results {
+ public:
+  WebSocketCallPipeline::Completion Add() {
+    return [this](std::string &&result) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_results.push_back(std::move(result));
+      m_cv.notify_all();
+    };
+  }
+
+  std::vector<std::string> WaitFor(size_t count) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait_for(lock, 10s, [this, count]() { return m_results.size() >= count; });
+    return m_results;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::string> m_results;
+};
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (WebSocketCallPipelineTests) {
+  TEST_METHOD(WebSocketCallPipeline_DeliversResultsInCallOrder) {
+    std::vector<std::vector<std::string>> batches;
+    WebSocketCallPipeline pipeline{[&batches](std::vector<std::string> &&messages) {
+      batches.push_back(std::move(messages));
+    }};
+    Results results;
+
+    for (int id = 1; id <= 4; ++id) {
+      pipeline.Call(id, std::to_string(id), results.Add());
+    }
+
+    // Replies in reverse order are held until the first call has its result.
+    Assert::IsTrue(pipeline.OnReply(4, "r4"));
+    Assert::IsTrue(pipeline.OnReply(3, "r3"));
+    Assert::IsTrue(pipeline.OnReply(2, "r2"));
+    Assert::AreEqual(size_t{0}, results.WaitFor(0).size());
+    Assert::AreEqual(size_t{4}, pipeline.PendingCallCount());
+
+    Assert::IsTrue(pipeline.OnReply(1, "r1"));
+    auto delivered = results.WaitFor(4);
+    Assert::AreEqual(size_t{4}, delivered.size());
+    for (int id = 1; id <= 4; ++id) {
+      Assert::AreEqual("r" + std::to_string(id), delivered[id - 1]);
+    }
+    Assert::AreEqual(size_t{0}, pipeline.PendingCallCount());
+
+    // Replies to unknown or already answered calls are not for the pipeline.
+    Assert::IsFalse(pipeline.OnReply(1, "r1"));
+    Assert::IsFalse(pipeline.OnReply(42, "r42"));
+  }
+
+  TEST_METHOD(WebSocketCallPipeline_BatchesCallsMadeDuringAWrite) {
+    std::vector<std::vector<std::string>> batches;
+    WebSocketCallPipeline pipeline{[&batches](std::vector<std::string> &&messages) {
+      batches.push_back(std::move(messages));
+    }};
+    Results results;
+
+    // The first call is written at once; the next ones wait for that write.
+    pipeline.Call(1, "1", results.Add());
+    pipeline.Call(2, "2", results.Add());
+    pipeline.Send("bundle");
+    pipeline.Call(3, "3", results.Add());
+    Assert::AreEqual(size_t{1}, batches.size());
+
+    Assert::AreEqual(size_t{1}, batches[0].size());
+    Assert::AreEqual(std::string{"1"}, batches[0][0]);
+
+    auto nextBatch = pipeline.OnBatchSent();
+    Assert::AreEqual(size_t{3}, nextBatch.size());
+    Assert::AreEqual(std::string{"2"}, nextBatch[0]);
+    Assert::AreEqual(std::string{"bundle"}, nextBatch[1]);
+    Assert::AreEqual(std::string{"3"}, nextBatch[2]);
+
+    // Nothing is queued, so the next call is written at once.
+    Assert::IsTrue(pipeline.OnBatchSent().empty());
+    pipeline.Call(4, "4", results.Add());
+    Assert::AreEqual(size_t{2}, batches.size());
+  }
+
+  TEST_METHOD(WebSocketCallPipeline_ResetDropsPendingCalls) {
+    std::vector<std::vector<std::string>> batches;
+    WebSocketCallPipeline pipeline{[&batches](std::vector<std::string> &&messages) {
+      batches.push_back(std::move(messages));
+    }};
+    Results results;
+
+    pipeline.Call(1, "1", results.Add());
+    pipeline.Call(2, "2", results.Add());
+    pipeline.OnReply(2, "r2");
+
+    // After an error no result is delivered, even for replies that arrive
+    // later, and the messages waiting for a write are not sent.
+    pipeline.Reset();
+    Assert::AreEqual(size_t{0}, pipeline.PendingCallCount());
+    Assert::IsFalse(pipeline.OnReply(1, "r1"));
+    Assert::IsTrue(pipeline.OnBatchSent().empty());
+    Assert::AreEqual(size_t{1}, batches.size());
+    Assert::AreEqual(size_t{0}, results.WaitFor(0).size());
+  }
+
+  TEST_METHOD(WebSocketCallPipeline_FailedBatchDoesNotBlockNextCalls) {
+    std::vector<std::vector<std::string>> batches;
+    WebSocketCallPipeline pipeline{[&batches](std::vector<std::string> &&messages) {
+      batches.push_back(std::move(messages));
+    }};
+    Results results;
+
+    pipeline.Call(1, "1", results.Add());
+    pipeline.Call(2, "2", results.Add());
+    Assert::AreEqual(size_t{1}, batches.size());
+
+    // The write of the first batch fails. The calls are dropped, and the next
+    // call starts a new batch instead of waiting for the failed one.
+    pipeline.OnBatchFailed();
+    Assert::AreEqual(size_t{0}, pipeline.PendingCallCount());
+    pipeline.Call(3, "3", results.Add());
+    Assert::AreEqual(size_t{2}, batches.size());
+    Assert::AreEqual(size_t{1}, batches[1].size());
+    Assert::AreEqual(std::string{"3"}, batches[1][0]);
+
+    Assert::IsTrue(pipeline.OnReply(3, "r3"));
+    auto delivered = results.WaitFor(1);
+    Assert::AreEqual(size_t{1}, delivered.size());
+    Assert::AreEqual(std::string{"r3"}, delivered[0]);
+  }
+
+  TEST_METHOD(WebSocketCallPipeline_LoopbackKeepsOrder) {
+    constexpr int callCount = 2000;
+    Results results;
+    LoopbackProxy proxy{50us};
+
+    std::vector<std::thread> callers;
+    std::mutex callMutex;
+    int nextId = 0;
+    for (int caller = 0; caller < 4; ++caller) {
+      callers.emplace_back([&]() {
+        for (int i = 0; i < callCount / 4; ++i) {
+          // Ids are assigned in call order, as the executor does on its queue.
+          std::lock_guard<std::mutex> lock(callMutex);
+          int id = ++nextId;
+          proxy.Pipeline().Call(id, std::to_string(id), results.Add());
+        }
+      });
+    }
+    for (auto &caller : callers) {
+      caller.join();
+    }
+
+    auto delivered = results.WaitFor(callCount);
+    Assert::AreEqual(size_t{callCount}, delivered.size());
+    for (int id = 1; id <= callCount; ++id) {
+      Assert::AreEqual("r" + std::to_string(id), delivered[id - 1]);
+    }
+
+    // Calls made while a batch was written were sent together.
+    Assert::IsTrue(proxy.BatchSizes().size() < size_t{callCount});
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(WebSocketCallPipeline_Throughput) {
+    constexpr int callCount = 2000;
+    constexpr auto latency = 200us;
+    using clock = std::chrono::steady_clock;
+
+    auto measure = [&](const char *name, bool waitForEachReply) {
+      Results results;
+      LoopbackProxy proxy{latency};
+
+      auto start = clock::now();
+      for (int id = 1; id <= callCount; ++id) {
+        proxy.Pipeline().Call(id, std::to_string(id), results.Add());
+        if (waitForEachReply) {
+          results.WaitFor(id);
+        }
+      }
+      auto delivered = results.WaitFor(callCount);
+      auto elapsed = std::chrono::duration<double>(clock::now() - start).count();
+      Assert::AreEqual(size_t{callCount}, delivered.size());
+
+      std::ostringstream result;
+      result << name << ": " << static_cast<int64_t>(callCount / elapsed) << " calls per second in "
+             << proxy.BatchSizes().size() << " writes";
+      Logger::WriteMessage(result.str().c_str());
+    };
+
+    measure("WebSocketCallPipeline, one round trip per call", true);
+    measure("WebSocketCallPipeline, pipelined", false);
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace Microsoft::React::Test
@@ -4,6 +4,7 @@
 
 #include "facebook.react.NativeTraceEventSource.g.cpp"
 
+#include <TraceEventRecorder.h>
 #include <Tracing.h>
 #include <Unicode.h>
 
@@ -11,53 +12,159 @@ using namespace ::Microsoft::Common::Unicode;
 
 namespace winrt::facebook::react::implementation {
 namespace {
-::winrt::facebook::react::INativeTraceHandler g_abiHandler;
-std::atomic<uint32_t> g_abiHandlerRegistrationCookie = 0;
 
-class InternalHandler : public ::facebook::react::INativeTraceHandler{
-  public : virtual void JSBeginSection(const char *profileName, const char *args) noexcept override{
-      g_abiHandler.JSBeginSection(Utf8ToUtf16(profileName), Utf8ToUtf16(args));
-} // namespace
+using ::facebook::react::TraceEvent;
+using ::facebook::react::TraceEventBatch;
+using ::facebook::react::TraceEventKind;
+using ::facebook::react::TraceEventRecorder;
 
-virtual void JSEndSection() noexcept override {
-  g_abiHandler.JSEndSection();
-}
+constexpr std::chrono::milliseconds FlushInterval{20};
 
-virtual void JSBeginAsyncSection(const char *profileName, int cookie) noexcept override {
-  g_abiHandler.JSBeginAsyncSection(Utf8ToUtf16(profileName), cookie);
+// Events are recorded on the tracing threads and delivered to the ABI handler from the recorder's flush thread.
+// The recorder is never destroyed because tracing hooks may still be running when tracing is uninitialized.
+TraceEventRecorder &Recorder() noexcept {
+  static TraceEventRecorder *recorder = new TraceEventRecorder();
+  return *recorder;
 }
 
-virtual void JSEndAsyncSection(const char *profileName, int cookie) noexcept override {
-  g_abiHandler.JSEndAsyncSection(Utf8ToUtf16(profileName), cookie);
+// Serializes InitializeTracing and UninitializeTracing.
+std::mutex g_registrationMutex;
+uint32_t g_abiHandlerRegistrationCookie = 0;
+
+// Guards the handler that the flush thread delivers to.
+std::mutex g_abiHandlerMutex;
+::winrt::facebook::react::INativeTraceHandler g_abiHandler;
+// Set if g_abiHandler also implements INativeTraceEventBatchHandler.
+::winrt::facebook::react::INativeTraceEventBatchHandler g_abiBatchHandler;
+
+// Used only by the flush thread. Indexed by the interned name IDs.
+std::vector<hstring> g_names;
+
+// Used only by the flush thread. Kept to reuse its storage.
+std::vector<::winrt::facebook::react::NativeTraceEvent> g_abiEvents;
+
+static_assert(
+    static_cast<int32_t>(TraceEventKind::NativeEndSection) ==
+        static_cast<int32_t>(::winrt::facebook::react::NativeTraceEventKind::NativeEndSection),
+    "NativeTraceEventKind must match TraceEventKind");
+
+hstring const &ProfileName(uint32_t nameId) {
+  while (g_names.size() <= nameId) {
+    g_names.push_back(hstring{Utf8ToUtf16(Recorder().Name(static_cast<uint32_t>(g_names.size())))});
+  }
+
+  return g_names[nameId];
 }
 
-virtual void JSCounter(const char *profileName, int value) noexcept override {
-  g_abiHandler.JSCounter(Utf8ToUtf16(profileName), value);
+hstring Args(TraceEvent const &event) {
+  return event.Args.empty() ? hstring{} : hstring{Utf8ToUtf16(event.Args)};
 }
 
-virtual void NativeBeginSection(const char *profileName, const char *args) noexcept override {
-  g_abiHandler.NativeBeginSection(Utf8ToUtf16(profileName), Utf8ToUtf16(args));
+void DeliverBatch(
+    ::winrt::facebook::react::INativeTraceEventBatchHandler const &handler,
+    TraceEventBatch const &events) {
+  g_abiEvents.clear();
+  for (auto const &event : events) {
+    g_abiEvents.push_back(
+        {static_cast<::winrt::facebook::react::NativeTraceEventKind>(event.Kind),
+         event.ThreadId,
+         std::chrono::duration_cast<std::chrono::nanoseconds>(event.Timestamp.time_since_epoch()).count(),
+         ProfileName(event.NameId),
+         Args(event),
+         event.Value});
+  }
+
+  handler.HandleEvents(g_abiEvents);
+  g_abiEvents.clear();
 }
 
-virtual void
-NativeEndSection(const char *profileName, const char *args, std::chrono::nanoseconds duration) noexcept override {
-  g_abiHandler.NativeEndSection(Utf8ToUtf16(profileName), Utf8ToUtf16(args), duration.count());
+// The handler receives the events after they happened, so it cannot know their time.
+void DeliverEachEvent(::winrt::facebook::react::INativeTraceHandler const &handler, TraceEventBatch const &events) {
+  for (auto const &event : events) {
+    switch (event.Kind) {
+      case TraceEventKind::JSBeginSection:
+        handler.JSBeginSection(ProfileName(event.NameId), Args(event));
+        break;
+      case TraceEventKind::JSEndSection:
+        handler.JSEndSection();
+        break;
+      case TraceEventKind::JSBeginAsyncSection:
+        handler.JSBeginAsyncSection(ProfileName(event.NameId), static_cast<uint32_t>(event.Value));
+        break;
+      case TraceEventKind::JSEndAsyncSection:
+        handler.JSEndAsyncSection(ProfileName(event.NameId), static_cast<uint32_t>(event.Value));
+        break;
+      case TraceEventKind::JSCounter:
+        handler.JSCounter(ProfileName(event.NameId), static_cast<uint32_t>(event.Value));
+        break;
+      case TraceEventKind::NativeBeginSection:
+        handler.NativeBeginSection(ProfileName(event.NameId), Args(event));
+        break;
+      case TraceEventKind::NativeEndSection:
+        handler.NativeEndSection(ProfileName(event.NameId), Args(event), event.Value);
+        break;
+    }
+  }
 }
 
-private:
-} // namespace winrt::facebook::react::implementation
-g_internalHandler;
+void DeliverEvents(TraceEventBatch const &events) noexcept {
+  ::winrt::facebook::react::INativeTraceHandler handler;
+  ::winrt::facebook::react::INativeTraceEventBatchHandler batchHandler;
+  {
+    std::lock_guard<std::mutex> lock{g_abiHandlerMutex};
+    handler = g_abiHandler;
+    batchHandler = g_abiBatchHandler;
+  }
+
+  // The handler may throw, e.g. when it lives in another process that went away. That must not terminate the
+  // flush thread, so the rest of the batch is dropped instead.
+  try {
+    if (batchHandler) {
+      DeliverBatch(batchHandler, events);
+    } else if (handler) {
+      DeliverEachEvent(handler, events);
+    }
+  } catch (...) {
+    g_abiEvents.clear();
+  }
 }
 
+} // namespace
+
 uint32_t NativeTraceEventSource::InitializeTracing(::winrt::facebook::react::INativeTraceHandler const &handler) {
-  g_abiHandler = handler;
-  ::facebook::react::InitializeTracing(&g_internalHandler);
+  std::lock_guard<std::mutex> registrationLock{g_registrationMutex};
+  auto batchHandler = handler.try_as<::winrt::facebook::react::INativeTraceEventBatchHandler>();
+  {
+    std::lock_guard<std::mutex> lock{g_abiHandlerMutex};
+    g_abiHandler = handler;
+    g_abiBatchHandler = std::move(batchHandler);
+  }
+
+  Recorder().StartFlushing(DeliverEvents, FlushInterval);
+  ::facebook::react::InitializeTracing(&Recorder());
   return ++g_abiHandlerRegistrationCookie;
 }
 
 void NativeTraceEventSource::UninitializeTracing(uint32_t cookie) {
+  std::lock_guard<std::mutex> registrationLock{g_registrationMutex};
   assert(cookie == g_abiHandlerRegistrationCookie);
-  g_abiHandler = nullptr;
+  if (cookie != g_abiHandlerRegistrationCookie) {
+    // A newer handler has replaced this one.
+    return;
+  }
+
   ::facebook::react::InitializeTracing(nullptr);
+
+  // Deliver the events recorded so far before the handler is released.
+  Recorder().StopFlushing();
+
+  std::lock_guard<std::mutex> lock{g_abiHandlerMutex};
+  g_abiHandler = nullptr;
+  g_abiBatchHandler = nullptr;
 }
+
+void NativeTraceEventSource::SetSampleRate(uint32_t sampleRate) {
+  Recorder().SetSampleRate(sampleRate);
 }
+
+} // namespace winrt::facebook::react::implementation
@@ -7,6 +7,7 @@ struct NativeTraceEventSource {
 
   static uint32_t InitializeTracing(facebook::react::INativeTraceHandler const &handler);
   static void UninitializeTracing(uint32_t cookie);
+  static void SetSampleRate(uint32_t sampleRate);
 };
 } // namespace winrt::facebook::react::implementation
 namespace winrt::facebook::react::factory_implementation {
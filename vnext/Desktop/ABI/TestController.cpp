@@ -140,4 +140,30 @@ msrn::IReactNonAbiValue TestController::CreateNonAbiValue(int32_t value) {
   return make<msrn::implementation::ReactNonAbiValue<int32_t>>(value);
 }
 
+void TestController::InvokeMethod(
+    msrn::IReactModuleBuilder builder,
+    hstring methodName,
+    uint32_t argumentCount,
+    uint32_t iterations) {
+  // Calls the method the same way the bridge does, so that tests can measure
+  // the cost of the ABI method invocation without a running instance.
+  auto cxxModule = builder.as<msrn::ReactModuleBuilder>()->MakeCxxModule("TestModule", nullptr);
+  auto methods = cxxModule->getMethods();
+  auto methodNameUtf8 = to_string(methodName);
+  auto method = std::find_if(
+      methods.begin(), methods.end(), [&methodNameUtf8](const auto &method) { return method.name == methodNameUtf8; });
+  if (method == methods.end() || !method->func) {
+    throw hresult_invalid_argument(L"methodName");
+  }
+
+  folly::dynamic args = folly::dynamic::array();
+  for (uint32_t i = 0; i < argumentCount; ++i) {
+    args.push_back(i);
+  }
+
+  for (uint32_t i = 0; i < iterations; ++i) {
+    method->func(args, [](std::vector<folly::dynamic>) {}, [](std::vector<folly::dynamic>) {});
+  }
+}
+
 } // namespace winrt::Microsoft::Internal::implementation
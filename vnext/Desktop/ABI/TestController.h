@@ -24,6 +24,11 @@ struct TestController {
       uint32_t id,
       array_view<Microsoft::ReactNative::IRedBoxErrorFrameInfo const> callstack);
   static Microsoft::ReactNative::IReactNonAbiValue CreateNonAbiValue(int32_t value);
+  static void InvokeMethod(
+      Microsoft::ReactNative::IReactModuleBuilder builder,
+      hstring methodName,
+      uint32_t argumentCount,
+      uint32_t iterations);
 };
 } // namespace winrt::Microsoft::Internal::implementation
 
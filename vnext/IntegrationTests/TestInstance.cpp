@@ -123,6 +123,12 @@ void TestNativeUIManager::AddView(
 
 void TestNativeUIManager::RemoveView(facebook::react::ShadowNode &shadowNode, bool removeChildren) {}
 
+void TestNativeUIManager::RemoveViews(const std::vector<facebook::react::ShadowNode *> &nodes, bool removeChildren) {}
+
+bool TestNativeUIManager::DeferRemoveView(facebook::react::ShadowNode &shadowNode) {
+  return false;
+}
+
 void TestNativeUIManager::ReplaceView(facebook::react::ShadowNode &shadowNode) {}
 
 void TestNativeUIManager::UpdateView(facebook::react::ShadowNode &shadowNode, folly::dynamic /*ReadableMap*/ props) {}
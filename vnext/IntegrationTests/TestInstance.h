@@ -64,6 +64,8 @@ class TestNativeUIManager : public facebook::react::INativeUIManager {
       facebook::react::ShadowNode &childShadowNode,
       uint64_t index) override;
   void RemoveView(facebook::react::ShadowNode &shadowNode, bool removeChildren = true) override;
+  void RemoveViews(const std::vector<facebook::react::ShadowNode *> &nodes, bool removeChildren) override;
+  bool DeferRemoveView(facebook::react::ShadowNode &shadowNode) override;
   void ReplaceView(facebook::react::ShadowNode &shadowNode) override;
   void UpdateView(facebook::react::ShadowNode &shadowNode, folly::dynamic /*ReadableMap*/ props) override;
   void onBatchComplete() override;
@@ -11,11 +11,15 @@
 #include <jsi/jsi.h>
 
 #include <stdlib.h>
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <functional>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 using namespace facebook::jsi;
 
@@ -158,6 +162,103 @@ TEST_P(JsiRuntimeUnitTests, ObjectTest) {
   EXPECT_EQ(names.getValueAtIndex(rt, 0).getString(rt).utf8(rt), "a");
 }
 
+TEST_P(JsiRuntimeUnitTests, PropertyNamesTest) {
+  auto sortedNames = [&](const Object &obj) {
+    Array names = obj.getPropertyNames(rt);
+    std::vector<std::string> result;
+    for (size_t i = 0; i < names.size(rt); ++i) {
+      Value name = names.getValueAtIndex(rt, i);
+      EXPECT_TRUE(name.isString());
+      result.push_back(name.getString(rt).utf8(rt));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+  using Names = std::vector<std::string>;
+
+  // Enumerable properties of the prototype chain are included, and shadowed
+  // ones only once.
+  Object derived = eval(
+                       "(function () {"
+                       "  var base = { a: 1, shadowed: 2 };"
+                       "  var middle = Object.create(base);"
+                       "  middle.b = 3;"
+                       "  var derived = Object.create(middle);"
+                       "  derived.c = 4;"
+                       "  derived.shadowed = 5;"
+                       "  return derived;"
+                       "})()")
+                       .getObject(rt);
+  EXPECT_EQ(sortedNames(derived), (Names{"a", "b", "c", "shadowed"}));
+
+  // Objects without a prototype.
+  Object noPrototype = eval("(function () { var o = Object.create(null); o.x = 1; return o; })()").getObject(rt);
+  EXPECT_EQ(sortedNames(noPrototype), (Names{"x"}));
+  EXPECT_EQ(sortedNames(eval("Object.create(null)").getObject(rt)), Names{});
+
+  // Non-enumerable and symbol keyed properties are not included, on the object
+  // or its prototypes.
+  Object hidden = eval(
+                      "(function () {"
+                      "  var proto = { visibleInProto: 1 };"
+                      "  Object.defineProperty(proto, 'hiddenInProto', { enumerable: false, value: 2 });"
+                      "  proto[Symbol('protoSymbol')] = 3;"
+                      "  var o = Object.create(proto);"
+                      "  o.visible = 4;"
+                      "  Object.defineProperty(o, 'hidden', { enumerable: false, value: 5 });"
+                      "  o[Symbol('symbol')] = 6;"
+                      "  return o;"
+                      "})()")
+                      .getObject(rt);
+  EXPECT_EQ(sortedNames(hidden), (Names{"visible", "visibleInProto"}));
+
+  // A non-enumerable own property hides an enumerable one of the prototype.
+  Object shadowedByHidden = eval(
+                                "(function () {"
+                                "  var o = Object.create({ p: 1 });"
+                                "  Object.defineProperty(o, 'p', { enumerable: false, value: 2 });"
+                                "  return o;"
+                                "})()")
+                                .getObject(rt);
+  EXPECT_EQ(sortedNames(shadowedByHidden), Names{});
+
+  // Arrays return their indices, and built-in properties are not enumerable.
+  EXPECT_EQ(sortedNames(eval("['a', 'b']").getObject(rt)), (Names{"0", "1"}));
+  EXPECT_EQ(sortedNames(Object(rt)), Names{});
+
+  // The result does not depend on globals that scripts can change.
+  eval("Object.prototype.propertyIsEnumerable = function() { return false; };");
+  eval("Array.prototype.push = function() { throw new Error('push'); };");
+  EXPECT_EQ(sortedNames(derived), (Names{"a", "b", "c", "shadowed"}));
+}
+
+#ifdef PERF_TESTS
+TEST_P(JsiRuntimeUnitTests, PropertyNamesPerfTest) {
+  using clock = std::chrono::steady_clock;
+  Function makeObject = function(
+      "function (keyCount) {"
+      "  var o = {};"
+      "  for (var i = 0; i < keyCount; ++i) {"
+      "    o['key' + i] = i;"
+      "  }"
+      "  return o;"
+      "}");
+
+  for (int keyCount : {10, 100, 1000}) {
+    Object obj = makeObject.call(rt, keyCount).getObject(rt);
+    int iterations = 1000000 / keyCount;
+
+    auto start = clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      EXPECT_EQ(obj.getPropertyNames(rt).size(rt), static_cast<size_t>(keyCount));
+    }
+    auto perCall = std::chrono::duration<double, std::micro>(clock::now() - start).count() / iterations;
+
+    std::printf("getPropertyNames with %d keys: %.2f us per call\n", keyCount, perCall);
+  }
+}
+#endif // PERF_TESTS
+
 TEST_P(JsiRuntimeUnitTests_Chakra, HostObjectTest) {
   class ConstantHostObject : public HostObject {
     Value get(Runtime &, const PropNameID &sym) override {
@@ -904,3 +1005,87 @@ TEST_P(JsiRuntimeUnitTests, HostObjectWithValueMembers) {
   EXPECT_TRUE(bag["iscool"].getBool());
   EXPECT_EQ(bag["obj"].getObject(rt).getProperty(rt, "foo").getString(rt).utf8(rt), "bar");
 }
+
+// Arguments are passed differently on either side of 8 arguments.
+TEST_P(JsiRuntimeUnitTests_Chakra, FunctionArgumentCountTest) {
+  Function describe = function(
+      "function() {"
+      "  return Array.prototype.map.call(arguments, function(a) { return typeof a + ':' + a; }).join(',');"
+      "}");
+  Function echo = Function::createFromHostFunction(
+      rt, PropNameID::forAscii(rt, "echo"), 0, [&](Runtime &rt, const Value &, const Value *args, size_t count) {
+        return describe.callWithThis(rt, Object(rt), args, count);
+      });
+  rt.global().setProperty(rt, "echo", echo);
+
+  for (int count = 0; count <= 12; ++count) {
+    std::vector<Value> args;
+    std::string jsArgs;
+    std::string expected;
+    for (int i = 0; i < count; ++i) {
+      std::string separator = i > 0 ? "," : "";
+      if (i % 3 == 0) {
+        args.emplace_back(i + 0.5);
+        jsArgs += separator + std::to_string(i) + ".5";
+        expected += separator + "number:" + std::to_string(i) + ".5";
+      } else if (i % 3 == 1) {
+        args.emplace_back(String::createFromAscii(rt, "s" + std::to_string(i)));
+        jsArgs += separator + "'s" + std::to_string(i) + "'";
+        expected += separator + "string:s" + std::to_string(i);
+      } else {
+        args.emplace_back(i % 2 == 0);
+        jsArgs += separator + (i % 2 == 0 ? "true" : "false");
+        expected += separator + (i % 2 == 0 ? "boolean:true" : "boolean:false");
+      }
+    }
+
+    // Host to JS, then JS to host through echo.
+    EXPECT_EQ(describe.call(rt, static_cast<const Value *>(args.data()), args.size()).getString(rt).utf8(rt), expected);
+    EXPECT_EQ(echo.call(rt, static_cast<const Value *>(args.data()), args.size()).getString(rt).utf8(rt), expected);
+    EXPECT_EQ(eval(("echo(" + jsArgs + ")").c_str()).getString(rt).utf8(rt), expected);
+  }
+}
+
+#ifdef PERF_TESTS
+TEST_P(JsiRuntimeUnitTests, FunctionCallPerfTest) {
+  constexpr int iterations = 100000;
+  using clock = std::chrono::steady_clock;
+
+  Function jsFunction = function("function() { return arguments.length; }");
+  Function hostFunction = Function::createFromHostFunction(
+      rt, PropNameID::forAscii(rt, "hostFunction"), 0, [](Runtime &, const Value &, const Value *, size_t count) {
+        return static_cast<int>(count);
+      });
+  rt.global().setProperty(rt, "hostFunction", hostFunction);
+
+  // A mix of the value kinds that are passed by reference and by value.
+  std::vector<Value> args;
+  for (int i = 0; i < 8; ++i) {
+    if (i % 2 == 0) {
+      args.emplace_back(i + 0.5);
+    } else {
+      args.emplace_back(String::createFromAscii(rt, "arg"));
+    }
+  }
+
+  for (size_t count = 0; count <= args.size(); ++count) {
+    auto start = clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      jsFunction.call(rt, static_cast<const Value *>(args.data()), count);
+    }
+    auto hostToJs = std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations;
+
+    // The loop runs in JavaScript, so that only the JS to host calls are measured.
+    std::string jsArgs;
+    for (size_t i = 0; i < count; ++i) {
+      jsArgs += i > 0 ? ",'arg'" : "'arg'";
+    }
+    Function jsToHost = function("function(n) { for (var i = 0; i < n; ++i) { hostFunction(" + jsArgs + "); } }");
+    start = clock::now();
+    jsToHost.call(rt, iterations);
+    auto jsToHostNs = std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations;
+
+    std::printf("%zu arguments: host to JS %.0f ns, JS to host %.0f ns per call\n", count, hostToJs, jsToHostNs);
+  }
+}
+#endif // PERF_TESTS
@@ -68,6 +68,29 @@ class ChakraObjectRef {
   State m_state = State::Uninitialized;
 };
 
+/**
+ * @brief A non-owning counterpart of ChakraObjectRef.
+ *
+ * ChakraBorrowedRef does not call JsAddRef or JsRelease. It must only refer to
+ * JsRefs that are kept alive by other means while it is used: JsRefs owned by a
+ * ChakraObjectRef that outlives it, or stack-scoped temporaries, which the
+ * garbage collector finds when it scans the stack. JsRefs stored on the heap
+ * are not scanned and must be owned by a ChakraObjectRef.
+ */
+class ChakraBorrowedRef {
+ public:
+  constexpr ChakraBorrowedRef() noexcept = default;
+  constexpr explicit ChakraBorrowedRef(JsRef ref) noexcept : m_ref{ref} {}
+  explicit ChakraBorrowedRef(const ChakraObjectRef &ref) noexcept : m_ref{ref} {}
+
+  constexpr operator JsRef() const noexcept {
+    return m_ref;
+  }
+
+ private:
+  JsRef m_ref = JS_INVALID_REFERENCE;
+};
+
 /**
  * @param jsValue A ChakraObjectRef managing a JsValueRef.
  */
@@ -24,9 +24,18 @@ constexpr const char *const g_bootstrapBundleSource =
     "function $$ChakraRuntimeProxyConstructor$$(target, handler)\n"
     "{\n"
     "  return new Proxy(target, handler)\n"
+    "}\n"
+    "function $$ChakraRuntimeGetPropertyNames$$(obj)\n"
+    "{\n"
+    "  var names = [];\n"
+    "  for (var name in obj) {\n"
+    "    names[names.length] = name;\n"
+    "  }\n"
+    "  return names;\n"
     "}";
 
 constexpr const char *const g_proxyConstructorBootstrapFuncName = "$$ChakraRuntimeProxyConstructor$$";
+constexpr const char *const g_getPropertyNamesBootstrapFuncName = "$$ChakraRuntimeGetPropertyNames$$";
 
 constexpr const char *const g_proxyGetHostObjectTargetPropName = "$$ProxyGetHostObjectTarget$$";
 constexpr const char *const g_proxyIsHostObjectPropName = "$$ProxyIsHostObject$$";
@@ -51,18 +60,52 @@ class HostFunctionProxy {
   ChakraRuntime &m_runtime;
 };
 
-// Callers of this functions must make sure that jsThis and args are alive when
-// using the return value of this function.
-std::vector<JsValueRef> ConstructJsFunctionArguments(
-    const ChakraObjectRef &jsThis,
-    const std::vector<ChakraObjectRef> &args) {
-  std::vector<JsValueRef> result;
-  result.push_back(JsRef(jsThis));
-  for (const ChakraObjectRef &ref : args) {
-    result.push_back(JsRef(ref));
+// The number of arguments of a function call that are stored on the stack.
+constexpr size_t g_maxStackArgCount = 8;
+
+// The arguments passed to JsCallFunction and JsConstructObject, with 'this' at
+// index 0. Up to g_maxStackArgCount arguments are stored in an inline array,
+// which must stay on the stack so that the references in it are borrowed
+// safely. Larger argument lists are stored on the heap along with owning
+// references. Callers must make sure that the values the arguments refer to are
+// alive while the arguments are used.
+class JsFunctionArguments {
+ public:
+  explicit JsFunctionArguments(size_t argumentCountIncThis) {
+    assert(argumentCountIncThis <= (std::numeric_limits<unsigned short>::max)());
+    if (argumentCountIncThis > g_maxStackArgCount + 1) {
+      m_heapRefs.reserve(argumentCountIncThis);
+      m_heapOwners.reserve(argumentCountIncThis);
+    }
   }
-  return result;
-}
+
+  JsFunctionArguments(const JsFunctionArguments &) = delete;
+  JsFunctionArguments &operator=(const JsFunctionArguments &) = delete;
+
+  void Add(ChakraBorrowedRef ref) {
+    if (m_heapRefs.capacity() > 0) {
+      m_heapOwners.emplace_back(ref);
+      m_heapRefs.push_back(ref);
+    } else {
+      assert(m_stackCount <= g_maxStackArgCount);
+      m_stackRefs[m_stackCount++] = ref;
+    }
+  }
+
+  JsValueRef *Data() noexcept {
+    return m_heapRefs.capacity() > 0 ? m_heapRefs.data() : m_stackRefs;
+  }
+
+  unsigned short Size() const noexcept {
+    return static_cast<unsigned short>(m_heapRefs.capacity() > 0 ? m_heapRefs.size() : m_stackCount);
+  }
+
+ private:
+  JsValueRef m_stackRefs[g_maxStackArgCount + 1];
+  size_t m_stackCount{0};
+  std::vector<JsValueRef> m_heapRefs;
+  std::vector<ChakraObjectRef> m_heapOwners;
+};
 
 } // namespace
 
@@ -95,11 +138,17 @@ ChakraRuntime::ChakraRuntime(ChakraRuntimeArgs &&args) noexcept : m_args{std::mo
 
   static facebook::jsi::StringBuffer bootstrapBundleSourceBuffer{g_bootstrapBundleSource};
   evaluateJavaScriptSimple(bootstrapBundleSourceBuffer, "ChakraRuntime_bootstrap.bundle");
+
+  // Looked up once, so that getPropertyNames does not depend on the global
+  // object.
+  m_getPropertyNamesFunction = GetProperty(GetChakraObjectRef(global()), g_getPropertyNamesBootstrapFuncName);
 }
 
 ChakraRuntime::~ChakraRuntime() noexcept {
   stopDebuggingIfNeeded();
 
+  m_getPropertyNamesFunction.Invalidate();
+
   VerifyChakraErrorElseThrow(JsSetCurrentContext(JS_INVALID_REFERENCE));
   m_context.Invalidate();
 
@@ -372,66 +421,17 @@ bool ChakraRuntime::isHostFunction(const facebook::jsi::Function &obj) const {
 }
 
 facebook::jsi::Array ChakraRuntime::getPropertyNames(const facebook::jsi::Object &object) {
-  // Handle to the null JS value.
-  ChakraObjectRef jsNull = ToChakraObjectRef(facebook::jsi::Value::null());
-
-  // Handle to the Object constructor.
-  ChakraObjectRef objectConstructor = GetProperty(GetChakraObjectRef(global()), "Object");
-
-  // Handle to the Object.prototype Object.
-  ChakraObjectRef objectPrototype = GetProperty(objectConstructor, "prototype");
-
-  // Handle to the Object.prototype.propertyIsEnumerable() Function.
-  ChakraObjectRef objectPrototypePropertyIsEnumerable = GetProperty(objectPrototype, "propertyIsEnumerable");
+  // The names of the enumerable string keyed properties of object and its
+  // prototype chain are collected by a for...in loop in a single call, which
+  // skips shadowed properties and returns the names in the order the engine
+  // enumerates them.
+  JsValueRef undefinedRef = JS_INVALID_REFERENCE;
+  VerifyJsErrorElseThrow(JsGetUndefinedValue(&undefinedRef));
+  JsValueRef args[] = {undefinedRef, GetChakraObjectRef(object)};
 
-  // We now traverse the object's property chain and collect all enumerable
-  // property names.
-  std::vector<ChakraObjectRef> enumerablePropNames{};
-  ChakraObjectRef currentObjectOnPrototypeChain = GetChakraObjectRef(object);
-
-  // We have a small optimization here where we stop traversing the prototype
-  // chain as soon as we hit Object.prototype. However, we still need to check
-  // for null here, as one can create an Object with no prototype through
-  // Object.create(null).
-  while (!CompareJsValues(currentObjectOnPrototypeChain, objectPrototype) &&
-         !CompareJsValues(currentObjectOnPrototypeChain, jsNull)) {
-    JsValueRef propNamesRef = JS_INVALID_REFERENCE;
-    VerifyJsErrorElseThrow(JsGetOwnPropertyNames(currentObjectOnPrototypeChain, &propNamesRef));
-    ChakraObjectRef propNames(propNamesRef);
-
-    int propNamesSize = ToInteger(GetProperty(propNames, "length"));
-
-    for (int i = 0; i < propNamesSize; ++i) {
-      JsValueRef propNameRef = JS_INVALID_REFERENCE;
-      VerifyJsErrorElseThrow(JsGetIndexedProperty(propNames, ToJsNumber(i), &propNameRef));
-      ChakraObjectRef propName(propNameRef);
-
-      std::vector<JsValueRef> args = {currentObjectOnPrototypeChain, propName};
-
-      JsValueRef result;
-      VerifyJsErrorElseThrow(JsCallFunction(
-          objectPrototypePropertyIsEnumerable, args.data(), static_cast<unsigned short>(args.size()), &result));
-
-      bool propIsEnumerable = ToJsiValue(ChakraObjectRef(result)).getBool();
-
-      if (propIsEnumerable) {
-        enumerablePropNames.emplace_back(propName);
-      }
-    }
-
-    JsValueRef prototype = JS_INVALID_REFERENCE;
-    VerifyJsErrorElseThrow(JsGetPrototype(currentObjectOnPrototypeChain, &prototype));
-    currentObjectOnPrototypeChain = ChakraObjectRef(prototype);
-  }
-
-  size_t enumerablePropNamesSize = enumerablePropNames.size();
-  facebook::jsi::Array result = createArray(enumerablePropNamesSize);
-
-  for (size_t i = 0; i < enumerablePropNamesSize; ++i) {
-    result.setValueAtIndex(*this, i, MakePointer<facebook::jsi::String>(enumerablePropNames[i]));
-  }
-
-  return result;
+  JsValueRef result = JS_INVALID_REFERENCE;
+  VerifyJsErrorElseThrow(JsCallFunction(m_getPropertyNamesFunction, args, 2, &result));
+  return MakePointer<facebook::jsi::Object>(result).asArray(*this);
 }
 
 // Only ChakraCore supports weak reference semantics, so ChakraRuntime
@@ -554,34 +554,31 @@ facebook::jsi::Value ChakraRuntime::call(
     const facebook::jsi::Value &jsThis,
     const facebook::jsi::Value *args,
     size_t count) {
-  // We must store these ChakraObjectRefs on the stack to make sure that they do
-  // not go out of scope when JsCallFunction is called.
-  ChakraObjectRef thisRef = ToChakraObjectRef(jsThis);
-  std::vector<ChakraObjectRef> argRefs = ToChakraObjectRefs(args, count);
-
-  std::vector<JsValueRef> argsWithThis = ConstructJsFunctionArguments(thisRef, argRefs);
-  assert(argsWithThis.size() <= (std::numeric_limits<unsigned short>::max)());
+  // jsThis and args outlive the call, so their references can be borrowed.
+  JsFunctionArguments argsWithThis{count + 1};
+  argsWithThis.Add(ToChakraBorrowedRef(jsThis));
+  for (size_t i = 0; i < count; ++i) {
+    argsWithThis.Add(ToChakraBorrowedRef(args[i]));
+  }
 
   JsValueRef result;
-  VerifyJsErrorElseThrow(JsCallFunction(
-      GetChakraObjectRef(func), argsWithThis.data(), static_cast<unsigned short>(argsWithThis.size()), &result));
-  return ToJsiValue(ChakraObjectRef(result));
+  VerifyJsErrorElseThrow(JsCallFunction(GetChakraObjectRef(func), argsWithThis.Data(), argsWithThis.Size(), &result));
+  return ToJsiValue(ChakraBorrowedRef(result));
 }
 
 facebook::jsi::Value
 ChakraRuntime::callAsConstructor(const facebook::jsi::Function &func, const facebook::jsi::Value *args, size_t count) {
-  // We must store these ChakraObjectRefs on the stack to make sure that they do
-  // not go out of scope when JsConstructObject is called.
-  ChakraObjectRef undefinedRef = ToChakraObjectRef(facebook::jsi::Value::undefined());
-  std::vector<ChakraObjectRef> argRefs = ToChakraObjectRefs(args, count);
-
-  std::vector<JsValueRef> argsWithThis = ConstructJsFunctionArguments(undefinedRef, argRefs);
-  assert(argsWithThis.size() <= (std::numeric_limits<unsigned short>::max)());
+  // args outlive the call, so their references can be borrowed.
+  JsFunctionArguments argsWithThis{count + 1};
+  argsWithThis.Add(ToChakraBorrowedRef(facebook::jsi::Value::undefined()));
+  for (size_t i = 0; i < count; ++i) {
+    argsWithThis.Add(ToChakraBorrowedRef(args[i]));
+  }
 
   JsValueRef result;
-  VerifyJsErrorElseThrow(JsConstructObject(
-      GetChakraObjectRef(func), argsWithThis.data(), static_cast<unsigned short>(argsWithThis.size()), &result));
-  return ToJsiValue(ChakraObjectRef(result));
+  VerifyJsErrorElseThrow(
+      JsConstructObject(GetChakraObjectRef(func), argsWithThis.Data(), argsWithThis.Size(), &result));
+  return ToJsiValue(ChakraBorrowedRef(result));
 }
 
 facebook::jsi::Runtime::ScopeState *ChakraRuntime::pushScope() {
@@ -691,35 +688,71 @@ facebook::jsi::Value ChakraRuntime::ToJsiValue(ChakraObjectRef &&ref) {
   std::terminate();
 }
 
+#pragma warning(suppress : 4702) // unreachable code
+facebook::jsi::Value ChakraRuntime::ToJsiValue(ChakraBorrowedRef ref) {
+  JsValueType type;
+  VerifyJsErrorElseThrow(JsGetValueType(ref, &type));
+
+  switch (type) {
+    case JsUndefined: {
+      return facebook::jsi::Value::undefined();
+      break;
+    }
+    case JsNull: {
+      return facebook::jsi::Value::null();
+      break;
+    }
+    case JsNumber: {
+      double number;
+      VerifyJsErrorElseThrow(JsNumberToDouble(ref, &number));
+      return facebook::jsi::Value(number);
+      break;
+    }
+    case JsBoolean: {
+      bool b;
+      VerifyJsErrorElseThrow(JsBooleanToBool(ref, &b));
+      return facebook::jsi::Value(b);
+      break;
+    }
+    default: {
+      // The returned value owns a reference to strings, symbols and objects.
+      return ToJsiValue(ChakraObjectRef(ref));
+      break;
+    }
+  }
+
+  // Control flow should never reach here.
+  std::terminate();
+}
+
 ChakraObjectRef ChakraRuntime::ToChakraObjectRef(const facebook::jsi::Value &value) {
+  return ChakraObjectRef(ToChakraBorrowedRef(value));
+}
+
+ChakraBorrowedRef ChakraRuntime::ToChakraBorrowedRef(const facebook::jsi::Value &value) {
   if (value.isUndefined()) {
     JsValueRef ref;
     VerifyJsErrorElseThrow(JsGetUndefinedValue(&ref));
-    return ChakraObjectRef(ref);
+    return ChakraBorrowedRef(ref);
 
   } else if (value.isNull()) {
     JsValueRef ref;
     VerifyJsErrorElseThrow(JsGetNullValue(&ref));
-    return ChakraObjectRef(ref);
+    return ChakraBorrowedRef(ref);
 
   } else if (value.isBool()) {
     JsValueRef ref;
     VerifyJsErrorElseThrow(JsBoolToBoolean(value.getBool(), &ref));
-    return ChakraObjectRef(ref);
+    return ChakraBorrowedRef(ref);
 
   } else if (value.isNumber()) {
     JsValueRef ref;
     VerifyJsErrorElseThrow(JsDoubleToNumber(value.asNumber(), &ref));
-    return ChakraObjectRef(ref);
+    return ChakraBorrowedRef(ref);
 
-  } else if (value.isSymbol()) {
-    return GetChakraObjectRef(value.asSymbol(*this));
-
-  } else if (value.isString()) {
-    return GetChakraObjectRef(value.asString(*this));
-
-  } else if (value.isObject()) {
-    return GetChakraObjectRef(value.asObject(*this));
+  } else if (value.isSymbol() || value.isString() || value.isObject()) {
+    // Unlike asSymbol, asString and asObject, this does not copy the pointer.
+    return ChakraBorrowedRef(static_cast<const ChakraPointerValue *>(getPointerValue(value))->GetRef());
 
   } else {
     // Control flow should never reach here.
@@ -727,17 +760,6 @@ ChakraObjectRef ChakraRuntime::ToChakraObjectRef(const facebook::jsi::Value &val
   }
 }
 
-std::vector<ChakraObjectRef> ChakraRuntime::ToChakraObjectRefs(const facebook::jsi::Value *value, size_t count) {
-  std::vector<ChakraObjectRef> result{};
-
-  for (unsigned int i = 0; i < count; ++i) {
-    result.emplace_back(ToChakraObjectRef(*value));
-    ++value;
-  }
-
-  return result;
-}
-
 ChakraObjectRef ChakraRuntime::GetProperty(const ChakraObjectRef &obj, const ChakraObjectRef &id) {
   JsValueRef result = JS_INVALID_REFERENCE;
   VerifyJsErrorElseThrow(JsGetProperty(obj, id, &result));
@@ -754,33 +776,36 @@ JsValueRef CALLBACK ChakraRuntime::HostFunctionCall(
   ChakraRuntime &runtime = hostFuncProxy->GetRuntime();
   const facebook::jsi::HostFunctionType &hostFunc = hostFuncProxy->GetHostFunction();
 
-  constexpr uint32_t maxStackArgCount = 8;
-  facebook::jsi::Value stackArgs[maxStackArgCount];
+  facebook::jsi::Value stackArgs[g_maxStackArgCount];
   std::unique_ptr<facebook::jsi::Value[]> heapArgs = nullptr;
   facebook::jsi::Value *args = nullptr;
 
   // Accounting for 'this' object at 0
   unsigned short argumentCount = argumentCountIncThis - 1;
 
-  if (argumentCount > maxStackArgCount) {
+  // The engine keeps the arguments alive during the call, so that only the
+  // arguments that are stored in a jsi::Value as a pointer need a reference.
+  if (argumentCount > g_maxStackArgCount) {
     heapArgs = std::make_unique<facebook::jsi::Value[]>(argumentCount);
     for (size_t i = 1; i < argumentCountIncThis; i++) {
-      heapArgs[i - 1] = runtime.ToJsiValue(ChakraObjectRef(argumentsIncThis[i]));
+      heapArgs[i - 1] = runtime.ToJsiValue(ChakraBorrowedRef(argumentsIncThis[i]));
     }
     args = heapArgs.get();
 
   } else {
     for (size_t i = 1; i < argumentCountIncThis; i++) {
-      stackArgs[i - 1] = runtime.ToJsiValue(ChakraObjectRef(argumentsIncThis[i]));
+      stackArgs[i - 1] = runtime.ToJsiValue(ChakraBorrowedRef(argumentsIncThis[i]));
     }
     args = stackArgs;
   }
 
   JsValueRef result = JS_INVALID_REFERENCE;
-  facebook::jsi::Value thisVal = runtime.ToJsiValue(ChakraObjectRef(argumentsIncThis[0]));
+  facebook::jsi::Value thisVal = runtime.ToJsiValue(ChakraBorrowedRef(argumentsIncThis[0]));
 
   try {
-    result = runtime.ToChakraObjectRef(hostFunc(runtime, thisVal, args, argumentCount));
+    // The returned value is released after this statement, but result is on
+    // the stack until the engine takes it.
+    result = runtime.ToChakraBorrowedRef(hostFunc(runtime, thisVal, args, argumentCount));
 
   } catch (const facebook::jsi::JSError &error) {
     runtime.VerifyJsErrorElseThrow(JsSetException(runtime.ToChakraObjectRef(error.value())));
@@ -234,10 +234,17 @@ class ChakraRuntime : public facebook::jsi::Runtime {
     return static_cast<const ChakraPointerValue *>(getPointerValue(p))->GetRef();
   }
 
-  // These three functions only performs shallow copies.
+  // These functions only perform shallow copies.
   facebook::jsi::Value ToJsiValue(ChakraObjectRef &&ref);
   ChakraObjectRef ToChakraObjectRef(const facebook::jsi::Value &value);
-  std::vector<ChakraObjectRef> ToChakraObjectRefs(const facebook::jsi::Value *value, size_t count);
+
+  // Unlike the functions above, these do not add references to JS values that
+  // are not stored in the returned value. ToJsiValue only adds a reference when
+  // ref is a string, symbol or object. The reference returned by
+  // ToChakraBorrowedRef is valid as long as value is alive, or for primitive
+  // values, as long as it is stored on the stack.
+  facebook::jsi::Value ToJsiValue(ChakraBorrowedRef ref);
+  ChakraBorrowedRef ToChakraBorrowedRef(const facebook::jsi::Value &value);
 
   // Convenience functions for property access.
   ChakraObjectRef GetProperty(const ChakraObjectRef &obj, const ChakraObjectRef &id);
@@ -339,6 +346,10 @@ class ChakraRuntime : public facebook::jsi::Runtime {
   JsRuntimeHandle m_runtime;
   ChakraObjectRef m_context;
 
+  // The bootstrap function that collects the enumerable property names of an
+  // object.
+  ChakraObjectRef m_getPropertyNamesFunction;
+
   // Note: For simplicity, We are pinning the script and serialized script
   // buffers in the facebook::jsi::Runtime instance assuming as these buffers
   // are needed to stay alive for the lifetime of the facebook::jsi::Runtime
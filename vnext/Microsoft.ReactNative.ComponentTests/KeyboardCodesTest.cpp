@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Views/KeyboardCodes.h>
+
+namespace react::uwp {
+
+namespace {
+
+// Reference lookup with the semantics of the original linear search.
+std::string_view FindName(const VirtualKeyName *begin, const VirtualKeyName *end, uint32_t virtualKey) {
+  for (auto it = begin; it != end; ++it) {
+    if (it->virtualKey == virtualKey) {
+      return it->name;
+    }
+  }
+
+  return c_unidentifiedKey;
+}
+
+HandledKeyboardEvent MakeEvent(std::string_view code, HandledEventPhase phase) {
+  HandledKeyboardEvent event;
+  event.codeId = CodeToCodeId(code);
+  event.handledEventPhase = phase;
+  return event;
+}
+
+} // namespace
+
+TEST_CLASS (KeyboardCodesTest) {
+  TEST_METHOD(VirtualKeyToKey_MatchesLinearSearch) {
+    for (uint32_t virtualKey = 0; virtualKey < c_virtualKeyCount; ++virtualKey) {
+      TestCheckEqual(
+          FindName(std::begin(c_keyNames), std::end(c_keyNames), virtualKey), VirtualKeyToKey(virtualKey));
+    }
+  }
+
+  TEST_METHOD(VirtualKeyToCode_MatchesLinearSearch) {
+    for (uint32_t virtualKey = 0; virtualKey < c_virtualKeyCount; ++virtualKey) {
+      TestCheckEqual(
+          FindName(std::begin(c_codeNames), std::end(c_codeNames), virtualKey),
+          CodeIdToCode(VirtualKeyToCodeId(virtualKey)));
+    }
+  }
+
+  TEST_METHOD(VirtualKeyToKey_Alphanumeric) {
+    for (char c = '0'; c <= '9'; ++c) {
+      TestCheckEqual(std::string(1, c), VirtualKeyToKey(c));
+    }
+
+    for (char c = 'A'; c <= 'Z'; ++c) {
+      TestCheckEqual(std::string(1, c), VirtualKeyToKey(c));
+    }
+
+    // Virtual keys of lowercase letters are used by the numeric keypad.
+    TestCheckEqual("1", VirtualKeyToKey('a'));
+  }
+
+  TEST_METHOD(VirtualKeyToCode_Alphanumeric) {
+    for (char c = '0'; c <= '9'; ++c) {
+      TestCheckEqual("Digit" + std::string(1, c), CodeIdToCode(VirtualKeyToCodeId(c)));
+    }
+
+    for (char c = 'A'; c <= 'Z'; ++c) {
+      TestCheckEqual("Key" + std::string(1, c), CodeIdToCode(VirtualKeyToCodeId(c)));
+    }
+  }
+
+  TEST_METHOD(VirtualKey_FirstEntryWins) {
+    TestCheckEqual("HangulMode", VirtualKeyToKey(21));
+    TestCheckEqual("HanjaMode", VirtualKeyToKey(25));
+    TestCheckEqual("KanaMode", CodeIdToCode(VirtualKeyToCodeId(21)));
+    TestCheckEqual("Backquote", CodeIdToCode(VirtualKeyToCodeId(192)));
+  }
+
+  TEST_METHOD(VirtualKey_OutOfRange) {
+    TestCheckEqual(c_unidentifiedKey, VirtualKeyToKey(c_virtualKeyCount));
+    TestCheckEqual(c_unidentifiedCodeId, VirtualKeyToCodeId(c_virtualKeyCount));
+    TestCheckEqual(c_unidentifiedKey, VirtualKeyToKey(0xFFFFFFFF));
+  }
+
+  TEST_METHOD(CodeNames_AreUnique) {
+    for (size_t i = 0; i < std::size(c_codeNames); ++i) {
+      for (size_t j = i + 1; j < std::size(c_codeNames); ++j) {
+        TestCheck(c_codeNames[i].name != c_codeNames[j].name);
+      }
+    }
+  }
+
+  TEST_METHOD(CodeToCodeId_RoundTrips) {
+    TestCheckEqual(c_unidentifiedCodeId, CodeToCodeId(c_unidentifiedKey));
+    for (size_t codeId = 1; codeId <= std::size(c_codeNames); ++codeId) {
+      TestCheckEqual(codeId, CodeToCodeId(CodeIdToCode(static_cast<KeyboardCodeId>(codeId))));
+    }
+  }
+
+  TEST_METHOD(CodeToCodeId_Unknown) {
+    TestCheckEqual(c_unknownCodeId, CodeToCodeId("IntlBackslash"));
+    TestCheckEqual(c_unknownCodeId, CodeToCodeId(""));
+    TestCheckEqual(c_unidentifiedKey, CodeIdToCode(c_unknownCodeId));
+    for (uint32_t virtualKey = 0; virtualKey < c_virtualKeyCount; ++virtualKey) {
+      TestCheck(VirtualKeyToCodeId(virtualKey) != c_unknownCodeId);
+    }
+  }
+
+  TEST_METHOD(HandledKeyboardEventSet_Empty) {
+    HandledKeyboardEventSet events;
+    TestCheck(events.IsEmpty());
+    TestCheck(!events.Contains(MakeEvent("KeyA", HandledEventPhase::Bubbling)));
+  }
+
+  TEST_METHOD(HandledKeyboardEventSet_MatchesCodeModifiersAndPhase) {
+    HandledKeyboardEventSet events;
+    auto event = MakeEvent("KeyA", HandledEventPhase::Capturing);
+    event.ctrlKey = true;
+    events.Add(event);
+    TestCheck(!events.IsEmpty());
+    TestCheck(events.Contains(event));
+
+    auto otherCode = event;
+    otherCode.codeId = CodeToCodeId("KeyB");
+    TestCheck(!events.Contains(otherCode));
+
+    auto otherPhase = event;
+    otherPhase.handledEventPhase = HandledEventPhase::Bubbling;
+    TestCheck(!events.Contains(otherPhase));
+
+    for (int modifiers = 0; modifiers < 16; ++modifiers) {
+      auto otherModifiers = event;
+      otherModifiers.altKey = (modifiers & 1) != 0;
+      otherModifiers.ctrlKey = (modifiers & 2) != 0;
+      otherModifiers.metaKey = (modifiers & 4) != 0;
+      otherModifiers.shiftKey = (modifiers & 8) != 0;
+      TestCheckEqual(modifiers == 2, events.Contains(otherModifiers));
+    }
+
+    // The caps lock state does not take part in the match.
+    auto capLocked = event;
+    capLocked.capLocked = true;
+    TestCheck(events.Contains(capLocked));
+  }
+
+  TEST_METHOD(HandledKeyboardEventSet_UnknownCodeNeverMatches) {
+    HandledKeyboardEventSet events;
+    events.Add(MakeEvent("IntlBackslash", HandledEventPhase::Bubbling));
+    for (uint32_t virtualKey = 0; virtualKey < c_virtualKeyCount; ++virtualKey) {
+      HandledKeyboardEvent event;
+      event.codeId = VirtualKeyToCodeId(virtualKey);
+      TestCheck(!events.Contains(event));
+    }
+  }
+
+  TEST_METHOD(HandledKeyboardEventSet_Clear) {
+    HandledKeyboardEventSet events;
+    auto event = MakeEvent("Enter", HandledEventPhase::Bubbling);
+    events.Add(event);
+    events.Clear();
+    TestCheck(events.IsEmpty());
+    TestCheck(!events.Contains(event));
+  }
+};
+
+} // namespace react::uwp
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ReactModuleBuilderMock.h"
+
+#include <map>
+#include "NativeModules.h"
+
+namespace ReactNativeTests {
+
+REACT_MODULE(RegisteredModule)
+struct RegisteredModule {
+  REACT_METHOD(Add)
+  int Add(int x, int y) noexcept {
+    return x + y;
+  }
+};
+
+// The module is only created by the ModuleProvider_RecordsFirstUse test.
+REACT_MODULE(LazyRegisteredModule)
+struct LazyRegisteredModule {
+  LazyRegisteredModule() noexcept {
+    ++CreatedCount;
+  }
+
+  static int CreatedCount;
+};
+
+int LazyRegisteredModule::CreatedCount{0};
+
+struct ReactPackageBuilderMock : winrt::implements<ReactPackageBuilderMock, React::IReactPackageBuilder> {
+  void AddModule(winrt::hstring const &moduleName, React::ReactModuleProvider const &moduleProvider) noexcept {
+    Modules.emplace(std::wstring{moduleName}, moduleProvider);
+  }
+
+  void AddViewManager(
+      winrt::hstring const & /*viewManagerName*/,
+      React::ReactViewManagerProvider const & /*viewManagerProvider*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  std::multimap<std::wstring, React::ReactModuleProvider> Modules;
+};
+
+TEST_CLASS (ModuleRegistrationTest) {
+  TEST_METHOD(Find_RegisteredModule) {
+    auto reg = React::ModuleRegistration::Find(L"RegisteredModule");
+    TestCheck(reg != nullptr);
+    TestCheckEqual(std::wstring_view{L"RegisteredModule"}, std::wstring_view{reg->ModuleName()});
+  }
+
+  TEST_METHOD(Find_NotRegisteredModule) {
+    TestCheck(React::ModuleRegistration::Find(L"NotRegisteredModule") == nullptr);
+    TestCheck(React::ModuleRegistration::Find(L"RegisteredModul") == nullptr);
+    TestCheck(React::ModuleRegistration::Find(L"") == nullptr);
+  }
+
+  TEST_METHOD(Find_MatchesListOrder) {
+    // Find must return the first registration in the list with the same name.
+    for (auto const *reg = React::ModuleRegistration::Head(); reg != nullptr; reg = reg->Next()) {
+      auto const *first = React::ModuleRegistration::Head();
+      while (std::wstring_view{first->ModuleName()} != reg->ModuleName()) {
+        first = first->Next();
+      }
+
+      TestCheck(React::ModuleRegistration::Find(reg->ModuleName()) == first);
+    }
+  }
+
+  TEST_METHOD(TryAddAttributedModule_AddsModule) {
+    auto packageBuilder = winrt::make_self<ReactPackageBuilderMock>();
+    TestCheck(React::TryAddAttributedModule(packageBuilder.as<React::IReactPackageBuilder>(), L"RegisteredModule"));
+    TestCheckEqual(1u, packageBuilder->Modules.size());
+    TestCheckEqual(1u, packageBuilder->Modules.count(L"RegisteredModule"));
+  }
+
+  TEST_METHOD(TryAddAttributedModule_NotRegisteredModule) {
+    auto packageBuilder = winrt::make_self<ReactPackageBuilderMock>();
+    TestCheck(!React::TryAddAttributedModule(packageBuilder.as<React::IReactPackageBuilder>(), L"NotRegistered"));
+    TestCheck(packageBuilder->Modules.empty());
+  }
+
+  TEST_METHOD(AddAttributedModules_AddsAllModules) {
+    auto packageBuilder = winrt::make_self<ReactPackageBuilderMock>();
+    React::AddAttributedModules(packageBuilder.as<React::IReactPackageBuilder>());
+
+    size_t registrationCount = 0;
+    for (auto const *reg = React::ModuleRegistration::Head(); reg != nullptr; reg = reg->Next()) {
+      ++registrationCount;
+      TestCheck(packageBuilder->Modules.count(reg->ModuleName()) > 0);
+    }
+
+    TestCheckEqual(registrationCount, packageBuilder->Modules.size());
+  }
+
+  TEST_METHOD(ModuleProvider_RecordsFirstUse) {
+    auto reg = React::ModuleRegistration::Find(L"LazyRegisteredModule");
+    TestCheck(reg != nullptr);
+
+    auto packageBuilder = winrt::make_self<ReactPackageBuilderMock>();
+    React::AddAttributedModules(packageBuilder.as<React::IReactPackageBuilder>());
+    TestCheckEqual(0, LazyRegisteredModule::CreatedCount);
+    TestCheck(reg->FirstUseTime() == std::chrono::steady_clock::time_point{});
+
+    auto beforeFirstUse = std::chrono::steady_clock::now();
+    React::ReactModuleBuilderMock builderMock{};
+    auto moduleBuilder = winrt::make<React::ReactModuleBuilderImpl>(builderMock);
+    auto provider = packageBuilder->Modules.find(L"LazyRegisteredModule")->second;
+    builderMock.CreateModule(provider, moduleBuilder);
+    TestCheckEqual(1, LazyRegisteredModule::CreatedCount);
+
+    auto firstUseTime = reg->FirstUseTime();
+    TestCheck(firstUseTime >= beforeFirstUse);
+    TestCheck(firstUseTime <= std::chrono::steady_clock::now());
+
+    auto usedModules = React::GetAttributedModulesByFirstUse();
+    TestCheck(std::find(usedModules.begin(), usedModules.end(), reg) != usedModules.end());
+
+    // Creating the module again does not change its first use time.
+    builderMock.CreateModule(provider, moduleBuilder);
+    TestCheckEqual(2, LazyRegisteredModule::CreatedCount);
+    TestCheck(reg->FirstUseTime() == firstUseTime);
+  }
+};
+
+} // namespace ReactNativeTests
@@ -7,6 +7,33 @@
 
 using namespace winrt::Microsoft::ReactNative;
 
+struct ReactJSFunctionStub : implements<ReactJSFunctionStub, IReactJSFunction> {
+  ReactJSFunctionStub(hstring const &moduleName, hstring const &methodName) noexcept
+      : m_moduleName{moduleName}, m_methodName{methodName} {}
+
+  hstring ModuleName() noexcept {
+    return m_moduleName;
+  }
+
+  hstring MethodName() noexcept {
+    return m_methodName;
+  }
+
+  void Call(JSValueArgWriter const &paramsArgWriter) noexcept {
+    ++CallCount;
+    auto writer = MakeJSValueTreeWriter();
+    paramsArgWriter(writer);
+    Args = TakeJSValue(writer);
+  }
+
+  int CallCount{0};
+  JSValue Args;
+
+ private:
+  hstring m_moduleName;
+  hstring m_methodName;
+};
+
 struct ReactContextStub : implements<ReactContextStub, IReactContext> {
   IReactPropertyBag Properties() noexcept {
     VerifyElseCrashSz(false, "Not implemented");
@@ -53,6 +80,14 @@ struct ReactContextStub : implements<ReactContextStub, IReactContext> {
     Args = TakeJSValue(writer);
   }
 
+  IReactJSFunction GetJSFunction(hstring const &moduleName, hstring const &functionName) noexcept {
+    return winrt::make<ReactJSFunctionStub>(moduleName, functionName);
+  }
+
+  IReactJSFunction GetJSEvent(hstring const &eventEmitterName, hstring const &eventName) noexcept {
+    return winrt::make<ReactJSFunctionStub>(eventEmitterName, eventName);
+  }
+
   std::wstring Module;
   std::wstring Method;
   JSValue Args;
@@ -202,6 +237,49 @@ TEST_CLASS (ReactContextTest) {
     TestCheckEqual(10u, reactContextMock->Args[0]);
     TestCheckEqual(19, reactContextMock->Args[1]);
   }
+
+  TEST_METHOD(Test_GetJSFunction) {
+    auto reactContextMock = winrt::make_self<ReactContextStub>();
+    ReactContext context{reactContextMock.as<IReactContext>()};
+    auto jsFunction = context.GetJSFunction(L"module1", L"method1");
+    TestCheckEqual(L"module1", jsFunction.ModuleName());
+    TestCheckEqual(L"method1", jsFunction.MethodName());
+
+    auto jsFunctionStub = winrt::get_self<ReactJSFunctionStub>(jsFunction);
+    context.CallJSFunction(jsFunction);
+    TestCheckEqual(1, jsFunctionStub->CallCount);
+    TestCheckEqual(0u, jsFunctionStub->Args.AsArray().size());
+
+    context.CallJSFunction(jsFunction, 14, 17u);
+    TestCheckEqual(2, jsFunctionStub->CallCount);
+    TestCheckEqual(2u, jsFunctionStub->Args.AsArray().size());
+    TestCheckEqual(14, jsFunctionStub->Args[0]);
+    TestCheckEqual(17u, jsFunctionStub->Args[1]);
+
+    context.CallJSFunction(jsFunction, [](IJSValueWriter const &writer) {
+      writer.WriteArrayBegin();
+      WriteValue(writer, 10u);
+      writer.WriteArrayEnd();
+    });
+    TestCheckEqual(3, jsFunctionStub->CallCount);
+    TestCheckEqual(10u, jsFunctionStub->Args[0]);
+
+    // The function is called directly without going through the IReactContext.
+    TestCheck(reactContextMock->Module.empty());
+  }
+
+  TEST_METHOD(Test_GetJSEvent) {
+    auto reactContextMock = winrt::make_self<ReactContextStub>();
+    ReactContext context{reactContextMock.as<IReactContext>()};
+    auto jsEvent = context.GetJSEvent(L"module1", L"event1");
+    TestCheckEqual(L"module1", jsEvent.ModuleName());
+    TestCheckEqual(L"event1", jsEvent.MethodName());
+
+    auto jsEventStub = winrt::get_self<ReactJSFunctionStub>(jsEvent);
+    context.CallJSFunction(jsEvent, JSValueObject{{"prop1", 42}});
+    TestCheckEqual(1, jsEventStub->CallCount);
+    TestCheckEqual(42, jsEventStub->Args[0]["prop1"]);
+  }
 };
 
 } // namespace ReactNativeTests
@@ -160,4 +160,27 @@ void ReactContextMock::EmitJSEvent(
   m_builderMock->EmitJSEvent(eventEmitterName, eventName, paramsArgWriter);
 }
 
+IReactJSFunction ReactContextMock::GetJSFunction(hstring const &moduleName, hstring const &functionName) noexcept {
+  return make<ReactJSFunctionMock>(m_builderMock, moduleName, functionName, /*isEvent:*/ false);
+}
+
+IReactJSFunction ReactContextMock::GetJSEvent(hstring const &eventEmitterName, hstring const &eventName) noexcept {
+  return make<ReactJSFunctionMock>(m_builderMock, eventEmitterName, eventName, /*isEvent:*/ true);
+}
+
+ReactJSFunctionMock::ReactJSFunctionMock(
+    ReactModuleBuilderMock *builderMock,
+    hstring const &moduleName,
+    hstring const &methodName,
+    bool isEvent) noexcept
+    : m_builderMock{builderMock}, m_moduleName{moduleName}, m_methodName{methodName}, m_isEvent{isEvent} {}
+
+void ReactJSFunctionMock::Call(JSValueArgWriter const &paramsArgWriter) noexcept {
+  if (m_isEvent) {
+    m_builderMock->EmitJSEvent(m_moduleName, m_methodName, paramsArgWriter);
+  } else {
+    m_builderMock->CallJSFunction(m_moduleName, m_methodName, paramsArgWriter);
+  }
+}
+
 } // namespace winrt::Microsoft::ReactNative
@@ -142,8 +142,36 @@ struct ReactContextMock : implements<ReactContextMock, IReactContext> {
       hstring const &eventName,
       JSValueArgWriter const &paramsArgWriter) noexcept;
 
+  IReactJSFunction GetJSFunction(hstring const &moduleName, hstring const &functionName) noexcept;
+
+  IReactJSFunction GetJSEvent(hstring const &eventEmitterName, hstring const &eventName) noexcept;
+
+ private:
+  ReactModuleBuilderMock *m_builderMock;
+};
+
+struct ReactJSFunctionMock : implements<ReactJSFunctionMock, IReactJSFunction> {
+  ReactJSFunctionMock(
+      ReactModuleBuilderMock *builderMock,
+      hstring const &moduleName,
+      hstring const &methodName,
+      bool isEvent) noexcept;
+
+  hstring ModuleName() noexcept {
+    return m_moduleName;
+  }
+
+  hstring MethodName() noexcept {
+    return m_methodName;
+  }
+
+  void Call(JSValueArgWriter const &paramsArgWriter) noexcept;
+
  private:
   ReactModuleBuilderMock *m_builderMock;
+  hstring m_moduleName;
+  hstring m_methodName;
+  bool m_isEvent;
 };
 
 struct ReactModuleBuilderImpl : implements<ReactModuleBuilderImpl, IReactModuleBuilder> {
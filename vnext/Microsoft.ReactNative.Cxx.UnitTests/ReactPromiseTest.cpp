@@ -0,0 +1,265 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <ReactPromise.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "JSValue.h"
+
+#ifdef PERF_TESTS
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Counts the allocations made by the current thread while it is enabled.
+static thread_local bool s_countAllocations{false};
+static thread_local size_t s_allocationCount{0};
+
+void *operator new(size_t size) {
+  if (s_countAllocations) {
+    ++s_allocationCount;
+  }
+
+  if (void *ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+#endif // PERF_TESTS
+
+using namespace winrt::Microsoft::ReactNative;
+
+namespace ReactNativeTests {
+
+namespace {
+
+// Counts the calls of the promise callbacks and keeps the last result.
+struct PromiseCallbacks {
+  template <class T>
+  ReactPromise<T> MakePromise() noexcept {
+    return ReactPromise<T>{
+        MakeJSValueTreeWriter(),
+        [this](IJSValueWriter const &writer) noexcept {
+          ++ResolveCount;
+          Result = TakeJSValue(writer);
+        },
+        [this](IJSValueWriter const &writer) noexcept {
+          ++RejectCount;
+          Result = TakeJSValue(writer);
+        }};
+  }
+
+  int CallCount() const noexcept {
+    return ResolveCount + RejectCount;
+  }
+
+  std::atomic<int> ResolveCount{0};
+  std::atomic<int> RejectCount{0};
+  JSValue Result;
+};
+
+} // namespace
+
+TEST_CLASS (ReactPromiseTest) {
+  TEST_METHOD(Resolve_CallsResolveOnce) {
+    PromiseCallbacks callbacks;
+    {
+      auto promise = callbacks.MakePromise<int>();
+      promise.Resolve(42);
+      promise.Resolve(43);
+      promise.Reject("Too late");
+    }
+
+    TestCheckEqual(1, callbacks.ResolveCount.load());
+    TestCheckEqual(0, callbacks.RejectCount.load());
+    TestCheckEqual(42, callbacks.Result[0]);
+  }
+
+  TEST_METHOD(ResolveVoid_CallsResolveOnce) {
+    PromiseCallbacks callbacks;
+    {
+      auto promise = callbacks.MakePromise<void>();
+      promise.Resolve();
+      promise.Resolve();
+    }
+
+    TestCheckEqual(1, callbacks.ResolveCount.load());
+    TestCheckEqual(0, callbacks.RejectCount.load());
+  }
+
+  TEST_METHOD(Reject_WritesErrorObject) {
+    PromiseCallbacks callbacks;
+    {
+      auto promise = callbacks.MakePromise<int>();
+      promise.Reject(ReactError{"ECODE", "Error message", JSValueObject{{"prop1", 3}}});
+      promise.Resolve(42);
+    }
+
+    TestCheckEqual(0, callbacks.ResolveCount.load());
+    TestCheckEqual(1, callbacks.RejectCount.load());
+    TestCheckEqual("ECODE", callbacks.Result[0]["code"]);
+    TestCheckEqual("Error message", callbacks.Result[0]["message"]);
+    TestCheckEqual(3, callbacks.Result[0]["userInfo"]["prop1"]);
+  }
+
+  TEST_METHOD(Reject_WritesDefaultErrorObject) {
+    PromiseCallbacks callbacks;
+    callbacks.MakePromise<int>().Reject(ReactError{});
+
+    TestCheckEqual(1, callbacks.RejectCount.load());
+    TestCheckEqual("EUNSPECIFIED", callbacks.Result[0]["code"]);
+    TestCheckEqual("Error not specified.", callbacks.Result[0]["message"]);
+    TestCheck(callbacks.Result[0].TryGetObjectProperty("userInfo") != nullptr);
+  }
+
+  TEST_METHOD(Reject_WritesErrorMessage) {
+    PromiseCallbacks callbacks;
+    callbacks.MakePromise<int>().Reject(L"Wide error");
+
+    TestCheckEqual(1, callbacks.RejectCount.load());
+    TestCheckEqual("EUNSPECIFIED", callbacks.Result[0]["code"]);
+    TestCheckEqual("Wide error", callbacks.Result[0]["message"]);
+    TestCheck(callbacks.Result[0]["userInfo"].IsNull());
+  }
+
+  TEST_METHOD(Destroy_RejectsPendingPromise) {
+    PromiseCallbacks callbacks;
+    callbacks.MakePromise<int>();
+
+    TestCheckEqual(0, callbacks.ResolveCount.load());
+    TestCheckEqual(1, callbacks.RejectCount.load());
+    TestCheckEqual("Promise destroyed.", callbacks.Result[0]["message"]);
+  }
+
+  TEST_METHOD(Destroy_RejectsAfterLastCopy) {
+    PromiseCallbacks callbacks;
+    auto promise1 = std::make_unique<ReactPromise<int>>(callbacks.MakePromise<int>());
+    auto promise2 = std::make_unique<ReactPromise<int>>(*promise1);
+    auto promise3 = std::make_unique<ReactPromise<int>>(std::move(*promise2));
+
+    // The moved-from promise does not own the promise state anymore.
+    promise2.reset();
+    promise1.reset();
+    TestCheckEqual(0, callbacks.CallCount());
+
+    promise3.reset();
+    TestCheckEqual(1, callbacks.RejectCount.load());
+  }
+
+  TEST_METHOD(Move_KeepsPromisePending) {
+    PromiseCallbacks callbacks;
+    auto promise1 = callbacks.MakePromise<int>();
+    auto promise2 = std::move(promise1);
+
+    // Calls on the moved-from promise are ignored.
+    promise1.Resolve(1);
+    TestCheckEqual(0, callbacks.CallCount());
+
+    promise2.Resolve(2);
+    TestCheckEqual(1, callbacks.ResolveCount.load());
+    TestCheckEqual(2, callbacks.Result[0]);
+  }
+
+  TEST_METHOD(ResolveRejectDestroy_Race) {
+    constexpr int iterationCount = 200;
+    constexpr int threadCount = 8;
+
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+      PromiseCallbacks callbacks;
+      std::atomic<bool> start{false};
+      std::vector<std::thread> threads;
+      {
+        auto promise = callbacks.MakePromise<int>();
+        for (int i = 0; i < threadCount; ++i) {
+          threads.emplace_back([&start, promise, i]() noexcept {
+            while (!start) {
+              std::this_thread::yield();
+            }
+
+            // Each thread either resolves, rejects, or only destroys its copy.
+            switch (i % 3) {
+              case 0:
+                promise.Resolve(i);
+                break;
+              case 1:
+                promise.Reject("Rejected");
+                break;
+            }
+          });
+        }
+      }
+
+      start = true;
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      TestCheckEqual(1, callbacks.CallCount());
+    }
+  }
+
+  TEST_METHOD(ResolveDestroy_Race) {
+    constexpr int iterationCount = 1000;
+
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+      PromiseCallbacks callbacks;
+      auto promise = std::make_unique<ReactPromise<int>>(callbacks.MakePromise<int>());
+      std::thread resolveThread{[promise = *promise]() noexcept { promise.Resolve(1); }};
+      std::thread destroyThread{[&promise]() noexcept { promise.reset(); }};
+      resolveThread.join();
+      destroyThread.join();
+
+      // The promise is either resolved or rejected by the destruction of the last copy.
+      TestCheckEqual(1, callbacks.CallCount());
+    }
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(Promise_AllocationCount) {
+    constexpr int iterationCount = 100000;
+    auto writer = MakeJSValueTreeWriter();
+    MethodResultCallback resolve = [](IJSValueWriter const & /*writer*/) noexcept {};
+    MethodResultCallback reject = [](IJSValueWriter const & /*writer*/) noexcept {};
+
+    auto measure = [&](const char *name, auto &&usePromise) {
+      s_allocationCount = 0;
+      s_countAllocations = true;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterationCount; ++i) {
+        usePromise(ReactPromise<void>{writer, resolve, reject});
+      }
+
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      s_countAllocations = false;
+
+      std::ostringstream result;
+      result << name << ": " << static_cast<double>(s_allocationCount) / iterationCount << " allocations and "
+             << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterationCount
+             << " ns per promise\n";
+      std::cout << result.str();
+    };
+
+    measure("Moved promise", [](ReactPromise<void> &&promise) {
+      auto moved = std::move(promise);
+      moved.Resolve();
+    });
+
+    measure("Copied promise", [](ReactPromise<void> &&promise) {
+      auto copy = promise;
+      copy.Resolve();
+    });
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace ReactNativeTests
@@ -3,15 +3,59 @@
 
 #include "pch.h"
 #include "ModuleRegistration.h"
+#include <algorithm>
 
 namespace winrt::Microsoft::ReactNative {
 
+namespace {
+
+// All registrations sorted by module name. Registrations with the same name keep
+// their list order, so that the lookup finds the same registration as the list walk.
+std::vector<ModuleRegistration const *> MakeModuleRegistrationIndex() noexcept {
+  std::vector<ModuleRegistration const *> index;
+  for (auto const *reg = ModuleRegistration::Head(); reg != nullptr; reg = reg->Next()) {
+    index.push_back(reg);
+  }
+
+  std::stable_sort(index.begin(), index.end(), [](ModuleRegistration const *left, ModuleRegistration const *right) {
+    return std::wstring_view{left->ModuleName()} < std::wstring_view{right->ModuleName()};
+  });
+  return index;
+}
+
+} // namespace
+
 const ModuleRegistration *ModuleRegistration::s_head{nullptr};
 
 ModuleRegistration::ModuleRegistration(wchar_t const *moduleName) noexcept : m_moduleName{moduleName}, m_next{s_head} {
   s_head = this;
 }
 
+/*static*/ ModuleRegistration const *ModuleRegistration::Find(std::wstring_view moduleName) noexcept {
+  // Modules are registered by static initializers, so the index is complete when it is first used.
+  static const std::vector<ModuleRegistration const *> index = MakeModuleRegistrationIndex();
+
+  auto it = std::lower_bound(
+      index.begin(), index.end(), moduleName, [](ModuleRegistration const *reg, std::wstring_view name) {
+        return std::wstring_view{reg->ModuleName()} < name;
+      });
+  return (it != index.end() && moduleName == (*it)->ModuleName()) ? *it : nullptr;
+}
+
+std::chrono::steady_clock::time_point ModuleRegistration::FirstUseTime() const noexcept {
+  return std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{m_firstUseTicks.load()}};
+}
+
+void ModuleRegistration::RecordFirstUse() const noexcept {
+  if (m_firstUseTicks.load(std::memory_order_relaxed) == 0) {
+    // Zero ticks means that the module was never used.
+    auto ticks = std::max<std::chrono::steady_clock::rep>(
+        std::chrono::steady_clock::now().time_since_epoch().count(), 1);
+    std::chrono::steady_clock::rep unused{0};
+    m_firstUseTicks.compare_exchange_strong(unused, ticks);
+  }
+}
+
 void AddAttributedModules(IReactPackageBuilder const &packageBuilder) noexcept {
   for (auto const *reg = ModuleRegistration::Head(); reg != nullptr; reg = reg->Next()) {
     packageBuilder.AddModule(reg->ModuleName(), reg->MakeModuleProvider());
@@ -19,13 +63,26 @@ void AddAttributedModules(IReactPackageBuilder const &packageBuilder) noexcept {
 }
 
 bool TryAddAttributedModule(IReactPackageBuilder const &packageBuilder, std::wstring_view moduleName) noexcept {
+  if (auto const *reg = ModuleRegistration::Find(moduleName)) {
+    packageBuilder.AddModule(moduleName, reg->MakeModuleProvider());
+    return true;
+  }
+
+  return false;
+}
+
+std::vector<ModuleRegistration const *> GetAttributedModulesByFirstUse() noexcept {
+  std::vector<ModuleRegistration const *> result;
   for (auto const *reg = ModuleRegistration::Head(); reg != nullptr; reg = reg->Next()) {
-    if (moduleName == reg->ModuleName()) {
-      packageBuilder.AddModule(moduleName, reg->MakeModuleProvider());
-      return true;
+    if (reg->FirstUseTime() != std::chrono::steady_clock::time_point{}) {
+      result.push_back(reg);
     }
   }
-  return false;
+
+  std::stable_sort(result.begin(), result.end(), [](ModuleRegistration const *left, ModuleRegistration const *right) {
+    return left->FirstUseTime() < right->FirstUseTime();
+  });
+  return result;
 }
 
 } // namespace winrt::Microsoft::ReactNative
@@ -2,6 +2,10 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <string_view>
+#include <vector>
 #include "winrt/Microsoft.ReactNative.h"
 
 // We implement optional parameter macros based on the StackOverflow discussion:
@@ -23,7 +27,10 @@
     moduleStruct##_ModuleRegistration() noexcept : winrt::Microsoft::ReactNative::ModuleRegistration{moduleName} {} \
                                                                                                                     \
     winrt::Microsoft::ReactNative::ReactModuleProvider MakeModuleProvider() const noexcept override {               \
-      return winrt::Microsoft::ReactNative::MakeModuleProvider<moduleStruct>();                                     \
+      return [this](winrt::Microsoft::ReactNative::IReactModuleBuilder const &moduleBuilder) noexcept {             \
+        RecordFirstUse();                                                                                           \
+        return winrt::Microsoft::ReactNative::CreateReactModule<moduleStruct>(moduleBuilder);                       \
+      };                                                                                                            \
     }                                                                                                               \
                                                                                                                     \
     static const moduleStruct##_ModuleRegistration Registration;                                                    \
@@ -90,9 +97,22 @@ struct ModuleRegistration {
     return m_moduleName;
   }
 
+  // Find the registration of the module with moduleName or return nullptr.
+  // The lookup uses an index sorted by module name that is built on first use.
+  static ModuleRegistration const *Find(std::wstring_view moduleName) noexcept;
+
+  // The time when the module was created for the first time.
+  // It is a default constructed time_point if the module was never created.
+  std::chrono::steady_clock::time_point FirstUseTime() const noexcept;
+
+ protected:
+  // Called by the module providers when they create the module.
+  void RecordFirstUse() const noexcept;
+
  private:
   wchar_t const *m_moduleName{nullptr};
   ModuleRegistration const *m_next{nullptr};
+  mutable std::atomic<std::chrono::steady_clock::rep> m_firstUseTicks{0};
 
   static const ModuleRegistration *s_head;
 };
@@ -101,4 +121,8 @@ void AddAttributedModules(IReactPackageBuilder const &packageBuilder) noexcept;
 
 bool TryAddAttributedModule(IReactPackageBuilder const &packageBuilder, std::wstring_view moduleName) noexcept;
 
+// Get the attributed modules created so far in the order of their first use.
+// It can be used to make a startup profile of the modules to create eagerly.
+std::vector<ModuleRegistration const *> GetAttributedModulesByFirstUse() noexcept;
+
 } // namespace winrt::Microsoft::ReactNative
@@ -1162,16 +1162,20 @@ struct ReactModuleTraits {
   static constexpr FactoryType *Factory = GetReactModuleFactory((TModule *)nullptr, 0);
 };
 
+// Create a TModule instance and register its members with the moduleBuilder.
+template <class TModule>
+inline winrt::Windows::Foundation::IInspectable CreateReactModule(IReactModuleBuilder const &moduleBuilder) noexcept {
+  auto [moduleWrapper, module] = ReactModuleTraits<TModule>::Factory();
+  ReactModuleBuilder builder{module, moduleBuilder};
+  GetReactModuleInfo(module, builder);
+  builder.CompleteRegistration();
+  return moduleWrapper;
+}
+
 // Create a module provider for TModule type.
 template <class TModule>
 inline ReactModuleProvider MakeModuleProvider() noexcept {
-  return [](IReactModuleBuilder const &moduleBuilder) noexcept {
-    auto [moduleWrapper, module] = ReactModuleTraits<TModule>::Factory();
-    ReactModuleBuilder builder{module, moduleBuilder};
-    GetReactModuleInfo(module, builder);
-    builder.CompleteRegistration();
-    return moduleWrapper;
-  };
+  return [](IReactModuleBuilder const &moduleBuilder) noexcept { return CreateReactModule<TModule>(moduleBuilder); };
 }
 
 // Create a module provider for TModule type that satisfies the TModuleSpec.
@@ -62,6 +62,24 @@ struct ReactContext {
     m_handle.EmitJSEvent(eventEmitterName, eventName, MakeJSValueArgWriter(std::forward<TArgs>(args)...));
   }
 
+  // Get methodName JS function of module with moduleName to call it many times with CallJSFunction.
+  // It avoids the name conversions done by each CallJSFunction call with module and method names.
+  IReactJSFunction GetJSFunction(std::wstring_view moduleName, std::wstring_view methodName) const noexcept {
+    return m_handle.GetJSFunction(moduleName, methodName);
+  }
+
+  // Get eventName JS event of module with eventEmitterName to raise it many times with CallJSFunction.
+  IReactJSFunction GetJSEvent(std::wstring_view eventEmitterName, std::wstring_view eventName) const noexcept {
+    return m_handle.GetJSEvent(eventEmitterName, eventName);
+  }
+
+  // Call JS function or raise JS event returned by GetJSFunction or GetJSEvent.
+  // args are either function arguments or a single lambda with 'IJSValueWriter const&' argument.
+  template <class... TArgs>
+  void CallJSFunction(IReactJSFunction const &jsFunction, TArgs &&... args) const noexcept {
+    jsFunction.Call(MakeJSValueArgWriter(std::forward<TArgs>(args)...));
+  }
+
 #ifndef CORE_ABI
   // Dispatch eventName event to the view.
   // args are either function arguments or a single lambda with 'IJSValueWriter const&' argument.
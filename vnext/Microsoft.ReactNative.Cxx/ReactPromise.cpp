@@ -4,97 +4,101 @@
 #include "pch.h"
 #include "ReactPromise.h"
 #include "JSValueWriter.h"
+#include <utility>
 
 namespace winrt::Microsoft::ReactNative {
 
-static const char *ErrorDefaultCode = "EUNSPECIFIED";
-static const char *ErrorDefaultMessage = "Error not specified.";
+// The strings are wide to pass them to the IJSValueWriter without conversion.
+static constexpr std::wstring_view ErrorDefaultCode = L"EUNSPECIFIED";
+static constexpr std::wstring_view ErrorDefaultMessage = L"Error not specified.";
 
-// Keys for m_reject's Error object
-static const char *ErrorMapKeyCode = "code";
-static const char *ErrorMapKeyMessage = "message";
-static const char *ErrorMapKeyUserInfo = "userInfo";
+// Keys for the reject callback's Error object
+static constexpr std::wstring_view ErrorMapKeyCode = L"code";
+static constexpr std::wstring_view ErrorMapKeyMessage = L"message";
+static constexpr std::wstring_view ErrorMapKeyUserInfo = L"userInfo";
 
 ReactPromiseBase::ReactPromiseBase(
     IJSValueWriter const &writer,
     MethodResultCallback const &resolve,
     MethodResultCallback const &reject) noexcept
-    : m_state{new std::atomic<State>{State::Pending}}, m_writer{writer}, m_resolve{resolve}, m_reject{reject} {}
+    : m_block{new ControlBlock{writer, resolve, reject}} {}
+
+ReactPromiseBase::ReactPromiseBase(ReactPromiseBase const &other) noexcept : m_block{other.m_block} {
+  if (m_block) {
+    m_block->RefCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+ReactPromiseBase::ReactPromiseBase(ReactPromiseBase &&other) noexcept
+    : m_block{std::exchange(other.m_block, nullptr)} {}
 
 ReactPromiseBase::~ReactPromiseBase() noexcept {
-  if (m_state.use_count() == 1) {
+  if (m_block && m_block->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
     Reject(L"Promise destroyed.");
+    delete m_block;
   }
 }
 
 // Reject the ReactPromise and report an error.
 void ReactPromiseBase::Reject(ReactError const &error) const noexcept {
-  if (TrySetState(State::Rejected)) {
-    m_writer.WriteArrayBegin();
-    m_writer.WriteObjectBegin();
-
+  RejectWith([&error](IJSValueWriter const &writer) noexcept {
     if (!error.Code.empty()) {
-      WriteProperty(m_writer, ErrorMapKeyCode, error.Code);
+      WriteProperty(writer, ErrorMapKeyCode, error.Code);
     } else {
-      WriteProperty(m_writer, ErrorMapKeyCode, ErrorDefaultCode);
+      WriteProperty(writer, ErrorMapKeyCode, ErrorDefaultCode);
     }
 
     if (!error.Message.empty()) {
-      WriteProperty(m_writer, ErrorMapKeyMessage, error.Message);
+      WriteProperty(writer, ErrorMapKeyMessage, error.Message);
     } else {
-      WriteProperty(m_writer, ErrorMapKeyMessage, ErrorDefaultMessage);
+      WriteProperty(writer, ErrorMapKeyMessage, ErrorDefaultMessage);
     }
 
-    // For consistency with iOS ensure userInfo key exists, even if we null it.
-    // iOS: /React/Base/RCTUtils.m -> RCTJSErrorFromCodeMessageAndNSError
-    WriteProperty(m_writer, ErrorMapKeyUserInfo, error.UserInfo);
-
-    m_writer.WriteObjectEnd();
-    m_writer.WriteArrayEnd();
-    m_reject(m_writer);
-  }
+    WriteProperty(writer, ErrorMapKeyUserInfo, error.UserInfo);
+  });
 }
 
 void ReactPromiseBase::Reject(char const *errorMessage) const noexcept {
-  if (TrySetState(State::Rejected)) {
-    m_writer.WriteArrayBegin();
-    m_writer.WriteObjectBegin();
-
-    WriteProperty(m_writer, ErrorMapKeyCode, ErrorDefaultCode);
-    WriteProperty(m_writer, ErrorMapKeyMessage, errorMessage);
-
-    // For consistency with iOS ensure userInfo key exists, even if we null it.
-    // iOS: /React/Base/RCTUtils.m -> RCTJSErrorFromCodeMessageAndNSError
-    WriteProperty(m_writer, ErrorMapKeyUserInfo, nullptr);
-
-    m_writer.WriteObjectEnd();
-    m_writer.WriteArrayEnd();
-    m_reject(m_writer);
-  }
+  RejectWith([errorMessage](IJSValueWriter const &writer) noexcept {
+    WriteProperty(writer, ErrorMapKeyCode, ErrorDefaultCode);
+    WriteProperty(writer, ErrorMapKeyMessage, errorMessage);
+    WriteProperty(writer, ErrorMapKeyUserInfo, nullptr);
+  });
 }
 
 void ReactPromiseBase::Reject(wchar_t const *errorMessage) const noexcept {
-  if (TrySetState(State::Rejected)) {
-    m_writer.WriteArrayBegin();
-    m_writer.WriteObjectBegin();
-
-    WriteProperty(m_writer, ErrorMapKeyCode, ErrorDefaultCode);
-    WriteProperty(m_writer, ErrorMapKeyMessage, errorMessage);
-
-    // For consistency with iOS ensure userInfo key exists, even if we null it.
-    // iOS: /React/Base/RCTUtils.m -> RCTJSErrorFromCodeMessageAndNSError
-    WriteProperty(m_writer, ErrorMapKeyUserInfo, nullptr);
+  RejectWith([errorMessage](IJSValueWriter const &writer) noexcept {
+    WriteProperty(writer, ErrorMapKeyCode, ErrorDefaultCode);
+    WriteProperty(writer, ErrorMapKeyMessage, errorMessage);
+    WriteProperty(writer, ErrorMapKeyUserInfo, nullptr);
+  });
+}
 
-    m_writer.WriteObjectEnd();
-    m_writer.WriteArrayEnd();
-    m_reject(m_writer);
+// Write the Error object properties with writeError and call the reject callback.
+// For consistency with iOS the userInfo key must exist, even if it is null.
+// iOS: /React/Base/RCTUtils.m -> RCTJSErrorFromCodeMessageAndNSError
+template <class TWriteError>
+void ReactPromiseBase::RejectWith(TWriteError const &writeError) const noexcept {
+  if (TrySetState(State::Rejected)) {
+    auto const &writer = Writer();
+    writer.WriteArrayBegin();
+    writer.WriteObjectBegin();
+    writeError(writer);
+    writer.WriteObjectEnd();
+    writer.WriteArrayEnd();
+    RejectCallback()(writer);
   }
 }
 
 bool ReactPromiseBase::TrySetState(State newState) const noexcept {
-  auto state = m_state->load(std::memory_order_relaxed);
+  if (!m_block) {
+    return false; // The promise was moved.
+  }
+
+  auto &promiseState = m_block->PromiseState;
+  auto state = promiseState.load(std::memory_order_relaxed);
   while (state == State::Pending) {
-    if (m_state->compare_exchange_weak(state, newState, std::memory_order_release, std::memory_order_relaxed)) {
+    if (promiseState.compare_exchange_weak(state, newState, std::memory_order_release, std::memory_order_relaxed)) {
       return true;
     }
   }
@@ -104,9 +108,9 @@ bool ReactPromiseBase::TrySetState(State newState) const noexcept {
 
 // Successfully resolve the ReactPromise<void>.
 void ReactPromise<void>::Resolve() const noexcept {
-  if (TrySetState(State::Resolved) && m_resolve) {
-    WriteArgs(m_writer, nullptr);
-    m_resolve(m_writer);
+  if (TrySetState(State::Resolved) && ResolveCallback()) {
+    WriteArgs(Writer(), nullptr);
+    ResolveCallback()(Writer());
   }
 }
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <atomic>
 #include "ReactError.h"
 #include "winrt/Microsoft.ReactNative.h"
 
@@ -13,13 +14,21 @@ namespace winrt::Microsoft::ReactNative {
 // Methods with REACT_METHOD attribute that use an ReactPromise as the last parameter
 // will be marked as "promise" and will return a promise when invoked from JavaScript.
 
-// Base class that does not depend on template parameter T
+// Base class that does not depend on template parameter T.
+// All copies of a promise share one control block with the promise state, the writer and the callbacks.
+// It is allocated once per method call and it is reference counted only when the promise is copied.
+// The promise is rejected when the last copy is destroyed without resolving or rejecting it.
 struct ReactPromiseBase {
   ReactPromiseBase(
       IJSValueWriter const &writer,
       MethodResultCallback const &resolve,
       MethodResultCallback const &reject) noexcept;
 
+  ReactPromiseBase(ReactPromiseBase const &other) noexcept;
+  ReactPromiseBase(ReactPromiseBase &&other) noexcept;
+  ReactPromiseBase &operator=(ReactPromiseBase const &other) = delete;
+  ReactPromiseBase &operator=(ReactPromiseBase &&other) = delete;
+
   ~ReactPromiseBase() noexcept;
 
   // Report an Error.
@@ -30,14 +39,43 @@ struct ReactPromiseBase {
  protected:
   enum class State { Pending, Resolved, Rejected };
 
+  struct ControlBlock {
+    ControlBlock(
+        IJSValueWriter const &writer,
+        MethodResultCallback const &resolve,
+        MethodResultCallback const &reject) noexcept
+        : Writer{writer}, Resolve{resolve}, Reject{reject} {}
+
+    std::atomic<uint32_t> RefCount{1};
+    std::atomic<State> PromiseState{State::Pending};
+    const IJSValueWriter Writer;
+    const MethodResultCallback Resolve;
+    const MethodResultCallback Reject;
+  };
+
  protected:
   bool TrySetState(State newState) const noexcept;
 
- protected:
-  const std::shared_ptr<std::atomic<State>> m_state;
-  const IJSValueWriter m_writer;
-  const MethodResultCallback m_resolve;
-  const MethodResultCallback m_reject;
+  // The writer and the callbacks must only be used after a successful TrySetState call.
+  IJSValueWriter const &Writer() const noexcept {
+    return m_block->Writer;
+  }
+
+  MethodResultCallback const &ResolveCallback() const noexcept {
+    return m_block->Resolve;
+  }
+
+  MethodResultCallback const &RejectCallback() const noexcept {
+    return m_block->Reject;
+  }
+
+ private:
+  template <class TWriteError>
+  void RejectWith(TWriteError const &writeError) const noexcept;
+
+ private:
+  // It is null only in a moved-from promise.
+  ControlBlock *m_block;
 };
 
 template <class T>
@@ -59,9 +97,9 @@ struct ReactPromise<void> : ReactPromiseBase {
 // Successfully resolve the ReactPromise with an optional value.
 template <class T>
 void ReactPromise<T>::Resolve(T const &value) const noexcept {
-  if (TrySetState(State::Resolved) && m_resolve) {
-    WriteArgs(m_writer, value);
-    m_resolve(m_writer);
+  if (TrySetState(State::Resolved) && ResolveCallback()) {
+    WriteArgs(Writer(), value);
+    ResolveCallback()(Writer());
   }
 }
 
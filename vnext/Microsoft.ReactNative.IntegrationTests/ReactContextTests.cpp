@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <NativeModules.h>
+#include <winrt/Windows.System.h>
+#include <chrono>
+#include <sstream>
+
+using namespace React;
+
+namespace ReactNativeIntegrationTests {
+
+REACT_MODULE(ReactContextTestModule)
+struct ReactContextTestModule {
+  REACT_INIT(Initialize)
+  void Initialize(ReactContext const &reactContext) noexcept {
+    ReactContextTestModule::Context.set_value(reactContext);
+  }
+
+  REACT_METHOD(Start, L"start")
+  void Start() noexcept {
+    // Native modules are created on-demand.
+    // This method is used to start loading the module from JavaScript.
+  }
+
+  REACT_METHOD(ReportRecorded, L"reportRecorded")
+  void ReportRecorded(int count, bool inOrder) noexcept {
+    ReactContextTestModule::Recorded.set_value({count, inOrder});
+  }
+
+  static std::promise<ReactContext> Context;
+  static std::promise<std::pair<int, bool>> Recorded;
+};
+
+std::promise<ReactContext> ReactContextTestModule::Context;
+std::promise<std::pair<int, bool>> ReactContextTestModule::Recorded;
+
+struct ReactContextTestPackageProvider : winrt::implements<ReactContextTestPackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    TryAddAttributedModule(packageBuilder, L"ReactContextTestModule");
+  }
+};
+
+// Loads the ReactContextTests bundle and stops the React instance when destroyed.
+struct ReactContextTestHost {
+  ReactContextTestHost() noexcept {
+    ReactContextTestModule::Context = {};
+    ReactContextTestModule::Recorded = {};
+
+    m_queueController.DispatcherQueue().TryEnqueue([&]() noexcept {
+      m_host.PackageProviders().Append(winrt::make<ReactContextTestPackageProvider>());
+
+      // bundle is assumed to be co-located with the test binary
+      wchar_t testBinaryPath[MAX_PATH];
+      TestCheck(GetModuleFileNameW(NULL, testBinaryPath, MAX_PATH) < MAX_PATH);
+      testBinaryPath[std::wstring_view{testBinaryPath}.rfind(L"\\")] = 0;
+
+      m_host.InstanceSettings().BundleRootPath(testBinaryPath);
+      m_host.InstanceSettings().JavaScriptBundleFile(L"ReactContextTests");
+      m_host.InstanceSettings().UseDeveloperSupport(false);
+      m_host.InstanceSettings().UseWebDebugger(false);
+      m_host.InstanceSettings().UseFastRefresh(false);
+      m_host.InstanceSettings().UseLiveReload(false);
+      m_host.InstanceSettings().EnableDeveloperMenu(false);
+
+      m_host.LoadInstance();
+    });
+  }
+
+  ~ReactContextTestHost() noexcept {
+    m_host.UnloadInstance().get();
+    m_queueController.ShutdownQueueAsync().get();
+  }
+
+ private:
+  winrt::Microsoft::ReactNative::ReactNativeHost m_host{};
+  winrt::Windows::System::DispatcherQueueController m_queueController{
+      winrt::Windows::System::DispatcherQueueController::CreateOnDedicatedThread()};
+};
+
+TEST_CLASS (ReactContextTests) {
+  TEST_METHOD(GetJSFunction_ReturnsCachedFunction) {
+    ReactContextTestHost host;
+    ReactContext context = ReactContextTestModule::Context.get_future().get();
+
+    auto record = context.GetJSFunction(L"ReactContextTestsFunctions", L"record");
+    TestCheckEqual(L"ReactContextTestsFunctions", record.ModuleName());
+    TestCheckEqual(L"record", record.MethodName());
+    TestCheck(record == context.GetJSFunction(L"ReactContextTestsFunctions", L"record"));
+    TestCheck(record != context.GetJSFunction(L"ReactContextTestsFunctions", L"report"));
+    TestCheck(record != context.GetJSFunction(L"ReactContextTestsFunctions2", L"record"));
+
+    // The separator between the names keeps different name pairs apart.
+    TestCheck(context.GetJSFunction(L"ab", L"c") != context.GetJSFunction(L"a", L"bc"));
+  }
+
+  TEST_METHOD(GetJSEvent_ReturnsCachedEvent) {
+    ReactContextTestHost host;
+    ReactContext context = ReactContextTestModule::Context.get_future().get();
+
+    auto jsEvent = context.GetJSEvent(L"RCTDeviceEventEmitter", L"testEvent");
+    TestCheckEqual(L"RCTDeviceEventEmitter", jsEvent.ModuleName());
+    TestCheckEqual(L"testEvent", jsEvent.MethodName());
+    TestCheck(jsEvent == context.GetJSEvent(L"RCTDeviceEventEmitter", L"testEvent"));
+    TestCheck(jsEvent != context.GetJSEvent(L"RCTDeviceEventEmitter", L"testEvent2"));
+
+    // Events and functions with the same names are different.
+    TestCheck(jsEvent != context.GetJSFunction(L"RCTDeviceEventEmitter", L"testEvent"));
+  }
+
+  TEST_METHOD(GetJSFunction_CallsInOrder) {
+    ReactContextTestHost host;
+    ReactContext context = ReactContextTestModule::Context.get_future().get();
+
+    constexpr int callCount = 1000;
+    auto record = context.GetJSFunction(L"ReactContextTestsFunctions", L"record");
+    for (int i = 0; i < callCount; ++i) {
+      context.CallJSFunction(record, i);
+    }
+
+    context.CallJSFunction(L"ReactContextTestsFunctions", L"report");
+    auto recorded = ReactContextTestModule::Recorded.get_future().get();
+    TestCheckEqual(callCount, recorded.first);
+    TestCheck(recorded.second);
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(GetJSFunction_EventsPerSecond) {
+    constexpr int callCount = 100000;
+    using clock = std::chrono::steady_clock;
+
+    // makeCall returns a function that makes one call to ReactContextTestsFunctions.record.
+    auto measure = [&](const wchar_t *name, auto &&makeCall) {
+      ReactContextTestHost host;
+      ReactContext context = ReactContextTestModule::Context.get_future().get();
+      std::function<void(int)> call = makeCall(context);
+
+      auto start = clock::now();
+      for (int i = 0; i < callCount; ++i) {
+        call(i);
+      }
+
+      context.CallJSFunction(L"ReactContextTestsFunctions", L"report");
+      auto recorded = ReactContextTestModule::Recorded.get_future().get();
+      auto elapsed = std::chrono::duration<double>(clock::now() - start).count();
+      TestCheckEqual(callCount, recorded.first);
+      TestCheck(recorded.second);
+
+      std::wstringstream result;
+      result << name << L": " << static_cast<int64_t>(callCount / elapsed) << L" calls per second\n";
+      OutputDebugStringW(result.str().c_str());
+    };
+
+    measure(L"CallJSFunction with names", [](ReactContext const &context) {
+      return [context](int i) { context.CallJSFunction(L"ReactContextTestsFunctions", L"record", i); };
+    });
+
+    measure(L"CallJSFunction with IReactJSFunction", [](ReactContext const &context) {
+      return [context, record = context.GetJSFunction(L"ReactContextTestsFunctions", L"record")](int i) {
+        context.CallJSFunction(record, i);
+      };
+    });
+  }
+#endif // PERF_TESTS
+};
+
+} // namespace ReactNativeIntegrationTests
@@ -0,0 +1,23 @@
+import { NativeModules } from 'react-native';
+
+class ReactContextTestsFunctions {
+    constructor() {
+        this.nextValue = 0;
+        this.inOrder = true;
+    }
+
+    // A sequence of recorded values starts with 0.
+    record(value) {
+        this.inOrder = value === 0 || (this.inOrder && value === this.nextValue);
+        this.nextValue = value + 1;
+    }
+
+    report() {
+        NativeModules.ReactContextTestModule.reportRecorded(this.nextValue, this.inOrder);
+    }
+}
+
+global.__fbBatchedBridge.registerLazyCallableModule('ReactContextTestsFunctions', () => new ReactContextTestsFunctions());
+
+// Native modules are created on demand from JavaScript code.
+NativeModules.ReactContextTestModule.start();
@@ -332,5 +332,45 @@ namespace Microsoft.ReactNative.Managed.UnitTests
     {
       m_builder.EmitJSEvent(eventEmitterName, eventName, paramsArgWriter);
     }
+
+    public IReactJSFunction GetJSFunction(string moduleName, string functionName)
+    {
+      return new ReactJSFunctionMock(m_builder, moduleName, functionName, isEvent: false);
+    }
+
+    public IReactJSFunction GetJSEvent(string eventEmitterName, string eventName)
+    {
+      return new ReactJSFunctionMock(m_builder, eventEmitterName, eventName, isEvent: true);
+    }
+  }
+
+  class ReactJSFunctionMock : IReactJSFunction
+  {
+    private readonly ReactModuleBuilderMock m_builder;
+    private readonly bool m_isEvent;
+
+    public ReactJSFunctionMock(ReactModuleBuilderMock builder, string moduleName, string methodName, bool isEvent)
+    {
+      m_builder = builder;
+      ModuleName = moduleName;
+      MethodName = methodName;
+      m_isEvent = isEvent;
+    }
+
+    public string ModuleName { get; }
+
+    public string MethodName { get; }
+
+    public void Call(JSValueArgWriter paramsArgWriter)
+    {
+      if (m_isEvent)
+      {
+        m_builder.EmitJSEvent(ModuleName, MethodName, paramsArgWriter);
+      }
+      else
+      {
+        m_builder.CallJSFunction(ModuleName, MethodName, paramsArgWriter);
+      }
+    }
   }
 }
@@ -30,6 +30,12 @@ namespace winrt::Microsoft::ReactNative {
 
 DynamicReader::DynamicReader(const folly::dynamic &root) noexcept : m_current{&root} {}
 
+void DynamicReader::Reset(const folly::dynamic &root) noexcept {
+  m_current = &root;
+  m_isIterating = false;
+  m_stack.clear();
+}
+
 JSValueType DynamicReader::ValueType() noexcept {
   switch (m_current->type()) {
     case folly::dynamic::Type::NULLT:
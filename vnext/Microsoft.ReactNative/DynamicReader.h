@@ -11,6 +11,9 @@ namespace winrt::Microsoft::ReactNative {
 struct DynamicReader : implements<DynamicReader, IJSValueReader> {
   DynamicReader(const folly::dynamic &root) noexcept;
 
+  // Starts reading from a new root value so that the reader can be reused.
+  void Reset(const folly::dynamic &root) noexcept;
+
  public: // IJSValueReader
   JSValueType ValueType() noexcept;
   bool GetNextObjectProperty(hstring &propertyName) noexcept;
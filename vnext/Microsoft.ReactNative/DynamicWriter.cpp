@@ -15,6 +15,14 @@ folly::dynamic DynamicWriter::TakeValue() noexcept {
   return std::move(m_result);
 }
 
+void DynamicWriter::Reset() noexcept {
+  m_state = State::Start;
+  m_stack.clear();
+  m_dynamic = nullptr;
+  m_propertyName.clear();
+  m_result = nullptr;
+}
+
 void DynamicWriter::WriteNull() noexcept {
   WriteValue(folly::dynamic{});
 }
@@ -10,6 +10,9 @@ namespace winrt::Microsoft::ReactNative {
 struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter> {
   folly::dynamic TakeValue() noexcept;
 
+  // Discards the written value so that the writer can be reused.
+  void Reset() noexcept;
+
  public: // IJSValueWriter
   void WriteNull() noexcept;
   void WriteBoolean(bool value) noexcept;
@@ -10,6 +10,74 @@
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+//=============================================================================
+// ReactJSFunction implementation
+//=============================================================================
+
+ReactJSFunction::ReactJSFunction(
+    Mso::CntPtr<Mso::React::IReactContext> const &context,
+    hstring const &moduleName,
+    hstring const &methodName,
+    bool isEvent) noexcept
+    : m_context{context},
+      m_moduleName{moduleName},
+      m_methodName{methodName},
+      m_jsModuleName{to_string(moduleName)},
+      m_jsMethodName{isEvent ? "emit" : to_string(methodName)},
+      m_eventName{isEvent ? to_string(methodName) : std::string{}},
+      m_isEvent{isEvent} {}
+
+hstring ReactJSFunction::ModuleName() noexcept {
+  return m_moduleName;
+}
+
+hstring ReactJSFunction::MethodName() noexcept {
+  return m_methodName;
+}
+
+void ReactJSFunction::Call(JSValueArgWriter const &paramsArgWriter) noexcept {
+  auto paramsWriter = TakeWriter();
+  paramsArgWriter(*paramsWriter);
+  auto params = paramsWriter->TakeValue();
+  ReturnWriter(std::move(paramsWriter));
+  Call(std::move(params));
+}
+
+void ReactJSFunction::Call(folly::dynamic &&params) noexcept {
+  if (m_isEvent) {
+    // Same arguments as EmitJSEvent writes: the event name followed by the event parameters.
+    params = folly::dynamic::array(m_eventName, std::move(params));
+  }
+
+  // The names are passed by reference so that a call does not copy them unless it is made or queued.
+  m_context->CallJSFunction(m_jsModuleName, m_jsMethodName, std::move(params));
+}
+
+// The writer is reused between calls. A call made while the writer is in use
+// from another thread or from a reentrant call gets a new writer.
+winrt::com_ptr<DynamicWriter> ReactJSFunction::TakeWriter() noexcept {
+  {
+    std::scoped_lock lock{m_mutex};
+    if (m_writer) {
+      return std::move(m_writer);
+    }
+  }
+
+  return winrt::make_self<DynamicWriter>();
+}
+
+void ReactJSFunction::ReturnWriter(winrt::com_ptr<DynamicWriter> &&writer) noexcept {
+  writer->Reset();
+  std::scoped_lock lock{m_mutex};
+  if (!m_writer) {
+    m_writer = std::move(writer);
+  }
+}
+
+//=============================================================================
+// ReactContext implementation
+//=============================================================================
+
 ReactContext::ReactContext(Mso::CntPtr<Mso::React::IReactContext> &&context) noexcept : m_context{std::move(context)} {}
 
 IReactPropertyBag ReactContext::Properties() noexcept {
@@ -68,6 +136,34 @@ void ReactContext::EmitJSEvent(
   m_context->CallJSFunction(to_string(eventEmitterName), "emit", std::move(params));
 }
 
+IReactJSFunction ReactContext::GetJSFunction(hstring const &moduleName, hstring const &methodName) noexcept {
+  return GetOrCreateJSFunction(moduleName, methodName, /*isEvent:*/ false);
+}
+
+IReactJSFunction ReactContext::GetJSEvent(hstring const &eventEmitterName, hstring const &eventName) noexcept {
+  return GetOrCreateJSFunction(eventEmitterName, eventName, /*isEvent:*/ true);
+}
+
+IReactJSFunction
+ReactContext::GetOrCreateJSFunction(hstring const &moduleName, hstring const &methodName, bool isEvent) noexcept {
+  // Module and method names cannot contain the '\0' character, so it is used as a separator.
+  std::wstring key;
+  key.reserve(moduleName.size() + methodName.size() + 3);
+  key.append(moduleName.c_str(), moduleName.size());
+  key.push_back(L'\0');
+  key.append(methodName.c_str(), methodName.size());
+  key.push_back(L'\0');
+  key.push_back(isEvent ? L'e' : L'f');
+
+  std::scoped_lock lock{m_jsFunctionsMutex};
+  auto &jsFunction = m_jsFunctions.try_emplace(std::move(key), nullptr).first->second;
+  if (!jsFunction) {
+    jsFunction = winrt::make<ReactJSFunction>(m_context, moduleName, methodName, isEvent);
+  }
+
+  return jsFunction;
+}
+
 Mso::React::IReactContext &ReactContext::GetInner() const noexcept {
   return *m_context;
 }
@@ -3,11 +3,49 @@
 
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+#include "DynamicWriter.h"
 #include "ReactHost/React.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+// A JavaScript function with the module and method names converted to UTF-8 once.
+// For events the event name is prepended to the arguments and 'emit' is called.
+struct ReactJSFunction : winrt::implements<ReactJSFunction, IReactJSFunction> {
+  ReactJSFunction(
+      Mso::CntPtr<Mso::React::IReactContext> const &context,
+      hstring const &moduleName,
+      hstring const &methodName,
+      bool isEvent) noexcept;
+
+ public: // IReactJSFunction
+  hstring ModuleName() noexcept;
+  hstring MethodName() noexcept;
+  void Call(JSValueArgWriter const &paramsArgWriter) noexcept;
+
+ public:
+  // Not part of the public ABI interface
+  // Calls the function with already built arguments without the IJSValueWriter overhead.
+  void Call(folly::dynamic &&params) noexcept;
+
+ private:
+  winrt::com_ptr<DynamicWriter> TakeWriter() noexcept;
+  void ReturnWriter(winrt::com_ptr<DynamicWriter> &&writer) noexcept;
+
+ private:
+  const Mso::CntPtr<Mso::React::IReactContext> m_context;
+  const hstring m_moduleName;
+  const hstring m_methodName;
+  const std::string m_jsModuleName;
+  const std::string m_jsMethodName;
+  const std::string m_eventName;
+  const bool m_isEvent;
+  std::mutex m_mutex;
+  winrt::com_ptr<DynamicWriter> m_writer;
+};
+
 struct ReactContext : winrt::implements<ReactContext, IReactContext> {
   ReactContext(Mso::CntPtr<Mso::React::IReactContext> &&context) noexcept;
 
@@ -30,13 +68,21 @@ struct ReactContext : winrt::implements<ReactContext, IReactContext> {
       hstring const &eventEmitterName,
       hstring const &eventName,
       JSValueArgWriter const &paramsArgWriter) noexcept;
+  IReactJSFunction GetJSFunction(hstring const &moduleName, hstring const &methodName) noexcept;
+  IReactJSFunction GetJSEvent(hstring const &eventEmitterName, hstring const &eventName) noexcept;
 
   // Not part of the public ABI interface
   // Internal accessor for within the Microsoft.ReactNative dll to allow calling into internal methods
   Mso::React::IReactContext &GetInner() const noexcept;
 
+ private:
+  IReactJSFunction GetOrCreateJSFunction(hstring const &moduleName, hstring const &methodName, bool isEvent) noexcept;
+
  private:
   Mso::CntPtr<Mso::React::IReactContext> m_context;
+  // Functions resolved through this wrapper. Other wrappers of the same instance have their own.
+  std::mutex m_jsFunctionsMutex;
+  std::unordered_map<std::wstring, IReactJSFunction> m_jsFunctions;
 };
 
 } // namespace winrt::Microsoft::ReactNative::implementation
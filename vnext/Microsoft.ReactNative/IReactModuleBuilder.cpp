@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "IReactModuleBuilder.h"
+#include "DynamicReader.h"
 #include "DynamicWriter.h"
 #include "ReactHost/MsoUtils.h"
 
@@ -10,6 +11,75 @@ using namespace facebook::xplat::module;
 
 namespace winrt::Microsoft::ReactNative {
 
+namespace {
+
+//===========================================================================
+// MethodCallPool implementation
+//===========================================================================
+
+// Keeps argument readers and result writers for reuse by the module method
+// calls on the current thread. Most methods finish with the reader and writer
+// before they return, but a method may keep a reference to use them later,
+// e.g. to resolve a promise. Such instances are not returned to the pool.
+struct MethodCallPool {
+  static MethodCallPool &ForCurrentThread() noexcept {
+    static thread_local MethodCallPool s_pool;
+    return s_pool;
+  }
+
+  IJSValueReader AcquireReader(const folly::dynamic &args) noexcept {
+    if (m_readers.empty()) {
+      return make<DynamicReader>(args);
+    }
+
+    IJSValueReader reader = std::move(m_readers.back());
+    m_readers.pop_back();
+    get_self<DynamicReader>(reader)->Reset(args);
+    return reader;
+  }
+
+  IJSValueWriter AcquireWriter() noexcept {
+    if (m_writers.empty()) {
+      return make<DynamicWriter>();
+    }
+
+    IJSValueWriter writer = std::move(m_writers.back());
+    m_writers.pop_back();
+    get_self<DynamicWriter>(writer)->Reset();
+    return writer;
+  }
+
+  void Release(IJSValueReader &&reader) noexcept {
+    if (m_readers.size() < s_maxPoolSize && IsOnlyReference(reader)) {
+      m_readers.push_back(std::move(reader));
+    }
+  }
+
+  void Release(IJSValueWriter &&writer) noexcept {
+    if (m_writers.size() < s_maxPoolSize && IsOnlyReference(writer)) {
+      get_self<DynamicWriter>(writer)->Reset();
+      m_writers.push_back(std::move(writer));
+    }
+  }
+
+ private:
+  static bool IsOnlyReference(Windows::Foundation::IUnknown const &obj) noexcept {
+    auto unknown = static_cast<::IUnknown *>(get_abi(obj));
+    unknown->AddRef();
+    return unknown->Release() == 1;
+  }
+
+ private:
+  // Nested method calls on the same thread need their own instances.
+  // A few instances are enough to cover them.
+  static constexpr size_t s_maxPoolSize = 4;
+
+  std::vector<IJSValueReader> m_readers;
+  std::vector<IJSValueWriter> m_writers;
+};
+
+} // namespace
+
 //===========================================================================
 // ReactModuleBuilder implementation
 //===========================================================================
@@ -28,33 +98,50 @@ void ReactModuleBuilder::AddMethod(
     hstring const &name,
     MethodReturnType returnType,
     MethodDelegate const &method) noexcept {
-  CxxModule::Method cxxMethod(
-      to_string(name), [method](folly::dynamic args, CxxModule::Callback resolve, CxxModule::Callback reject) noexcept {
-        auto argReader = make<DynamicReader>(args);
-        auto resultWriter = make<DynamicWriter>();
-        auto resolveCallback = MakeMethodResultCallback(std::move(resolve));
-        auto rejectCallback = MakeMethodResultCallback(std::move(reject));
-        method(argReader, resultWriter, resolveCallback, rejectCallback);
-      });
-
+  size_t callbackCount{0};
+  bool isPromise{false};
   switch (returnType) {
     case MethodReturnType::Callback:
-      cxxMethod.callbacks = 1;
-      cxxMethod.isPromise = false;
+      callbackCount = 1;
       break;
     case MethodReturnType::TwoCallbacks:
-      cxxMethod.callbacks = 2;
-      cxxMethod.isPromise = false;
+      callbackCount = 2;
       break;
     case MethodReturnType::Promise:
-      cxxMethod.callbacks = 2;
-      cxxMethod.isPromise = true;
+      callbackCount = 2;
+      isPromise = true;
       break;
     default:
-      cxxMethod.callbacks = 0;
-      cxxMethod.isPromise = false;
+      break;
   }
 
+  CxxModule::Method cxxMethod(
+      to_string(name),
+      [method, callbackCount](folly::dynamic args, CxxModule::Callback resolve, CxxModule::Callback reject) noexcept {
+        auto &pool = MethodCallPool::ForCurrentThread();
+        auto argReader = pool.AcquireReader(args);
+        auto resultWriter = pool.AcquireWriter();
+
+        // Methods without callbacks do not pay for wrapping them.
+        MethodResultCallback resolveCallback{nullptr};
+        MethodResultCallback rejectCallback{nullptr};
+        if (callbackCount > 0) {
+          resolveCallback = MakeMethodResultCallback(std::move(resolve));
+        }
+
+        if (callbackCount > 1) {
+          rejectCallback = MakeMethodResultCallback(std::move(reject));
+        }
+
+        method(argReader, resultWriter, resolveCallback, rejectCallback);
+
+        pool.Release(std::move(argReader));
+        pool.Release(std::move(resultWriter));
+      });
+
+  cxxMethod.callbacks = callbackCount;
+  cxxMethod.isPromise = isPromise;
+
   m_methods.push_back(std::move(cxxMethod));
 }
 
@@ -62,10 +149,15 @@ void ReactModuleBuilder::AddSyncMethod(hstring const &name, SyncMethodDelegate c
   CxxModule::Method cxxMethod(
       to_string(name),
       [method](folly::dynamic args) noexcept {
-        auto argReader = make<DynamicReader>(args);
-        auto resultWriter = make<DynamicWriter>();
+        auto &pool = MethodCallPool::ForCurrentThread();
+        auto argReader = pool.AcquireReader(args);
+        auto resultWriter = pool.AcquireWriter();
         method(argReader, resultWriter);
-        return get_self<DynamicWriter>(resultWriter)->TakeValue();
+        auto result = get_self<DynamicWriter>(resultWriter)->TakeValue();
+
+        pool.Release(std::move(argReader));
+        pool.Release(std::move(resultWriter));
+        return result;
       },
       CxxModule::SyncTag);
 
@@ -77,7 +169,8 @@ void ReactModuleBuilder::AddSyncMethod(hstring const &name, SyncMethodDelegate c
     return [callback = std::move(callback)](const IJSValueWriter &outputWriter) noexcept {
       if (outputWriter) {
         folly::dynamic argArray = outputWriter.as<DynamicWriter>()->TakeValue();
-        callback(std::vector<folly::dynamic>(argArray.begin(), argArray.end()));
+        callback(std::vector<folly::dynamic>(
+            std::make_move_iterator(argArray.begin()), std::make_move_iterator(argArray.end())));
       } else {
         callback(std::vector<folly::dynamic>{});
       }
@@ -10,9 +10,14 @@
 #include <winrt/Microsoft.ReactNative.h>
 #include <winrt/Windows.UI.Core.h>
 #include <winrt/Windows.UI.ViewManagement.h>
+#include <algorithm>
 
 namespace Microsoft::ReactNative {
 
+// Resizing a window raises SizeChanged many times per frame. The dimensions
+// are reported to JavaScript at most once per frame.
+static constexpr std::chrono::milliseconds DimensionsUpdateInterval{16};
+
 static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<DeviceInfoHolder>>>
     &DeviceInfoHolderPropertyId() noexcept {
   static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<DeviceInfoHolder>>> prop{
@@ -20,19 +25,18 @@ static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<Devi
   return prop;
 }
 
-DeviceInfoHolder::DeviceInfoHolder() {
-  updateDeviceInfo();
-}
+DeviceInfoHolder::DeviceInfoHolder()
+    : m_displayInfo{winrt::Windows::Graphics::Display::DisplayInformation::GetForCurrentView()},
+      m_textScaleFactor{m_uiSettings.TextScaleFactor()},
+      m_coalescer{DimensionsUpdateInterval, queryDimensions()},
+      m_uiDispatcher{winrt::Windows::System::DispatcherQueue::GetForCurrentThread()} {}
 
 void DeviceInfoHolder::InitDeviceInfoHolder(
     const winrt::Microsoft::ReactNative::ReactPropertyBag &propertyBag) noexcept {
   if (xaml::TryGetCurrentApplication()) {
     auto deviceInfoHolder = std::make_shared<DeviceInfoHolder>();
-    deviceInfoHolder->updateDeviceInfo();
-
-    propertyBag.Set(DeviceInfoHolderPropertyId(), std::move(deviceInfoHolder));
 
-    auto const &displayInfo = winrt::Windows::Graphics::Display::DisplayInformation::GetForCurrentView();
+    propertyBag.Set(DeviceInfoHolderPropertyId(), deviceInfoHolder);
 
     if (xaml::Window::Current()) {
       auto const &window = xaml::Window::Current().CoreWindow();
@@ -48,12 +52,34 @@ void DeviceInfoHolder::InitDeviceInfoHolder(
       // TODO: WinUI 3 Islands - set up a listener for window size changed
     }
 
-    deviceInfoHolder->m_dpiChangedRevoker = displayInfo.DpiChanged(
+    deviceInfoHolder->m_dpiChangedRevoker = deviceInfoHolder->m_displayInfo.DpiChanged(
         winrt::auto_revoke, [weakHolder = std::weak_ptr(deviceInfoHolder)](const auto &, const auto &) {
           if (auto strongHolder = weakHolder.lock()) {
             strongHolder->updateDeviceInfo();
           }
         });
+
+    if (auto const &uiDispatcher = deviceInfoHolder->m_uiDispatcher) {
+      // UISettings raises its events on a background thread.
+      deviceInfoHolder->m_textScaleFactorChangedRevoker = deviceInfoHolder->m_uiSettings.TextScaleFactorChanged(
+          winrt::auto_revoke, [weakHolder = std::weak_ptr(deviceInfoHolder), uiDispatcher](const auto &, const auto &) {
+            uiDispatcher.TryEnqueue([weakHolder]() {
+              if (auto strongHolder = weakHolder.lock()) {
+                strongHolder->m_textScaleFactor = strongHolder->m_uiSettings.TextScaleFactor();
+                strongHolder->updateDeviceInfo();
+              }
+            });
+          });
+
+      deviceInfoHolder->m_updateTimer = uiDispatcher.CreateTimer();
+      deviceInfoHolder->m_updateTimer.IsRepeating(false);
+      deviceInfoHolder->m_updateTimerTickRevoker = deviceInfoHolder->m_updateTimer.Tick(
+          winrt::auto_revoke, [weakHolder = std::weak_ptr(deviceInfoHolder)](const auto &, const auto &) {
+            if (auto strongHolder = weakHolder.lock()) {
+              strongHolder->onUpdateTimer();
+            }
+          });
+    }
   }
 }
 
@@ -70,19 +96,20 @@ React::JSValueObject DeviceInfoHolder::GetDimensions(const React::ReactPropertyB
 }
 
 React::JSValueObject DeviceInfoHolder::getDimensions() noexcept {
+  const DeviceDimensions &dimensions = m_coalescer.Dimensions();
   return React::JSValueObject{
       {"windowPhysicalPixels",
-       React::JSValueObject{{"width", m_windowWidth * m_scale},
-                            {"height", m_windowHeight * m_scale},
-                            {"scale", m_scale},
-                            {"fontScale", m_textScaleFactor},
-                            {"densityDpi", m_dpi}}},
+       React::JSValueObject{{"width", dimensions.windowWidth * dimensions.scale},
+                            {"height", dimensions.windowHeight * dimensions.scale},
+                            {"scale", dimensions.scale},
+                            {"fontScale", dimensions.textScaleFactor},
+                            {"densityDpi", dimensions.dpi}}},
       {"screenPhysicalPixels",
-       React::JSValueObject{{"width", m_screenWidth},
-                            {"height", m_screenHeight},
-                            {"scale", m_scale},
-                            {"fontScale", m_textScaleFactor},
-                            {"densityDpi", m_dpi}}},
+       React::JSValueObject{{"width", dimensions.screenWidth},
+                            {"height", dimensions.screenHeight},
+                            {"scale", dimensions.scale},
+                            {"fontScale", dimensions.textScaleFactor},
+                            {"densityDpi", dimensions.dpi}}},
   };
 }
 
@@ -94,24 +121,50 @@ void DeviceInfoHolder::SetCallback(
   (*holder)->m_notifyCallback = std::move(callback);
 }
 
-void DeviceInfoHolder::updateDeviceInfo() noexcept {
+DeviceDimensions DeviceInfoHolder::queryDimensions() noexcept {
+  DeviceDimensions dimensions;
   if (xaml::Window::Current()) {
-    auto const window = xaml::Window::Current().CoreWindow();
+    auto const bounds = xaml::Window::Current().CoreWindow().Bounds();
 
-    m_windowWidth = window.Bounds().Width;
-    m_windowHeight = window.Bounds().Height;
+    dimensions.windowWidth = bounds.Width;
+    dimensions.windowHeight = bounds.Height;
   } else {
     /// TODO: WinUI 3 Island - mock for now
-    m_windowWidth = 600;
-    m_windowHeight = 800;
+    dimensions.windowWidth = 600;
+    dimensions.windowHeight = 800;
+  }
+  dimensions.textScaleFactor = m_textScaleFactor;
+  dimensions.scale = static_cast<float>(m_displayInfo.ResolutionScale()) / 100;
+  dimensions.dpi = m_displayInfo.LogicalDpi();
+  dimensions.screenWidth = m_displayInfo.ScreenWidthInRawPixels();
+  dimensions.screenHeight = m_displayInfo.ScreenHeightInRawPixels();
+  return dimensions;
+}
+
+void DeviceInfoHolder::updateDeviceInfo() noexcept {
+  switch (m_coalescer.Update(queryDimensions(), DimensionsUpdateCoalescer::Clock::now())) {
+    case DimensionsUpdateCoalescer::UpdateResult::Report:
+      notifyChanged();
+      break;
+    case DimensionsUpdateCoalescer::UpdateResult::Defer:
+      if (m_updateTimer) {
+        auto delay = m_coalescer.DeferredReportTime() - DimensionsUpdateCoalescer::Clock::now();
+        m_updateTimer.Interval(std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(
+            (std::max)(delay, DimensionsUpdateCoalescer::Clock::duration::zero())));
+        m_updateTimer.Start();
+      } else {
+        onUpdateTimer();
+      }
+      break;
+    case DimensionsUpdateCoalescer::UpdateResult::None:
+      break;
+  }
+}
+
+void DeviceInfoHolder::onUpdateTimer() noexcept {
+  if (m_coalescer.OnTimer(DimensionsUpdateCoalescer::Clock::now())) {
+    notifyChanged();
   }
-  winrt::Windows::UI::ViewManagement::UISettings uiSettings;
-  m_textScaleFactor = uiSettings.TextScaleFactor();
-  auto const displayInfo = winrt::Windows::Graphics::Display::DisplayInformation::GetForCurrentView();
-  m_scale = static_cast<float>(displayInfo.ResolutionScale()) / 100;
-  m_dpi = displayInfo.LogicalDpi();
-  m_screenWidth = displayInfo.ScreenWidthInRawPixels();
-  m_screenHeight = displayInfo.ScreenHeightInRawPixels();
 }
 
 void DeviceInfo::GetConstants(React::ReactConstantProvider &provider) noexcept {
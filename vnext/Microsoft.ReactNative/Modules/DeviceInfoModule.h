@@ -2,10 +2,13 @@
 // Licensed under the MIT License.
 #pragma once
 
+#include <DimensionsUpdateCoalescer.h>
 #include <NativeModules.h>
 #include <winrt/Windows.ApplicationModel.h>
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Graphics.Display.h>
+#include <winrt/Windows.System.h>
+#include <winrt/Windows.UI.ViewManagement.h>
 
 namespace Microsoft::ReactNative {
 
@@ -24,19 +27,25 @@ struct DeviceInfoHolder {
 
  private:
   React::JSValueObject getDimensions() noexcept;
+  DeviceDimensions queryDimensions() noexcept;
   void updateDeviceInfo() noexcept;
+  void onUpdateTimer() noexcept;
   void notifyChanged() noexcept;
 
-  float m_windowWidth{0};
-  float m_windowHeight{0};
-  float m_scale{0};
+  // Declared before m_coalescer, which is initialized with the dimensions they
+  // provide.
+  winrt::Windows::Graphics::Display::DisplayInformation m_displayInfo{nullptr};
+  winrt::Windows::UI::ViewManagement::UISettings m_uiSettings;
   double m_textScaleFactor{0};
-  float m_dpi{0};
-  uint32_t m_screenWidth{0};
-  uint32_t m_screenHeight{0};
+
+  DimensionsUpdateCoalescer m_coalescer;
+  winrt::Windows::System::DispatcherQueue m_uiDispatcher{nullptr};
+  winrt::Windows::System::DispatcherQueueTimer m_updateTimer{nullptr};
 
   winrt::Windows::UI::Core::CoreWindow::SizeChanged_revoker m_sizeChangedRevoker;
   winrt::Windows::Graphics::Display::DisplayInformation::DpiChanged_revoker m_dpiChangedRevoker{};
+  winrt::Windows::UI::ViewManagement::UISettings::TextScaleFactorChanged_revoker m_textScaleFactorChangedRevoker{};
+  winrt::Windows::System::DispatcherQueueTimer::Tick_revoker m_updateTimerTickRevoker{};
   Mso::Functor<void(React::JSValueObject &&)> m_notifyCallback;
 };
 
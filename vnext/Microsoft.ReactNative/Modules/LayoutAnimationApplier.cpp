@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "LayoutAnimationApplier.h"
+
+#include <UI.Composition.h>
+#include <UI.Xaml.Media.h>
+#include <Views/ViewPanel.h>
+#include <WindowsNumerics.h>
+
+namespace winrt {
+using namespace Windows::Foundation::Numerics;
+} // namespace winrt
+
+using facebook::react::LayoutTransition;
+using facebook::react::LayoutTransitionProperty;
+using facebook::react::LayoutTransitionTiming;
+
+namespace react::uwp {
+
+namespace {
+
+// Composition rejects animations shorter than a millisecond.
+constexpr float c_minDuration = 1.0f;
+
+template <typename TValue>
+TValue Interpolate(const TValue &from, const TValue &to, float progress) {
+  return from + (to - from) * progress;
+}
+
+template <typename TAnimation, typename TValue>
+TAnimation MakeAnimation(
+    const comp::Compositor &compositor,
+    TAnimation animation,
+    const LayoutTransition &transition,
+    const wchar_t *target,
+    const TValue &from,
+    const TValue &to) {
+  animation.Target(target);
+  animation.Duration(std::chrono::duration_cast<winrt::TimeSpan>(
+      std::chrono::duration<float, std::milli>(std::max(transition.duration, c_minDuration))));
+  if (transition.delay > 0.0f) {
+    animation.DelayTime(
+        std::chrono::duration_cast<winrt::TimeSpan>(std::chrono::duration<float, std::milli>(transition.delay)));
+    // Created views must not show up at their final state during the delay.
+    animation.DelayBehavior(comp::AnimationDelayBehavior::SetInitialValueBeforeDelay);
+  }
+
+  animation.InsertKeyFrame(0.0f, from);
+  if (transition.timing.kind == LayoutTransitionTiming::Kind::CubicBezier) {
+    const auto &points = transition.timing.controlPoints;
+    animation.InsertKeyFrame(
+        1.0f,
+        to,
+        compositor.CreateCubicBezierEasingFunction({points[0], points[1]}, {points[2], points[3]}));
+  } else {
+    const auto linear = compositor.CreateLinearEasingFunction();
+    for (const auto &keyFrame : transition.timing.keyFrames) {
+      animation.InsertKeyFrame(keyFrame.time, Interpolate(from, to, keyFrame.progress), linear);
+    }
+  }
+
+  return animation;
+}
+
+void StartAnimations(
+    const comp::Compositor &compositor,
+    const xaml::UIElement &element,
+    const LayoutTransition &transition) {
+  // Layout changes are applied to the element right away. Translation and
+  // Scale start at values that make the element look like its previous frame.
+  // Scale animations of created and deleted views are centered, which is done
+  // by translating the element along with its scale.
+  winrt::float3 fromTranslation{0.0f, 0.0f, 0.0f};
+  winrt::float3 toTranslation{0.0f, 0.0f, 0.0f};
+  winrt::float3 fromScale{1.0f, 1.0f, 1.0f};
+  winrt::float3 toScale{1.0f, 1.0f, 1.0f};
+  bool animateTranslation = false;
+  bool animateScale = false;
+
+  const auto &frame = transition.frame;
+  for (const auto &channel : transition.channels) {
+    switch (channel.property) {
+      case LayoutTransitionProperty::Left:
+        fromTranslation.x = channel.from - channel.to;
+        animateTranslation = true;
+        break;
+      case LayoutTransitionProperty::Top:
+        fromTranslation.y = channel.from - channel.to;
+        animateTranslation = true;
+        break;
+      case LayoutTransitionProperty::Width:
+        if (channel.to > 0.0f) {
+          fromScale.x = channel.from / channel.to;
+          animateScale = true;
+        }
+        break;
+      case LayoutTransitionProperty::Height:
+        if (channel.to > 0.0f) {
+          fromScale.y = channel.from / channel.to;
+          animateScale = true;
+        }
+        break;
+      case LayoutTransitionProperty::ScaleX:
+        fromScale.x = channel.from;
+        toScale.x = channel.to;
+        fromTranslation.x = (1.0f - channel.from) * frame.width / 2.0f;
+        toTranslation.x = (1.0f - channel.to) * frame.width / 2.0f;
+        animateScale = animateTranslation = true;
+        break;
+      case LayoutTransitionProperty::ScaleY:
+        fromScale.y = channel.from;
+        toScale.y = channel.to;
+        fromTranslation.y = (1.0f - channel.from) * frame.height / 2.0f;
+        toTranslation.y = (1.0f - channel.to) * frame.height / 2.0f;
+        animateScale = animateTranslation = true;
+        break;
+      case LayoutTransitionProperty::Opacity:
+        element.StartAnimation(MakeAnimation(
+            compositor, compositor.CreateScalarKeyFrameAnimation(), transition, L"Opacity", channel.from, channel.to));
+        break;
+    }
+  }
+
+  if (animateTranslation) {
+    element.StartAnimation(MakeAnimation(
+        compositor,
+        compositor.CreateVector3KeyFrameAnimation(),
+        transition,
+        L"Translation",
+        fromTranslation,
+        toTranslation));
+  }
+
+  if (animateScale) {
+    element.StartAnimation(MakeAnimation(
+        compositor, compositor.CreateVector3KeyFrameAnimation(), transition, L"Scale", fromScale, toScale));
+  }
+}
+
+// Deleted views are only kept in ViewPanels.
+winrt::react::uwp::implementation::ViewPanel *GetViewPanel(const xaml::Controls::Panel &panel) {
+  return winrt::get_self<winrt::react::uwp::implementation::ViewPanel>(panel.as<winrt::react::uwp::ViewPanel>());
+}
+
+} // namespace
+
+bool LayoutAnimationApplier::KeepDeletedView(int64_t tag, const XamlView &view) {
+  auto element = view.try_as<xaml::UIElement>();
+  if (!element) {
+    return false;
+  }
+
+  // Only ViewPanel children are kept: the view managers of other panels may
+  // not expect extra children.
+  auto panel = xaml::Media::VisualTreeHelper::GetParent(element).try_as<winrt::react::uwp::ViewPanel>();
+  if (!panel) {
+    return false;
+  }
+
+  // The deleted views of a parent are all kept before any of them is removed,
+  // so their indices refer to the same children.
+  auto children = panel.Children();
+  uint32_t index;
+  if (!children.IndexOf(element, index)) {
+    return false;
+  }
+
+  m_deletedViews[tag] = DeletedView{element, panel, index > 0 ? children.GetAt(index - 1) : nullptr, index};
+  return true;
+}
+
+void LayoutAnimationApplier::Apply(
+    const std::vector<LayoutTransition> &transitions,
+    const std::function<XamlView(int64_t)> &getView,
+    std::function<void()> &&onCompleted) {
+  // Deleted views without a transition were already removed from their
+  // parent with the rest of the batch, so they are simply dropped.
+  std::vector<DeletedView> deletedViews;
+  auto deletedViewsToAnimate = std::move(m_deletedViews);
+  m_deletedViews.clear();
+
+  if (transitions.empty()) {
+    onCompleted();
+    return;
+  }
+
+  // The elements were removed from their panel with the rest of the batch.
+  // They are put back in the order of their positions, so that a deleted view
+  // can be put back after a deleted previous sibling.
+  std::unordered_map<int64_t, const DeletedView *> deletedViewOfTag;
+  deletedViews.reserve(deletedViewsToAnimate.size());
+  for (const auto &transition : transitions) {
+    if (transition.change == facebook::react::LayoutChange::Deleted) {
+      auto it = deletedViewsToAnimate.find(transition.tag);
+      if (it != deletedViewsToAnimate.end()) {
+        deletedViews.push_back(it->second);
+        deletedViewOfTag[transition.tag] = &deletedViews.back();
+      }
+    }
+  }
+
+  std::vector<const DeletedView *> deletedViewsInOrder;
+  for (const auto &deletedView : deletedViews) {
+    deletedViewsInOrder.push_back(&deletedView);
+  }
+  std::stable_sort(
+      deletedViewsInOrder.begin(), deletedViewsInOrder.end(), [](const DeletedView *a, const DeletedView *b) {
+        return a->childIndex < b->childIndex;
+      });
+  for (auto deletedView : deletedViewsInOrder) {
+    // The panel skips the kept elements in the indices the view manager uses.
+    GetViewPanel(deletedView->panel)
+        ->InsertKeptChild(deletedView->element, deletedView->previousSibling, deletedView->childIndex);
+  }
+
+  const auto compositor = react::uwp::GetCompositor();
+  auto batch = compositor.CreateScopedBatch(comp::CompositionBatchTypes::Animation);
+
+  for (const auto &transition : transitions) {
+    xaml::UIElement element{nullptr};
+    if (transition.change == facebook::react::LayoutChange::Deleted) {
+      auto it = deletedViewOfTag.find(transition.tag);
+      if (it == deletedViewOfTag.end()) {
+        continue;
+      }
+
+      element = it->second->element;
+    } else if (auto view = getView(transition.tag)) {
+      element = view.try_as<xaml::UIElement>();
+    }
+
+    if (element) {
+      StartAnimations(compositor, element, transition);
+    }
+  }
+
+  batch.End();
+  batch.Completed([deletedViews = std::move(deletedViews), onCompleted = std::move(onCompleted)](auto &&, auto &&) {
+    for (const auto &deletedView : deletedViews) {
+      RemoveDeletedView(deletedView);
+    }
+
+    onCompleted();
+  });
+}
+
+/*static*/ void LayoutAnimationApplier::RemoveDeletedView(const DeletedView &deletedView) {
+  // The parent may have been cleared or dropped in the meantime.
+  GetViewPanel(deletedView.panel)->RemoveKeptChild(deletedView.element);
+}
+
+} // namespace react::uwp
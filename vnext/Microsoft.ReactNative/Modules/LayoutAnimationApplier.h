@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <LayoutAnimationPlanner.h>
+#include <XamlView.h>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace react::uwp {
+
+// Runs the transitions planned by facebook::react::LayoutAnimationPlanner as
+// composition animations on the XAML elements. Position and size changes are
+// animated with Translation and Scale from the previous frame, so XAML layout
+// runs only once for the final frame.
+class LayoutAnimationApplier {
+ public:
+  // Keeps the element of a deleted view in its parent panel until its delete
+  // animation has finished. Must be called before the element is removed from
+  // its parent. Returns false if the element cannot be kept, in which case it
+  // is removed right away.
+  bool KeepDeletedView(int64_t tag, const XamlView &view);
+
+  // Starts the animations of all transitions in one scoped batch. onCompleted
+  // is called once they all finished and the kept elements of deleted views
+  // were removed. Kept elements without a transition are not shown again.
+  void Apply(
+      const std::vector<facebook::react::LayoutTransition> &transitions,
+      const std::function<XamlView(int64_t)> &getView,
+      std::function<void()> &&onCompleted);
+
+ private:
+  // Where the element of a deleted view was before it was removed, so that it
+  // is put back at the same position and keeps its stacking order.
+  struct DeletedView {
+    xaml::UIElement element{nullptr};
+    xaml::Controls::Panel panel{nullptr};
+    xaml::UIElement previousSibling{nullptr};
+    uint32_t childIndex{0};
+  };
+
+  static void RemoveDeletedView(const DeletedView &deletedView);
+
+ private:
+  std::unordered_map<int64_t, DeletedView> m_deletedViews;
+};
+
+} // namespace react::uwp
@@ -218,9 +218,28 @@ void NativeUIManager::removeRootView(facebook::react::ShadowNode &shadow) {
   RemoveView(shadow, true);
 }
 
+void NativeUIManager::configureNextLayoutAnimation(
+    folly::dynamic &&config,
+    facebook::xplat::module::CxxModule::Callback success,
+    facebook::xplat::module::CxxModule::Callback error) {
+  try {
+    m_layoutAnimation.emplace(std::move(config));
+    m_layoutAnimationCallback = std::move(success);
+    AddLayoutAnimationFrames();
+  } catch (const std::exception &e) {
+    m_layoutAnimation.reset();
+    m_layoutAnimationCallback = nullptr;
+    m_layoutAnimationPlanner.Clear();
+    if (error) {
+      error({folly::dynamic(e.what())});
+    }
+  }
+}
+
 void NativeUIManager::onBatchComplete() {
   if (m_inBatch) {
     DoLayout();
+    StartLayoutAnimation();
     m_inBatch = false;
 
     const auto callbacks = m_batchCompletedCallbacks;
@@ -788,6 +807,29 @@ void NativeUIManager::RemoveView(facebook::react::ShadowNode &shadowNode, bool r
 
   m_tagsToYogaNodes.erase(node.m_tag);
   m_tagsToYogaContext.erase(node.m_tag);
+  if (m_layoutAnimation) {
+    m_layoutAnimationPlanner.RemoveNode(node.m_tag);
+  }
+}
+
+void NativeUIManager::RemoveViews(const std::vector<facebook::react::ShadowNode *> &nodes, bool removeChildren) {
+  // The Yoga nodes of the whole subtree are freed, so only the subtree root
+  // has to be detached from its Yoga children.
+  for (auto node : nodes) {
+    RemoveView(*node, removeChildren && node == nodes.front());
+  }
+}
+
+bool NativeUIManager::DeferRemoveView(facebook::react::ShadowNode &shadowNode) {
+  if (!m_layoutAnimation ||
+      m_layoutAnimation->Properties().deleteAnimationProps.animationType ==
+          facebook::react::LayoutAnimation::AnimationType::None) {
+    return false;
+  }
+
+  ShadowNodeBase &node = static_cast<ShadowNodeBase &>(shadowNode);
+  return m_layoutAnimationPlanner.DeleteNode(node.m_tag) &&
+      m_layoutAnimationApplier.KeepDeletedView(node.m_tag, node.GetView());
 }
 
 void NativeUIManager::ReplaceView(facebook::react::ShadowNode &shadowNode) {
@@ -888,9 +930,59 @@ void NativeUIManager::DoLayout() {
     auto view = shadowNode.GetView();
     auto pViewManager = shadowNode.GetViewManager();
     pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+
+    if (m_layoutAnimation) {
+      m_layoutAnimationPlanner.UpdateNodeLayout(tag, shadowNode.m_parent, {left, top, width, height});
+    }
   }
 }
 
+// Gives the planner the frames that are shown now, so that the next layout
+// pass is animated from them. Nodes that were never laid out still have a new
+// layout and are left out, so that they are animated as created.
+void NativeUIManager::AddLayoutAnimationFrames() {
+  for (auto &tagToYogaNode : m_tagsToYogaNodes) {
+    YGNodeRef yogaNode = tagToYogaNode.second.get();
+    if (YGNodeGetHasNewLayout(yogaNode))
+      continue;
+
+    m_layoutAnimationPlanner.AddNodeFrame(
+        tagToYogaNode.first,
+        {YGNodeLayoutGetLeft(yogaNode),
+         YGNodeLayoutGetTop(yogaNode),
+         YGNodeLayoutGetWidth(yogaNode),
+         YGNodeLayoutGetHeight(yogaNode)});
+  }
+}
+
+void NativeUIManager::StartLayoutAnimation() {
+  if (!m_layoutAnimation) {
+    return;
+  }
+
+  auto transitions = m_layoutAnimationPlanner.PlanTransitions(m_layoutAnimation->Properties());
+  m_layoutAnimation.reset();
+  // Layout passes without an animation do not update the frames, so they are
+  // taken again from Yoga when the next animation is configured.
+  m_layoutAnimationPlanner.Clear();
+
+  m_layoutAnimationApplier.Apply(
+      transitions,
+      [this](int64_t tag) -> XamlView {
+        if (auto shadowNode = static_cast<ShadowNodeBase *>(m_host->FindShadowNodeForTag(tag))) {
+          return shadowNode->GetView();
+        }
+
+        return nullptr;
+      },
+      [callback = std::move(m_layoutAnimationCallback)]() {
+        if (callback) {
+          callback({});
+        }
+      });
+  m_layoutAnimationCallback = nullptr;
+}
+
 winrt::Windows::Foundation::Rect GetRectOfElementInParentCoords(
     xaml::FrameworkElement element,
     xaml::UIElement parent) {
@@ -5,7 +5,10 @@
 
 #include <INativeUIManager.h>
 #include <IReactRootView.h>
+#include <LayoutAnimation.h>
+#include <LayoutAnimationPlanner.h>
 #include <Views/ViewManagerBase.h>
+#include "LayoutAnimationApplier.h"
 
 #include <folly/dynamic.h>
 #include <yoga/yoga.h>
@@ -13,6 +16,7 @@
 #include <ReactHost/React.h>
 #include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace react::uwp {
@@ -34,9 +38,9 @@ class NativeUIManager final : public facebook::react::INativeUIManager {
   // INativeUIManager
   facebook::react::ShadowNode *createRootShadowNode(facebook::react::IReactRootView *rootView) override;
   void configureNextLayoutAnimation(
-      folly::dynamic && /*config*/,
-      facebook::xplat::module::CxxModule::Callback /*success*/,
-      facebook::xplat::module::CxxModule::Callback /*error*/) override{};
+      folly::dynamic &&config,
+      facebook::xplat::module::CxxModule::Callback success,
+      facebook::xplat::module::CxxModule::Callback error) override;
   void destroy() override;
   void destroyRootShadowNode(facebook::react::ShadowNode *) override;
   void removeRootView(facebook::react::ShadowNode &rootshadow) override;
@@ -51,6 +55,8 @@ class NativeUIManager final : public facebook::react::INativeUIManager {
       facebook::react::ShadowNode &childShadowNode,
       uint64_t index) override;
   void RemoveView(facebook::react::ShadowNode &shadowNode, bool removeChildren = true) override;
+  void RemoveViews(const std::vector<facebook::react::ShadowNode *> &nodes, bool removeChildren) override;
+  bool DeferRemoveView(facebook::react::ShadowNode &shadowNode) override;
   void ReplaceView(facebook::react::ShadowNode &shadowNode) override;
   void UpdateView(facebook::react::ShadowNode &shadowNode, folly::dynamic /*ReadableMap*/ props) override;
   void onBatchComplete() override;
@@ -91,6 +97,8 @@ class NativeUIManager final : public facebook::react::INativeUIManager {
 
  private:
   void DoLayout();
+  void StartLayoutAnimation();
+  void AddLayoutAnimationFrames();
   void UpdateExtraLayout(int64_t tag);
   YGNodeRef GetYogaNode(int64_t tag) const;
 
@@ -109,6 +117,13 @@ class NativeUIManager final : public facebook::react::INativeUIManager {
   std::vector<int64_t> m_extraLayoutNodes;
 
   std::map<int64_t, std::weak_ptr<IXamlReactControl>> m_tagsToXamlReactControl;
+
+  // Layout animation configured for the current batch. The planner tracks
+  // frames only while an animation is configured.
+  std::optional<facebook::react::LayoutAnimation> m_layoutAnimation;
+  facebook::xplat::module::CxxModule::Callback m_layoutAnimationCallback;
+  facebook::react::LayoutAnimationPlanner m_layoutAnimationPlanner;
+  LayoutAnimationApplier m_layoutAnimationApplier;
 };
 
 } // namespace react::uwp
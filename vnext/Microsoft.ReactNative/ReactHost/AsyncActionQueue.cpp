@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "AsyncActionQueue.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
 
 namespace Mso::React {
 
@@ -12,25 +15,33 @@ namespace Mso::React {
 AsyncActionQueue::AsyncActionQueue(Mso::DispatchQueue const &queue) noexcept : m_queue{queue} {}
 
 Mso::Future<void> AsyncActionQueue::PostAction(AsyncAction &&action) noexcept {
-  Mso::Internal::VerifyIsInQueueElseCrash(m_queue);
+  return PostAction(std::move(action), nullptr);
+}
 
-  Entry entry{std::move(action), Mso::Promise<void>{}};
-  Mso::Future<void> result = entry.Result.AsFuture();
-  if (!m_isInvoking && m_actions.empty()) {
-    InvokeAction(std::move(entry));
-  } else {
-    m_actions.push_back(std::move(entry));
-  }
+Mso::Future<void> AsyncActionQueue::PostActions(std::initializer_list<AsyncAction> actions) noexcept {
+  return PostActions(actions, nullptr);
+}
 
-  return result;
+Mso::Future<void> AsyncActionQueue::PostAction(AsyncAction &&action, AsyncActionKey key) noexcept {
+  Mso::Internal::VerifyIsInQueueElseCrash(m_queue);
+
+  CancelPendingActions(key);
+  return Enqueue(std::move(action), key);
 }
 
-Mso::Future<void> AsyncActionQueue::PostActions(std::initializer_list<AsyncAction> actions) noexcept {
+Mso::Future<void> AsyncActionQueue::PostActions(
+    std::initializer_list<AsyncAction> actions,
+    AsyncActionKey key) noexcept {
+  Mso::Internal::VerifyIsInQueueElseCrash(m_queue);
+
+  // Cancel once for the whole list to let the list items run one after another.
+  CancelPendingActions(key);
+
   // Return Future for the last action in the list
   Mso::Future<void> result;
   for (auto &action : actions) {
     // We must copy action because the initialize_list is read-only (a bug in the standard?).
-    result = PostAction(Mso::Copy(action));
+    result = Enqueue(Mso::Copy(action), key);
   }
 
   if (!result) {
@@ -40,6 +51,36 @@ Mso::Future<void> AsyncActionQueue::PostActions(std::initializer_list<AsyncActio
   return result;
 }
 
+Mso::Future<void> AsyncActionQueue::Enqueue(AsyncAction &&action, AsyncActionKey key) noexcept {
+  Entry entry{std::move(action), Mso::Promise<void>{}, key};
+  Mso::Future<void> result = entry.Result.AsFuture();
+  if (!m_isInvoking && m_actions.empty()) {
+    InvokeAction(std::move(entry));
+  } else {
+    m_actions.push_back(std::move(entry));
+  }
+
+  return result;
+}
+
+void AsyncActionQueue::CancelPendingActions(AsyncActionKey key) noexcept {
+  if (!key) {
+    return;
+  }
+
+  // Move the superseded entries out first: canceling their Promises may run continuations that post new actions.
+  std::vector<Entry> canceled;
+  auto it = std::stable_partition(
+      m_actions.begin(), m_actions.end(), [key](Entry const &entry) noexcept { return entry.Key != key; });
+  std::move(it, m_actions.end(), std::back_inserter(canceled));
+  m_actions.erase(it, m_actions.end());
+
+  for (auto &entry : canceled) {
+    entry.Action = nullptr;
+    entry.Result.TryCancel();
+  }
+}
+
 void AsyncActionQueue::InvokeAction(Entry &&entry) noexcept {
   m_isInvoking = true;
   auto actionResult = entry.Action();
@@ -53,12 +94,12 @@ void AsyncActionQueue::InvokeAction(Entry &&entry) noexcept {
 void AsyncActionQueue::CompleteAction(Entry &&entry, Mso::Maybe<void> &&result) noexcept {
   // Complete the action
   entry.Result.SetValue(std::move(result));
-  entry = {nullptr, nullptr}; // Release the action before the next one starts
+  entry = {nullptr, nullptr, nullptr}; // Release the action before the next one starts
 
   // Start the next action from the queue.
   if (!m_actions.empty()) {
-    auto nextActionEntry = std::move(m_actions[0]);
-    m_actions.erase(m_actions.begin());
+    auto nextActionEntry = std::move(m_actions.front());
+    m_actions.pop_front();
     InvokeAction(std::move(nextActionEntry));
   } else {
     m_isInvoking = false;
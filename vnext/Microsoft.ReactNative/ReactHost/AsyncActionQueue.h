@@ -7,15 +7,21 @@
 #include "activeObject/activeObject.h"
 #include "future/future.h"
 #include "object/refCountedObject.h"
+#include <deque>
 
 namespace Mso::React {
 
 //! The async action is a Functor that returns void Future.
 using AsyncAction = Mso::Functor<Mso::Future<void>()>;
 
+//! Identifies actions that supersede each other, e.g. the address of the object that posts them.
+//! A null key is never superseded.
+using AsyncActionKey = void const *;
+
 //! The queue that executes actions in the sequential order.
 //! Each action returns Mso::Future<void> to indicate its completion.
 //! The next action does not start until the previous action is completed.
+//! Actions posted with a non-null key cancel the not yet started actions with the same key.
 struct AsyncActionQueue final : Mso::RefCountedObjectNoVTable<Mso::RefCountStrategy::WeakRef, AsyncActionQueue> {
   //! Creates a new AsyncActionQueue that is based on the provided sequential queue.
   AsyncActionQueue(Mso::DispatchQueue const &queue) noexcept;
@@ -29,6 +35,15 @@ struct AsyncActionQueue final : Mso::RefCountedObjectNoVTable<Mso::RefCountStrat
   //! For the empty list it returns succeeded Future immediately.
   Mso::Future<void> PostActions(std::initializer_list<AsyncAction> actions) noexcept;
 
+  //! Posts a new action that supersedes the pending actions with the same key.
+  //! The superseded actions are not invoked and their Futures are canceled.
+  //! The action that is already running is not affected.
+  Mso::Future<void> PostAction(AsyncAction &&action, AsyncActionKey key) noexcept;
+
+  //! Posts a list of actions that supersedes the pending actions with the same key.
+  //! Actions in the list do not supersede each other.
+  Mso::Future<void> PostActions(std::initializer_list<AsyncAction> actions, AsyncActionKey key) noexcept;
+
   //! Returns the queue associated with the AsyncActionQueue.
   Mso::DispatchQueue const &Queue() noexcept;
 
@@ -36,9 +51,16 @@ struct AsyncActionQueue final : Mso::RefCountedObjectNoVTable<Mso::RefCountStrat
   struct Entry {
     AsyncAction Action;
     Mso::Promise<void> Result;
+    AsyncActionKey Key;
   };
 
  private:
+  //! Adds the action to the queue or invokes it if the queue is idle.
+  Mso::Future<void> Enqueue(AsyncAction &&action, AsyncActionKey key) noexcept;
+
+  //! Cancels the pending actions with the key.
+  void CancelPendingActions(AsyncActionKey key) noexcept;
+
   //! Invokes action in the m_queue and observes its result.
   void InvokeAction(Entry &&entry) noexcept;
 
@@ -48,7 +70,7 @@ struct AsyncActionQueue final : Mso::RefCountedObjectNoVTable<Mso::RefCountStrat
  private:
   const Mso::DispatchQueue m_queue;
   const Mso::InvokeElsePostExecutor m_executor{m_queue};
-  std::vector<Entry> m_actions;
+  std::deque<Entry> m_actions;
   bool m_isInvoking{false};
 };
 
@@ -66,7 +66,7 @@ Mso::Future<void> WhenAllCompleted(const std::vector<Mso::Future<void>> &futures
 }
 
 Mso::Future<void> MakeCanceledFuture() noexcept {
-  return Mso::MakeFailedFuture<void>(Mso::CancellationErrorProvider().MakeErrorCode(true));
+  return Mso::MakeFailedFuture<void>(Mso::CancellationErrorCode());
 }
 
 void SetPromiseValue(Mso::Promise<void> &&promise, const Mso::Future<void> &valueSource) noexcept {
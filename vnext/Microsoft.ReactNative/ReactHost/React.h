@@ -77,6 +77,9 @@ struct IReactContext : IUnknown {
   virtual winrt::Microsoft::ReactNative::IReactNotificationService Notifications() noexcept = 0;
   virtual winrt::Microsoft::ReactNative::IReactPropertyBag Properties() noexcept = 0;
   virtual void CallJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) noexcept = 0;
+  // Same as above for names kept by the caller. They are only copied if the call is made or queued.
+  virtual void
+  CallJSFunction(const std::string &module, const std::string &method, folly::dynamic &&params) noexcept = 0;
   virtual void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept = 0;
 };
 
@@ -209,6 +212,10 @@ struct ReactOptions {
   //! It is not safe to expose to Custom Function. Add this flag so we can turn it off for Custom Function.
   bool EnableNativePerformanceNow{true};
 
+  //! Flag controlling whether the UIManager constants only list the view manager names.
+  //! The constants of each view manager are then built and cached when JavaScript first uses it.
+  bool LazyViewManagerConstants{false};
+
   ReactDevOptions DeveloperSettings = {};
 
   //! This controls the availability of various developer support functionality including
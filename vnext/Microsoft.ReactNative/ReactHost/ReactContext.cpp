@@ -41,6 +41,17 @@ void ReactContext::CallJSFunction(std::string &&module, std::string &&method, fo
 #endif
 }
 
+void ReactContext::CallJSFunction(
+    const std::string &module,
+    const std::string &method,
+    folly::dynamic &&params) noexcept {
+#ifndef CORE_ABI // requires instance
+  if (auto instance = m_reactInstance.GetStrongPtr()) {
+    instance->CallJsFunction(module, method, std::move(params));
+  }
+#endif
+}
+
 void ReactContext::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept {
 #ifndef CORE_ABI // requires instance
   if (auto instance = m_reactInstance.GetStrongPtr()) {
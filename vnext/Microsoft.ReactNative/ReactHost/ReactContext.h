@@ -25,6 +25,7 @@ class ReactContext final : public Mso::UnknownObject<IReactContext> {
   winrt::Microsoft::ReactNative::IReactPropertyBag Properties() noexcept override;
   winrt::Microsoft::ReactNative::IReactNotificationService Notifications() noexcept override;
   void CallJSFunction(std::string &&module, std::string &&method, folly::dynamic &&params) noexcept override;
+  void CallJSFunction(const std::string &module, const std::string &method, folly::dynamic &&params) noexcept override;
   void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept override;
 
  private:
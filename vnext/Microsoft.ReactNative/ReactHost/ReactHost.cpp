@@ -278,12 +278,15 @@ Mso::Future<void> ReactHost::ReloadInstance() noexcept {
 
 Mso::Future<void> ReactHost::ReloadInstanceWithOptions(ReactOptions &&options) noexcept {
   return PostInQueue([ this, options = std::move(options) ]() mutable noexcept {
-    return m_actionQueue.Load()->PostActions({MakeUnloadInstanceAction(), MakeLoadInstanceAction(std::move(options))});
+    // A newer reload or unload supersedes the pending ones: only the last one determines the final state.
+    return m_actionQueue.Load()->PostActions(
+        {MakeUnloadInstanceAction(), MakeLoadInstanceAction(std::move(options))}, /*key:*/ this);
   });
 }
 
 Mso::Future<void> ReactHost::UnloadInstance() noexcept {
-  return PostInQueue([this]() noexcept { return m_actionQueue.Load()->PostAction(MakeUnloadInstanceAction()); });
+  return PostInQueue(
+      [this]() noexcept { return m_actionQueue.Load()->PostAction(MakeUnloadInstanceAction(), /*key:*/ this); });
 }
 
 AsyncAction ReactHost::MakeLoadInstanceAction(ReactOptions &&options) noexcept {
@@ -453,20 +456,21 @@ void ReactViewHost::SetOptions(ReactViewOptions &&options) noexcept {
 
 Mso::Future<void> ReactViewHost::ReloadViewInstance() noexcept {
   return m_reactHost->PostInQueue([this]() noexcept {
-    return m_actionQueue.Load()->PostActions({MakeUninitViewInstanceAction(), MakeInitViewInstanceAction()});
+    return m_actionQueue.Load()->PostActions(
+        {MakeUninitViewInstanceAction(), MakeInitViewInstanceAction()}, /*key:*/ this);
   });
 }
 
 Mso::Future<void> ReactViewHost::ReloadViewInstanceWithOptions(ReactViewOptions &&options) noexcept {
   return m_reactHost->PostInQueue([ this, options = std::move(options) ]() mutable noexcept {
     return m_actionQueue.Load()->PostActions(
-        {MakeUninitViewInstanceAction(), MakeInitViewInstanceAction(std::move(options))});
+        {MakeUninitViewInstanceAction(), MakeInitViewInstanceAction(std::move(options))}, /*key:*/ this);
   });
 }
 
 Mso::Future<void> ReactViewHost::UnloadViewInstance() noexcept {
   return m_reactHost->PostInQueue([this]() noexcept {
-    return m_actionQueue.Load()->PostAction(MakeUninitViewInstanceAction());
+    return m_actionQueue.Load()->PostAction(MakeUninitViewInstanceAction(), /*key:*/ this);
   });
 }
 
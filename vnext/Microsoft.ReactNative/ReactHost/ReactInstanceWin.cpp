@@ -94,7 +94,7 @@ struct LoadedCallbackGuard {
 
   ~LoadedCallbackGuard() noexcept {
     if (m_reactInstance) {
-      m_reactInstance->OnReactInstanceLoaded(Mso::CancellationErrorProvider().MakeErrorCode(true));
+      m_reactInstance->OnReactInstanceLoaded(Mso::CancellationErrorCode());
     }
   }
 
@@ -266,7 +266,8 @@ void ReactInstanceWin::Initialize() noexcept {
               m_uiMessageThread.Load(),
               std::move(m_appTheme),
               std::move(m_appearanceListener),
-              m_legacyReactInstance);
+              m_legacyReactInstance,
+              m_options.LazyViewManagerConstants);
 
           auto nmp = std::make_shared<winrt::Microsoft::ReactNative::NativeModulesProvider>();
 
@@ -471,7 +472,7 @@ Mso::Future<void> ReactInstanceWin::Destroy() noexcept {
   AbandonJSCallQueue();
 
   if (!m_isLoaded) {
-    OnReactInstanceLoaded(Mso::CancellationErrorProvider().MakeErrorCode(true));
+    OnReactInstanceLoaded(Mso::CancellationErrorCode());
   }
 
   if (auto onDestroyed = m_options.OnInstanceDestroyed.Get()) {
@@ -708,6 +709,20 @@ void ReactInstanceWin::CallJsFunction(
     std::string &&moduleName,
     std::string &&method,
     folly::dynamic &&params) noexcept {
+  CallJsFunctionImpl(std::move(moduleName), std::move(method), std::move(params));
+}
+
+void ReactInstanceWin::CallJsFunction(
+    const std::string &moduleName,
+    const std::string &method,
+    folly::dynamic &&params) noexcept {
+  CallJsFunctionImpl(moduleName, method, std::move(params));
+}
+
+// TString is either std::string or const std::string &. Names passed by reference are copied only when the call is
+// queued or made, because Instance::callJSFunction needs its own strings.
+template <class TString>
+void ReactInstanceWin::CallJsFunctionImpl(TString &&moduleName, TString &&method, folly::dynamic &&params) noexcept {
   bool shouldCall{false}; // To call callJSFunction outside of lock
   {
     std::scoped_lock lock{m_mutex};
@@ -716,14 +731,20 @@ void ReactInstanceWin::CallJsFunction(
     } else if (
         m_state == ReactInstanceState::Loading || m_state == ReactInstanceState::WaitingForDebugger ||
         (m_state == ReactInstanceState::Loaded && !m_jsCallQueue.empty())) {
-      m_jsCallQueue.push_back(JSCallEntry{std::move(moduleName), std::move(method), std::move(params)});
+      m_jsCallQueue.push_back(JSCallEntry{
+          std::string{std::forward<TString>(moduleName)},
+          std::string{std::forward<TString>(method)},
+          std::move(params)});
     }
     // otherwise ignore the call
   }
 
   if (shouldCall) {
     if (auto instance = m_instance.LoadWithLock()) {
-      instance->callJSFunction(std::move(moduleName), std::move(method), std::move(params));
+      instance->callJSFunction(
+          std::string{std::forward<TString>(moduleName)},
+          std::string{std::forward<TString>(method)},
+          std::move(params));
     }
   }
 }
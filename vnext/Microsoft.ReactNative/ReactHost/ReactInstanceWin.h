@@ -54,6 +54,8 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal,
 
  public: // ILegacyReactInstance
   void CallJsFunction(std::string &&moduleName, std::string &&method, folly::dynamic &&params) noexcept override;
+  // Copies the names only if the call is made or queued.
+  void CallJsFunction(const std::string &moduleName, const std::string &method, folly::dynamic &&params) noexcept;
   void DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept override;
 #ifndef CORE_ABI
   facebook::react::INativeUIManager *NativeUIManager() noexcept override;
@@ -114,6 +116,9 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal,
   void DrainJSCallQueue() noexcept;
   void AbandonJSCallQueue() noexcept;
 
+  template <class TString>
+  void CallJsFunctionImpl(TString &&moduleName, TString &&method, folly::dynamic &&params) noexcept;
+
   struct JSCallEntry {
     std::string ModuleName;
     std::string MethodName;
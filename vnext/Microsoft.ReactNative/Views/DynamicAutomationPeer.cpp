@@ -6,6 +6,7 @@
 #include "DynamicAutomationPeer.h"
 #include "DynamicAutomationProperties.h"
 #include "DynamicValueProvider.h"
+#include "ViewPanel.h"
 
 #include <UI.Xaml.Controls.h>
 
@@ -313,14 +314,28 @@ winrt::hstring DynamicAutomationPeer::GetContentName() const {
   try {
     if (auto const &viewControl = Owner().try_as<winrt::PROJECT_ROOT_NAMESPACE::ViewControl>()) {
       auto viewPanel = viewControl.GetPanel();
-
-      for (auto const &child : viewPanel.Children()) {
-        if (auto const &textBlock = child.try_as<winrt::TextBlock>()) {
-          name = name.empty() ? textBlock.Text() : (L" " + name + textBlock.Text());
-        } else if (auto const &stringableName = child.try_as<winrt::IStringable>()) {
-          name = (name.empty() ? L"" : L" ") + name + stringableName.ToString();
-        }
+      auto panel = winrt::get_self<ViewPanel>(viewPanel);
+
+      // UI Automation clients query names repeatedly, so the name is only built
+      // again when the children of the panel change.
+      if (m_contentNameCache.Update(
+              panel->ContentVersion(),
+              viewPanel.Children(),
+              [](auto const &child) { return winrt::get_abi(child); },
+              [](auto const &child, bool &isCacheable) -> winrt::hstring {
+                if (auto const &textBlock = child.try_as<winrt::TextBlock>()) {
+                  return textBlock.Text();
+                } else if (auto const &stringableName = child.try_as<winrt::IStringable>()) {
+                  // Nothing tells when the string changes.
+                  isCacheable = false;
+                  return stringableName.ToString();
+                }
+                return {};
+              })) {
+        m_contentName = winrt::hstring{m_contentNameCache.Name()};
       }
+
+      name = m_contentName;
     }
   } catch (...) {
   }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ContentName.h>
 #include <winrt/Windows.Foundation.h>
 
 #include "DynamicAutomationProperties.h"
@@ -79,6 +80,10 @@ struct DynamicAutomationPeer : DynamicAutomationPeerT<DynamicAutomationPeer> {
 
   winrt::PROJECT_ROOT_NAMESPACE::AccessibilityInvokeEventHandler GetAccessibilityInvokeEventHandler() const;
 
+  // Name built by GetContentName from the children of the ViewPanel
+  mutable facebook::react::ContentNameCache<void *> m_contentNameCache;
+  mutable winrt::hstring m_contentName;
+
   static xaml::DependencyProperty AccessibilityActionsProperty();
   static void SetAccessibilityActions(
       xaml::UIElement const &element,
@@ -0,0 +1,573 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+
+// Maps Windows virtual keys to the key and code values of DOM keyboard events.
+// The tables are built at compile time and indexed by the virtual key value, so
+// this header has no platform dependencies.
+
+namespace react::uwp {
+
+enum class HandledEventPhase {
+  Capturing = 1, // match the value with EventPhase in React. EventPhase
+                 // includes None, Capturing, AtTarget, Bubbling
+  Bubbling = 3
+};
+
+struct ModifiedKeyState {
+  bool altKey{false};
+  bool ctrlKey{false};
+  bool metaKey{false};
+  bool shiftKey{false};
+  bool capLocked{false};
+};
+
+// Index of a code value in c_codeNames plus one. Zero is reserved for
+// "Unidentified" and c_unknownCodeId for codes that no virtual key maps to.
+using KeyboardCodeId = uint8_t;
+
+constexpr std::string_view c_unidentifiedKey = "Unidentified";
+constexpr KeyboardCodeId c_unidentifiedCodeId = 0;
+constexpr KeyboardCodeId c_unknownCodeId = 0xFF;
+constexpr uint32_t c_virtualKeyCount = 256;
+
+struct VirtualKeyName {
+  uint8_t virtualKey;
+  std::string_view name;
+};
+
+// Should align to
+// https://developer.mozilla.org/en-US/docs/Web/API/KeyboardEvent/key/Key_Values
+// Virtual keys are given by value, commented with the name of their
+// Windows::System::VirtualKey member when it differs from the key. The first
+// entry of a virtual key listed more than once wins.
+inline constexpr VirtualKeyName c_keyNames[]{
+    // Alphanumeric keys. Their virtual keys match the ASCII representation of
+    // the digits and of the uppercase letters.
+    {48, "0"},
+    {49, "1"},
+    {50, "2"},
+    {51, "3"},
+    {52, "4"},
+    {53, "5"},
+    {54, "6"},
+    {55, "7"},
+    {56, "8"},
+    {57, "9"},
+    {65, "A"},
+    {66, "B"},
+    {67, "C"},
+    {68, "D"},
+    {69, "E"},
+    {70, "F"},
+    {71, "G"},
+    {72, "H"},
+    {73, "I"},
+    {74, "J"},
+    {75, "K"},
+    {76, "L"},
+    {77, "M"},
+    {78, "N"},
+    {79, "O"},
+    {80, "P"},
+    {81, "Q"},
+    {82, "R"},
+    {83, "S"},
+    {84, "T"},
+    {85, "U"},
+    {86, "V"},
+    {87, "W"},
+    {88, "X"},
+    {89, "Y"},
+    {90, "Z"},
+
+    // Modifier keys
+    {164, "Alt"}, // LeftMenu
+    {165, "Alt"}, // RightMenu
+    {18, "Alt"}, // Menu
+    {20, "CapsLock"}, // CapitalLock
+    {162, "Control"}, // LeftControl
+    {163, "Control"}, // RightControl
+    {17, "Control"},
+    {91, "Meta"}, // LeftWindows
+    {92, "Meta"}, // RightWindows
+    {144, "NumLock"}, // NumberKeyLock
+    {145, "ScrollLock"}, // Scroll
+    {160, "Shift"}, // LeftShift
+    {161, "Shift"}, // RightShift
+    {16, "Shift"},
+
+    // Whitespace keys
+    {13, "Enter"},
+    {9, "Tab"},
+    {32, " "}, // Space
+
+    // Navigation keys
+    {40, "ArrowDown"},
+    {37, "ArrowLeft"},
+    {39, "ArrowRight"},
+    {38, "ArrowUp"},
+    {35, "End"},
+    {36, "Home"},
+    {34, "PageDown"},
+    {33, "PageUp"},
+
+    // Editing keys
+    {8, "Backspace"}, // Back
+    {12, "Clear"},
+    {46, "Delete"},
+    {45, "Insert"},
+
+    // UI keys
+    {30, "Accept"},
+    {93, "ContextMenu"}, // Application
+    {27, "Escape"},
+    {43, "Execute"},
+    {47, "Help"},
+    {19, "Pause"},
+    {41, "Select"},
+
+    // Device keys
+    {44, "PrintScreen"}, // Snapshot
+    {95, "Standby"}, // Sleep
+
+    // Common IME keys
+    {28, "Convert"},
+    {24, "FinalMode"}, // Final
+    {31, "ModeChange"},
+    {29, "NonConvert"},
+
+    // Korean keyboards only
+    {21, "HangulMode"}, // Hangul
+    {25, "HanjaMode"}, // Hanja
+    {23, "JunjaMode"}, // Junja
+
+    // Japanese keyboards only
+    {21, "KanaMode"}, // Kana
+    {25, "KanjiMode"}, // Kanji
+
+    // Function keys
+    {112, "F1"},
+    {113, "F2"},
+    {114, "F3"},
+    {115, "F4"},
+    {116, "F5"},
+    {117, "F6"},
+    {118, "F7"},
+    {119, "F8"},
+    {120, "F9"},
+    {121, "F10"},
+    {122, "F11"},
+    {123, "F12"},
+    {124, "F13"},
+    {125, "F14"},
+    {126, "F15"},
+    {127, "F16"},
+    {128, "F17"},
+    {129, "F18"},
+    {130, "F19"},
+    {131, "F20"},
+
+    // Numeric keypad keys
+    {110, "Decimal"},
+    {106, "Multiply"},
+    {107, "Add"},
+    {111, "Divide"},
+    {109, "Subtract"},
+    {108, "Separator"},
+
+    {96, "0"}, // NumberPad0
+    {97, "1"}, // NumberPad1
+    {98, "2"}, // NumberPad2
+    {99, "3"}, // NumberPad3
+    {100, "4"}, // NumberPad4
+    {101, "5"}, // NumberPad5
+    {102, "6"}, // NumberPad6
+    {103, "7"}, // NumberPad7
+    {104, "8"}, // NumberPad8
+    {105, "9"}, // NumberPad9
+};
+
+// Align to https://www.w3.org/TR/uievents-code/
+// VirtualKey mapping is from
+// https://docs.microsoft.com/en-us/uwp/api/Windows.System.VirtualKey Other
+// codes are from
+// https://docs.microsoft.com/en-us/windows/win32/inputdev/virtual-key-codes
+// For the unsupported code, they are all commented and the key is 'None'. For
+// example, IntlBackslash is not sent to user:
+// //{None, "IntlBackslash"},
+// The position of a code defines its KeyboardCodeId, so each code is listed once.
+inline constexpr VirtualKeyName c_codeNames[]{
+    // Alphanumeric keys
+    {48, "Digit0"},
+    {49, "Digit1"},
+    {50, "Digit2"},
+    {51, "Digit3"},
+    {52, "Digit4"},
+    {53, "Digit5"},
+    {54, "Digit6"},
+    {55, "Digit7"},
+    {56, "Digit8"},
+    {57, "Digit9"},
+    {65, "KeyA"},
+    {66, "KeyB"},
+    {67, "KeyC"},
+    {68, "KeyD"},
+    {69, "KeyE"},
+    {70, "KeyF"},
+    {71, "KeyG"},
+    {72, "KeyH"},
+    {73, "KeyI"},
+    {74, "KeyJ"},
+    {75, "KeyK"},
+    {76, "KeyL"},
+    {77, "KeyM"},
+    {78, "KeyN"},
+    {79, "KeyO"},
+    {80, "KeyP"},
+    {81, "KeyQ"},
+    {82, "KeyR"},
+    {83, "KeyS"},
+    {84, "KeyT"},
+    {85, "KeyU"},
+    {86, "KeyV"},
+    {87, "KeyW"},
+    {88, "KeyX"},
+    {89, "KeyY"},
+    {90, "KeyZ"},
+
+    // writing system keys in the Alphanumeric section
+    {192, "Backquote"},
+    {220, "Backslash"},
+    {8, "Backspace"}, // Back
+    {219, "BracketLeft"},
+    {221, "BracketRight"},
+    {188, "Comma"},
+    {187, "Equal"},
+    //{None, "IntlBackslash"},
+    //{None, "IntlRo"},
+    //{None, "IntlYen"},
+    {189, "Minus"},
+    {190, "Period"},
+    {222, "Quote"},
+    {186, "Semicolon"},
+    {191, "Slash"},
+
+    // Functional Keys
+    {164, "AltLeft"}, // LeftMenu
+    {165, "AltRight"}, // RightMenu
+    {20, "CapsLock"}, // CapitalLock
+    {18, "ContextMenu"}, // Menu
+    {162, "ControlLeft"}, // LeftControl
+    {163, "ControlRight"}, // RightControl
+    {13, "Enter"},
+    {91, "MetaLeft"}, // LeftWindows
+    {92, "MetaRight"}, // RightWindows
+    {160, "ShiftLeft"}, // LeftShift
+    {161, "ShiftRight"}, // RightShift
+    {32, "Space"},
+    {9, "Tab"},
+
+    // List of code values for functional keys found on Japanese and Korean
+    // keyboards.
+    {28, "Convert"},
+    {21, "KanaMode"}, // Kana
+    {21, "Lang1"}, // Hangul
+    {25, "Lang2"}, // Hanja
+    //{None, "Lang3"},
+    //{None, "Lang4"},
+    //{None, "Lang5"},
+    {29, "NonConvert"},
+
+    // Control Pad Section
+    {46, "Delete"},
+    {35, "End"},
+    {47, "Help"},
+    {36, "Home"},
+    {45, "Insert"},
+    {34, "PageDown"},
+    {33, "PageUp"},
+
+    // Arrow Pad Section
+    {40, "ArrowDown"},
+    {37, "ArrowLeft"},
+    {39, "ArrowRight"},
+    {38, "ArrowUp"},
+
+    // Numpad Section
+    {144, "NumLock"}, // NumberKeyLock
+    {96, "Numpad0"}, // NumberPad0
+    {97, "Numpad1"}, // NumberPad1
+    {98, "Numpad2"}, // NumberPad2
+    {99, "Numpad3"}, // NumberPad3
+    {100, "Numpad4"}, // NumberPad4
+    {101, "Numpad5"}, // NumberPad5
+    {102, "Numpad6"}, // NumberPad6
+    {103, "Numpad7"}, // NumberPad7
+    {104, "Numpad8"}, // NumberPad8
+    {105, "Numpad9"}, // NumberPad9
+    {107, "NumpadAdd"},
+    //{None, "NumpadBackspace"},
+    //{None, "NumpadClear"},
+    //{None, "NumpadClearEntry"},
+    //{None, "NumpadComma"},
+    {110, "NumpadDecimal"},
+    {111, "NumpadDivide"},
+    //{None, "NumpadEnter"},
+    //{None, "NumpadEqual"},
+    //{None, "NumpadHash"},
+    //{None, "NumpadMemoryAdd"},
+    //{None, "NumpadMemoryClear"},
+    //{None, "NumpadMemoryRecall"},
+    //{None, "NumpadMemoryStore"},
+    //{None, "NumpadMemorySubtract"},
+    {106, "NumpadMultiply"},
+    //{None, "NumpadParenLeft"},
+    //{None, "NumpadParenRight"},
+    //{None, "NumpadStar"},
+    {109, "NumpadSubtract"},
+
+    // Function Section
+    {27, "Escape"},
+    {112, "F1"},
+    {113, "F2"},
+    {114, "F3"},
+    {115, "F4"},
+    {116, "F5"},
+    {117, "F6"},
+    {118, "F7"},
+    {119, "F8"},
+    {120, "F9"},
+    {121, "F10"},
+    {122, "F11"},
+    {123, "F12"},
+    {124, "F13"},
+    {125, "F14"},
+    {126, "F15"},
+    {127, "F16"},
+    {128, "F17"},
+    {129, "F18"},
+    {130, "F19"},
+    {131, "F20"},
+    {132, "F21"},
+    {133, "F22"},
+    {134, "F23"},
+    {135, "F24"},
+    //{None, "Fn"},
+    //{None, "FnLock"},
+    {42, "PrintScreen"}, // Print
+    {145, "ScrollLock"}, // Scroll
+    {19, "Pause"},
+
+    //// Media Keys
+    {166, "BrowserBack"}, // GoBack
+    {171, "BrowserFavorites"},
+    {167, "BrowserForward"}, // GoForward
+    {172, "BrowserHome"}, // GoHome
+    {168, "BrowserRefresh"},
+    {170, "BrowserSearch"},
+    {169, "BrowserStop"},
+    //{None, "Eject"},
+    {182, "LaunchApp1"},
+    {183, "LaunchApp2"},
+    {180, "LaunchMail"},
+    {179, "MediaPlayPause"},
+    {181, "MediaSelect"},
+    {178, "MediaStop"},
+    {176, "MediaTrackNext"},
+    {177, "MediaTrackPrevious"},
+    //{None, "Power"},
+    {95, "Sleep"},
+    {174, "AudioVolumeDown"},
+    {173, "AudioVolumeMute"},
+    {175, "AudioVolumeUp"},
+    //{None, "WakeUp"},
+
+    ////List of code values for legacy modifier keys.
+    //{None, "Hyper"},
+    //{None, "Super"},
+    //{None, "Turbo"},
+
+    ////List of code values for legacy process control keys.
+    //{None, "Abort"},
+    //{None, "Resume"},
+    //{None, "Suspend"},
+
+    ////List of code values for legacy editing keys.
+    //{None, "Again"},
+    //{None, "Copy"},
+    //{None, "Cut"},
+    //{None, "Find"},
+    //{None, "Open"},
+    //{None, "Paste"},
+    //{None, "Props"},
+    {41, "Select"},
+    //{None, "Undo"},
+
+    // The following keys may be found on non-standard international keyboards.
+    //{None, "Hiragana"},
+    //{None, "Katakana"},
+    //{None, "Undo"},
+
+    // Xbox Gamepad
+    {195, "GamepadA"},
+    {196, "GamepadB"},
+    {197, "GamepadX"},
+    {198, "GamepadY"},
+    {199, "GamepadRightShoulder"},
+    {200, "GamepadLeftShoulder"},
+    {201, "GamepadLeftTrigger"},
+    {202, "GamepadRightTrigger"},
+    {203, "GamepadDPadUp"},
+    {204, "GamepadDPadDown"},
+    {205, "GamepadDPadLeft"},
+    {206, "GamepadDPadRight"},
+    {207, "GamepadMenu"},
+    {208, "GamepadView"},
+    {209, "GamepadLeftThumbstickButton"},
+    {210, "GamepadRightThumbstickButton"},
+    {211, "GamepadLeftThumbstickUp"},
+    {212, "GamepadLeftThumbstickDown"},
+    {213, "GamepadLeftThumbstickRight"},
+    {214, "GamepadLeftThumbstickLeft"},
+    {215, "GamepadRightThumbstickUp"},
+    {216, "GamepadRightThumbstickDown"},
+    {217, "GamepadRightThumbstickRight"},
+    {218, "GamepadRightThumbstickLeft"},
+};
+
+static_assert(std::size(c_codeNames) < c_unknownCodeId, "Every code must have a KeyboardCodeId");
+
+namespace detail {
+
+template <size_t N>
+constexpr std::array<std::string_view, c_virtualKeyCount> MakeVirtualKeyToKey(
+    const VirtualKeyName (&keyNames)[N]) noexcept {
+  std::array<std::string_view, c_virtualKeyCount> table{};
+  for (size_t i = 0; i < N; ++i) {
+    if (table[keyNames[i].virtualKey].empty()) {
+      table[keyNames[i].virtualKey] = keyNames[i].name;
+    }
+  }
+
+  for (size_t virtualKey = 0; virtualKey < c_virtualKeyCount; ++virtualKey) {
+    if (table[virtualKey].empty()) {
+      table[virtualKey] = c_unidentifiedKey;
+    }
+  }
+
+  return table;
+}
+
+template <size_t N>
+constexpr std::array<KeyboardCodeId, c_virtualKeyCount> MakeVirtualKeyToCodeId(
+    const VirtualKeyName (&codeNames)[N]) noexcept {
+  std::array<KeyboardCodeId, c_virtualKeyCount> table{};
+  for (size_t i = 0; i < N; ++i) {
+    if (table[codeNames[i].virtualKey] == c_unidentifiedCodeId) {
+      table[codeNames[i].virtualKey] = static_cast<KeyboardCodeId>(i + 1);
+    }
+  }
+
+  return table;
+}
+
+} // namespace detail
+
+inline constexpr std::array<std::string_view, c_virtualKeyCount> c_virtualKeyToKey =
+    detail::MakeVirtualKeyToKey(c_keyNames);
+inline constexpr std::array<KeyboardCodeId, c_virtualKeyCount> c_virtualKeyToCodeId =
+    detail::MakeVirtualKeyToCodeId(c_codeNames);
+
+// Returns the KeyboardEvent.key value of a virtual key.
+constexpr std::string_view VirtualKeyToKey(uint32_t virtualKey) noexcept {
+  return virtualKey < c_virtualKeyCount ? c_virtualKeyToKey[virtualKey] : c_unidentifiedKey;
+}
+
+// Returns the id of the KeyboardEvent.code value of a virtual key.
+constexpr KeyboardCodeId VirtualKeyToCodeId(uint32_t virtualKey) noexcept {
+  return virtualKey < c_virtualKeyCount ? c_virtualKeyToCodeId[virtualKey] : c_unidentifiedCodeId;
+}
+
+// Returns the KeyboardEvent.code value of a code id. Unknown codes were not
+// kept, so they are reported as unidentified.
+constexpr std::string_view CodeIdToCode(KeyboardCodeId codeId) noexcept {
+  return codeId != c_unidentifiedCodeId && codeId <= std::size(c_codeNames) ? c_codeNames[codeId - 1].name
+                                                                            : c_unidentifiedKey;
+}
+
+// Returns the id of a KeyboardEvent.code value, e.g. one received from JS. It
+// is only used when the handled events of a view change, so a linear search is
+// good enough.
+constexpr KeyboardCodeId CodeToCodeId(std::string_view code) noexcept {
+  if (code == c_unidentifiedKey) {
+    return c_unidentifiedCodeId;
+  }
+
+  for (size_t i = 0; i < std::size(c_codeNames); ++i) {
+    if (c_codeNames[i].name == code) {
+      return static_cast<KeyboardCodeId>(i + 1);
+    }
+  }
+
+  return c_unknownCodeId;
+}
+
+struct HandledKeyboardEvent : ModifiedKeyState {
+  HandledEventPhase handledEventPhase{HandledEventPhase::Bubbling};
+  KeyboardCodeId codeId{c_unidentifiedCodeId};
+};
+
+// Keyboard events that a view marks as handled. The code, the modifier keys
+// and the phase of an event fit in 13 bits, so the events are kept in a bitset
+// and each lookup is a single bit test. The capLocked state is ignored.
+class HandledKeyboardEventSet {
+ public:
+  void Add(const HandledKeyboardEvent &event) {
+    if (!m_events) {
+      m_events = std::make_unique<Events>();
+    }
+
+    m_events->set(IndexOf(event));
+  }
+
+  bool Contains(const HandledKeyboardEvent &event) const noexcept {
+    return m_events && m_events->test(IndexOf(event));
+  }
+
+  void Clear() noexcept {
+    m_events.reset();
+  }
+
+  bool IsEmpty() const noexcept {
+    return !m_events || m_events->none();
+  }
+
+ private:
+  static constexpr size_t c_modifierCount = 4;
+  using Events = std::bitset<(size_t{1} << (8 * sizeof(KeyboardCodeId) + c_modifierCount + 1))>;
+
+  static constexpr size_t IndexOf(const HandledKeyboardEvent &event) noexcept {
+    size_t index = event.handledEventPhase == HandledEventPhase::Capturing ? 1 : 0;
+    index = (index << 1) | (event.altKey ? 1 : 0);
+    index = (index << 1) | (event.ctrlKey ? 1 : 0);
+    index = (index << 1) | (event.metaKey ? 1 : 0);
+    index = (index << 1) | (event.shiftKey ? 1 : 0);
+    return (index << (8 * sizeof(KeyboardCodeId))) | event.codeId;
+  }
+
+ private:
+  // Most views handle no keyboard event, so the bits are allocated on the
+  // first event added.
+  std::unique_ptr<Events> m_events;
+};
+
+} // namespace react::uwp
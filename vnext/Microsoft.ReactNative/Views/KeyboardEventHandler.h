@@ -7,6 +7,7 @@
 #include <optional>
 #include <set>
 #include "CppWinRTIncludes.h"
+#include "Views/KeyboardCodes.h"
 #include "XamlView.h"
 
 namespace winrt {
@@ -14,31 +15,12 @@ using namespace Windows::UI::Core;
 } // namespace winrt
 
 namespace react::uwp {
-enum class HandledEventPhase {
-  Capturing = 1, // match the value with EventPhase in React. EventPhase
-                 // includes None, Capturing, AtTarget, Bubbling
-  Bubbling = 3
-};
-
-struct ModifiedKeyState {
-  bool altKey{false};
-  bool ctrlKey{false};
-  bool metaKey{false};
-  bool shiftKey{false};
-  bool capLocked{false};
-};
-
 struct ReactKeyboardEvent : ModifiedKeyState {
   int64_t target{0};
   std::string key{};
   std::string code{};
 };
 
-struct HandledKeyboardEvent : ModifiedKeyState {
-  HandledEventPhase handledEventPhase{HandledEventPhase::Bubbling};
-  std::string code{};
-};
-
 typedef std::function<void(winrt::IInspectable const &, xaml::Input::KeyRoutedEventArgs const &)> KeyboardEventCallback;
 
 class KeyboardEventBaseHandler {
@@ -109,12 +91,9 @@ class HandledKeyboardEventHandler {
       KeyboardEventPhase phase,
       winrt::IInspectable const &sender,
       xaml::Input::KeyRoutedEventArgs const &args);
-  bool ShouldMarkKeyboardHandled(
-      std::vector<HandledKeyboardEvent> const &handledEvents,
-      HandledKeyboardEvent currentEvent);
 
-  std::vector<HandledKeyboardEvent> m_handledKeyUpKeyboardEvents;
-  std::vector<HandledKeyboardEvent> m_handledKeyDownKeyboardEvents;
+  HandledKeyboardEventSet m_handledKeyUpKeyboardEvents;
+  HandledKeyboardEventSet m_handledKeyDownKeyboardEvents;
 
   std::unique_ptr<PreviewKeyboardEventHandler> m_previewKeyboardEventHandler;
   std::unique_ptr<KeyboardEventHandler> m_keyboardEventHandler;
@@ -123,8 +102,8 @@ class HandledKeyboardEventHandler {
 struct KeyboardHelper {
   static std::vector<HandledKeyboardEvent> FromJS(folly::dynamic const &obj);
   static HandledKeyboardEvent CreateKeyboardEvent(HandledEventPhase phase, xaml::Input::KeyRoutedEventArgs const &args);
-  static std::string FromVirtualKey(winrt::Windows::System::VirtualKey key, bool shiftDown, bool capLocked);
-  static std::string CodeFromVirtualKey(winrt::Windows::System::VirtualKey key);
+  static std::string_view FromVirtualKey(winrt::Windows::System::VirtualKey key, bool shiftDown, bool capLocked);
+  static KeyboardCodeId CodeIdFromVirtualKey(winrt::Windows::System::VirtualKey key);
   static bool IsModifiedKeyPressed(winrt::CoreWindow const &coreWindow, winrt::Windows::System::VirtualKey virtualKey);
   static bool IsModifiedKeyLocked(winrt::CoreWindow const &coreWindow, winrt::Windows::System::VirtualKey virtualKey);
 };
@@ -87,7 +87,7 @@ struct REACTWINDOWS_EXPORT ShadowNodeBase : public facebook::react::ShadowNode {
   int64_t GetParent() const {
     return m_parent;
   }
-  virtual bool IsWindowed() {
+  bool IsWindowed() override {
     return false;
   }
 
@@ -15,6 +15,7 @@
 #include <Utils/ValueUtils.h>
 
 #include <IReactInstance.h>
+#include <TextInputReconciler.h>
 
 #ifdef USE_WINUI3
 namespace winrt::Microsoft::UI::Xaml::Controls {
@@ -119,8 +120,13 @@ class TextInputShadowNode : public ShadowNodeBase {
   bool m_contextMenuHidden = false;
   bool m_hideCaret = false;
   bool m_isTextBox = true;
+  bool m_textChangeDeltas = false;
   folly::dynamic m_placeholderTextColor;
 
+  // Text last sent to javascript, used to send only the edited range when
+  // textChangeDeltas is set.
+  facebook::react::TextInputReconciler m_textReconciler;
+
   // Javascripts is running in a different thread. If the typing is very fast,
   // It's possible that two TextChanged are raised but TextInput just got the
   // first response from Javascript. So the first response should be dropped.
@@ -157,8 +163,22 @@ void TextInputShadowNode::dispatchTextInputChangeEvent(winrt::hstring newText) {
 
   if (auto instance = wkinstance.lock()) {
     m_nativeEventCount++;
-    folly::dynamic eventData =
-        folly::dynamic::object("target", m_tag)("text", HstringToDynamic(newText))("eventCount", m_nativeEventCount);
+    folly::dynamic eventData;
+    if (m_textChangeDeltas && m_textReconciler.HasBaseline()) {
+      // Javascript rebuilds the text from the one of the previous event, so
+      // only the edited range needs to be converted and serialized.
+      auto edit = m_textReconciler.TakeEdit(newText);
+      folly::dynamic range =
+          folly::dynamic::object("start", static_cast<int64_t>(edit.start))("end", static_cast<int64_t>(edit.end));
+      eventData = folly::dynamic::object("target", m_tag)("text", Microsoft::Common::Unicode::Utf16ToUtf8(edit.text))(
+          "range", std::move(range))("eventCount", m_nativeEventCount);
+    } else {
+      if (m_textChangeDeltas) {
+        m_textReconciler.Reset(newText);
+      }
+      eventData =
+          folly::dynamic::object("target", m_tag)("text", HstringToDynamic(newText))("eventCount", m_nativeEventCount);
+    }
     instance->DispatchEvent(m_tag, "topTextInputChange", std::move(eventData));
   }
 }
@@ -168,6 +188,9 @@ void TextInputShadowNode::registerEvents() {
   auto wkinstance = GetViewManager()->GetReactInstance();
   auto tag = m_tag;
 
+  // The text of a new control is sent in full with its first change.
+  m_textReconciler.Clear();
+
   // TextChanged is implemented as async event in Xaml. If Javascript is like
   // this:
   //    onChangeText={text => this.setState({text})}
@@ -424,6 +447,13 @@ void TextInputShadowNode::updateProperties(const folly::dynamic &&props) {
       if (propertyValue.isNumber()) {
         m_mostRecentEventCount = static_cast<uint32_t>(propertyValue.asInt());
       }
+    } else if (propertyName == "textChangeDeltas") {
+      if (propertyValue.isBool()) {
+        m_textChangeDeltas = propertyValue.asBool();
+      } else if (propertyValue.isNull()) {
+        m_textChangeDeltas = false;
+      }
+      m_textReconciler.Clear();
     } else if (propertyName == "contextMenuHidden") {
       if (propertyValue.isBool())
         m_contextMenuHidden = propertyValue.asBool();
@@ -613,7 +643,7 @@ folly::dynamic TextInputViewManager::GetNativeProps() const {
       "placeholderTextColor", "Color")("scrollEnabled", "boolean")("selection", "Map")("selectionColor", "Color")(
       "selectTextOnFocus", "boolean")("spellCheck", "boolean")("text", "string")("mostRecentEventCount", "int")(
       "secureTextEntry", "boolean")("keyboardType", "string")("contextMenuHidden", "boolean")("caretHidden", "boolean")(
-      "autoCapitalize", "string"));
+      "autoCapitalize", "string")("textChangeDeltas", "boolean"));
 
   return props;
 }
@@ -6,6 +6,7 @@
 #include "TextViewManager.h"
 
 #include <Views/ShadowNodeBase.h>
+#include <Views/ViewPanel.h>
 
 #include <UI.Xaml.Automation.Peers.h>
 #include <UI.Xaml.Automation.h>
@@ -43,6 +44,7 @@ class TextShadowNode : public ShadowNodeBase {
         m_firstChildNode = &child;
         auto textBlock = this->GetView().as<xaml::Controls::TextBlock>();
         textBlock.Text(run.Text());
+        ViewPanel::NotifyChildContentChanged(textBlock);
         return;
       }
     } else if (index == 1 && m_firstChildNode != nullptr) {
@@ -52,11 +54,13 @@ class TextShadowNode : public ShadowNodeBase {
       m_firstChildNode = nullptr;
     }
     Super::AddView(child, index);
+    ViewPanel::NotifyChildContentChanged(GetView());
   }
 
   void removeAllChildren() override {
     m_firstChildNode = nullptr;
     Super::removeAllChildren();
+    ViewPanel::NotifyChildContentChanged(GetView());
   }
 
   void RemoveChildAt(int64_t indexToRemove) override {
@@ -64,6 +68,7 @@ class TextShadowNode : public ShadowNodeBase {
       m_firstChildNode = nullptr;
     }
     Super::RemoveChildAt(indexToRemove);
+    ViewPanel::NotifyChildContentChanged(GetView());
   }
 };
 
@@ -162,6 +167,9 @@ YGMeasureFunc TextViewManager::GetYogaCustomMeasureFunc() const {
 
 void TextViewManager::OnDescendantTextPropertyChanged(ShadowNodeBase *node) {
   if (auto element = node->GetView().try_as<xaml::Controls::TextBlock>()) {
+    // The text may be part of the name of the parent view.
+    ViewPanel::NotifyChildContentChanged(element);
+
     // If name is set, it's controlled by accessibilityLabel, and it's already
     // handled in FrameworkElementViewManager. Here it only handles when name is
     // not set.
@@ -14,6 +14,7 @@
 #include <IReactInstance.h>
 #include <IXamlRootView.h>
 #include <TestHook.h>
+#include <UI.Xaml.Media.h>
 #include <Views/ShadowNodeBase.h>
 
 using namespace folly;
@@ -296,6 +297,12 @@ void ViewManagerBase::SetLayoutProps(
   fe.Width(width);
   fe.Height(height);
 
+  // Lets the parent panel arrange the element without reading back the
+  // properties above.
+  if (auto panel = xaml::Media::VisualTreeHelper::GetParent(element).try_as<ViewPanel>()) {
+    panel->CommitChildLayout(element, {left, top, width, height});
+  }
+
   // Fire Events
   if (nodeToUpdate.m_onLayout) {
     int64_t tag = GetTag(viewToUpdate);
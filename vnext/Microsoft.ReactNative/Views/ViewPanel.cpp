@@ -10,6 +10,8 @@
 #include <Utils/PropertyUtils.h>
 #include <Utils/ResourceBrushUtils.h>
 #include <winrt/Windows.Foundation.h>
+#include <algorithm>
+#include <atomic>
 #include <winrt/Windows.UI.Xaml.Interop.h>
 
 // Needed for latest versions of C++/WinRT
@@ -32,7 +34,12 @@ namespace winrt::PROJECT_ROOT_NAMESPACE::implementation {
 
 const winrt::TypeName viewPanelTypeName{winrt::hstring{L"ViewPanel"}, winrt::TypeKind::Metadata};
 
-ViewPanel::ViewPanel() : Super() {}
+// Panels may live on different UI threads.
+static std::atomic<uint64_t> s_lastContentVersion{0};
+
+ViewPanel::ViewPanel() : Super() {
+  OnContentChanged();
+}
 
 winrt::AutomationPeer ViewPanel::OnCreateAutomationPeer() {
   // The parent ViewControl handles the peer needs
@@ -139,8 +146,13 @@ winrt::Size ViewPanel::MeasureOverride(winrt::Size /*availableSize*/) {
   // All children are given as much size as they'd like
   winrt::Size childConstraint(INFINITY, INFINITY);
 
-  for (xaml::UIElement child : Children())
-    child.Measure(childConstraint);
+  // The constraint never changes, so children only need to be measured when
+  // they are added or Yoga resizes them. Xaml measures children whose content
+  // changed on its own.
+  for (xaml::UIElement child : Children()) {
+    if (m_childLayouts.TakeNeedsMeasure(winrt::get_abi(child)))
+      child.Measure(childConstraint);
+  }
 
   // ViewPanels never choose their size, that is completely up to the parent -
   // so return no size
@@ -158,14 +170,23 @@ winrt::Size ViewPanel::ArrangeOverride(winrt::Size finalSize) {
     outerBorderLeft = static_cast<float>(borderThickness.Left);
     outerBorderTop = static_cast<float>(borderThickness.Top);
   }
+  const bool hasInnerBorder = m_border != nullptr && !m_hasOuterBorder;
   for (xaml::UIElement child : Children()) {
     double childHeight = 0.0;
     double childWidth = 0.0;
+    double childLeft = 0.0;
+    double childTop = 0.0;
+    const facebook::react::LayoutFrame *frame = m_childLayouts.ArrangeChild(winrt::get_abi(child));
 
     // A Border or inner ViewPanel should take up the same space as this panel
-    if (child == m_border) {
+    if (hasInnerBorder && child == m_border) {
       childWidth = finalSize.Width;
       childHeight = finalSize.Height;
+    } else if (frame != nullptr) {
+      childLeft = frame->left;
+      childTop = frame->top;
+      childWidth = frame->width;
+      childHeight = frame->height;
     } else {
       // We expect elements to have been arranged by yoga which means their
       // Width & Height are set
@@ -179,41 +200,139 @@ winrt::Size ViewPanel::ArrangeOverride(winrt::Size finalSize) {
         childWidth = child.DesiredSize().Width;
         childHeight = child.DesiredSize().Height;
       }
+
+      childLeft = ViewPanel::GetLeft(child);
+      childTop = ViewPanel::GetTop(child);
     }
 
     // Guard against negative values
     childWidth = std::max<double>(0.0f, childWidth);
     childHeight = std::max<double>(0.0f, childHeight);
 
-    float adjustedLeft = static_cast<float>(ViewPanel::GetLeft(child)) - outerBorderLeft;
-    float adjustedTop = static_cast<float>(ViewPanel::GetTop(child)) - outerBorderTop;
+    float adjustedLeft = static_cast<float>(childLeft) - outerBorderLeft;
+    float adjustedTop = static_cast<float>(childTop) - outerBorderTop;
 
     child.Arrange(
         winrt::Rect(adjustedLeft, adjustedTop, static_cast<float>(childWidth), static_cast<float>(childHeight)));
   }
+  m_childLayouts.EndArrange();
 
   UpdateClip(finalSize);
 
   return finalSize;
 }
 
-void ViewPanel::InsertAt(uint32_t const index, xaml::UIElement const &value) const {
-  Children().InsertAt(index, value);
+void ViewPanel::InsertAt(uint32_t const index, xaml::UIElement const &value) {
+  // The element may have been laid out in another panel
+  m_childLayouts.RemoveChild(winrt::get_abi(value));
+  Children().InsertAt(ToChildrenIndex(index), value);
+  OnContentChanged();
 }
 
-void ViewPanel::RemoveAt(uint32_t const index) const {
-  Children().RemoveAt(index);
+void ViewPanel::RemoveAt(uint32_t const index) {
+  const uint32_t childrenIndex = ToChildrenIndex(index);
+  m_childLayouts.RemoveChild(winrt::get_abi(Children().GetAt(childrenIndex)));
+  Children().RemoveAt(childrenIndex);
+  OnContentChanged();
 }
 
-void ViewPanel::Remove(xaml::UIElement element) const {
+bool ViewPanel::ReplaceChild(xaml::UIElement const &oldChild, xaml::UIElement const &newChild) {
   uint32_t index;
+  if (!Children().IndexOf(oldChild, index))
+    return false;
+
+  m_childLayouts.RemoveChild(winrt::get_abi(oldChild));
+  m_childLayouts.RemoveChild(winrt::get_abi(newChild));
+  Children().SetAt(index, newChild);
+  OnContentChanged();
+  return true;
+}
+
+void ViewPanel::InsertKeptChild(
+    xaml::UIElement const &element,
+    xaml::UIElement const &previousSibling,
+    uint32_t childIndex) {
+  auto children = Children();
+  uint32_t index;
+  if (children.IndexOf(element, index))
+    return;
+
+  if (!previousSibling) {
+    index = 0;
+  } else if (children.IndexOf(previousSibling, index)) {
+    ++index;
+  } else {
+    index = std::min(childIndex, children.Size());
+  }
+
+  children.InsertAt(index, element);
+  m_keptChildren.push_back(winrt::get_abi(element));
+  OnContentChanged();
+}
+
+void ViewPanel::RemoveKeptChild(xaml::UIElement const &element) {
+  auto it = std::find(m_keptChildren.begin(), m_keptChildren.end(), winrt::get_abi(element));
+  if (it == m_keptChildren.end())
+    return;
 
-  if (Children().IndexOf(element, index))
+  m_keptChildren.erase(it);
+  // The panel may have been cleared in the meantime.
+  uint32_t index;
+  if (Children().IndexOf(element, index)) {
     Children().RemoveAt(index);
+    OnContentChanged();
+  }
+}
+
+bool ViewPanel::IsKeptChild(xaml::UIElement const &child) const noexcept {
+  return std::find(m_keptChildren.begin(), m_keptChildren.end(), winrt::get_abi(child)) != m_keptChildren.end();
 }
 
-void ViewPanel::Clear() const {
+uint32_t ViewPanel::ToChildrenIndex(uint32_t index) {
+  if (m_keptChildren.empty())
+    return index;
+
+  uint32_t childrenIndex = 0;
+  for (xaml::UIElement child : Children()) {
+    if (!IsKeptChild(child)) {
+      if (index == 0)
+        return childrenIndex;
+      --index;
+    }
+    ++childrenIndex;
+  }
+
+  return childrenIndex + index;
+}
+
+void ViewPanel::Remove(xaml::UIElement element) {
+  uint32_t index;
+
+  if (Children().IndexOf(element, index)) {
+    m_childLayouts.RemoveChild(winrt::get_abi(element));
+    Children().RemoveAt(index);
+    OnContentChanged();
+  }
+}
+
+void ViewPanel::Clear() {
+  m_childLayouts.Clear();
+  m_keptChildren.clear();
   Children().Clear();
+  OnContentChanged();
+}
+
+void ViewPanel::OnContentChanged() noexcept {
+  m_contentVersion = ++s_lastContentVersion;
+}
+
+/*static*/ void ViewPanel::NotifyChildContentChanged(xaml::DependencyObject const &child) {
+  if (auto panel = winrt::VisualTreeHelper::GetParent(child).try_as<ViewPanel>())
+    panel->OnContentChanged();
+}
+
+void ViewPanel::CommitChildLayout(xaml::UIElement const &child, facebook::react::LayoutFrame const &frame) {
+  m_childLayouts.CommitLayout(winrt::get_abi(child), frame);
 }
 
 void ViewPanel::ViewBackground(winrt::Brush const &value) {
@@ -5,6 +5,8 @@
 
 #include "ViewPanel.g.h"
 
+#include <ChildLayoutTable.h>
+
 #ifndef PROJECT_ROOT_NAMESPACE
 #define PROJECT_ROOT_NAMESPACE react::uwp
 #else
@@ -33,9 +35,43 @@ struct ViewPanel : ViewPanelT<ViewPanel> {
   virtual winrt::Windows::Foundation::Size ArrangeOverride(winrt::Windows::Foundation::Size finalSize);
 
   // Public Methods
-  void InsertAt(uint32_t const index, xaml::UIElement const &value) const;
-  void RemoveAt(uint32_t const index) const;
-  void Clear() const;
+  // The indices do not count the children kept for a delete animation.
+  void InsertAt(uint32_t const index, xaml::UIElement const &value);
+  void RemoveAt(uint32_t const index);
+  void Clear();
+
+  // Replaces a child at its position. Returns false if oldChild is not a child.
+  bool ReplaceChild(xaml::UIElement const &oldChild, xaml::UIElement const &newChild);
+
+  // Puts the element of a deleted child back while its delete animation runs,
+  // at the position it was removed from: after previousSibling if that is still
+  // a child, otherwise at childIndex of Children(). Kept children are skipped
+  // by the indices of InsertAt and RemoveAt, so the view manager does not see
+  // them.
+  void InsertKeptChild(
+      xaml::UIElement const &element,
+      xaml::UIElement const &previousSibling,
+      uint32_t childIndex);
+  void RemoveKeptChild(xaml::UIElement const &element);
+
+  // Records the position and size computed by Yoga for a child, which is used
+  // to measure and arrange it instead of its attached properties.
+  void CommitChildLayout(xaml::UIElement const &child, facebook::react::LayoutFrame const &frame);
+
+  // Changes when children are added or removed or the text of a child
+  // changes, so that automation peers can cache names built from the children.
+  // Versions are unique across panels.
+  uint64_t ContentVersion() const noexcept {
+    return m_contentVersion;
+  }
+
+  // Called when the text of an element changes, in case it is the child of a
+  // ViewPanel.
+  static void NotifyChildContentChanged(xaml::DependencyObject const &child);
+
+  // Called by code that changes Children() directly instead of through the
+  // methods of the panel.
+  void OnContentChanged() noexcept;
 
   void FinalizeProperties();
   xaml::Controls::Border GetOuterBorder();
@@ -87,7 +123,11 @@ struct ViewPanel : ViewPanelT<ViewPanel> {
   }
 
  private:
-  void Remove(xaml::UIElement element) const;
+  void Remove(xaml::UIElement element);
+
+  bool IsKeptChild(xaml::UIElement const &child) const noexcept;
+  // Converts an index that skips the kept children to an index of Children().
+  uint32_t ToChildrenIndex(uint32_t index);
 
   void UpdateClip(winrt::Windows::Foundation::Size &finalSize);
 
@@ -98,6 +138,15 @@ struct ViewPanel : ViewPanelT<ViewPanel> {
   xaml::Controls::Border m_border{nullptr};
   bool m_hasOuterBorder{false};
 
+  // Children are keyed by their UIElement interface pointer, which is the same
+  // for every reference to a given element.
+  facebook::react::ChildLayoutTable m_childLayouts;
+
+  // The children kept for a delete animation, keyed like m_childLayouts.
+  std::vector<void *> m_keptChildren;
+
+  uint64_t m_contentVersion{0};
+
  private:
   static void VisualPropertyChanged(xaml::DependencyObject sender, xaml::DependencyPropertyChangedEventArgs e);
   static void PositionPropertyChanged(xaml::DependencyObject sender, xaml::DependencyPropertyChangedEventArgs e);
@@ -140,11 +140,10 @@ class ViewShadowNode : public ShadowNodeBase {
   void ReplaceChild(const XamlView &oldChildView, const XamlView &newChildView) override {
     auto pPanel = GetViewPanel();
     if (pPanel != nullptr) {
-      uint32_t index;
-      if (pPanel.Children().IndexOf(oldChildView.as<xaml::UIElement>(), index)) {
-        pPanel.RemoveAt(index);
-        pPanel.InsertAt(index, newChildView.as<xaml::UIElement>());
-      } else {
+      // The panel may also hold children kept for a delete animation, so the
+      // index of the old child in Children() is not an index for InsertAt.
+      if (!winrt::get_self<winrt::react::uwp::implementation::ViewPanel>(pPanel)->ReplaceChild(
+              oldChildView.as<xaml::UIElement>(), newChildView.as<xaml::UIElement>())) {
         assert(false);
       }
     }
@@ -7,6 +7,14 @@
 #include "testCheck.h"
 #include "testExecutor.h"
 
+#ifdef PERF_TESTS
+#include <chrono>
+#include <cstdio>
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#endif
+#endif
+
 namespace FutureTests {
 
 struct DestroyCheck : Mso::RefCountedObjectNoVTable<DestroyCheck> {
@@ -167,10 +175,24 @@ TEST_CLASS_EX (CancellationTokenTest, LibletAwareMemLeakDetection) {
     ts1.Abandon();
     Mso::CancellationToken t1 = ts1.GetToken();
     TestCheck(!t1.IsCanceled());
-    TestCheck(Mso::GetIFuture(ts1)->IsFailed());
+    TestCheck(Mso::GetIFuture(ts1)->IsSucceeded());
     TestCheck(Mso::GetIFuture(t1)->IsSucceeded());
   }
 
+  TEST_METHOD(CancellationTokenSource_Cancel_AfterAbandon) {
+    Mso::CancellationTokenSource ts1;
+    ts1.Abandon();
+    ts1.Cancel();
+    TestCheck(!ts1.GetToken().IsCanceled());
+  }
+
+  TEST_METHOD(CancellationTokenSource_SharesStateWithToken) {
+    // The source and its tokens point to the same state instance.
+    Mso::CancellationTokenSource ts1;
+    Mso::CancellationToken t1 = ts1.GetToken();
+    TestCheck(Mso::GetIFuture(ts1) == Mso::GetIFuture(t1));
+  }
+
   TESTMETHOD_REQUIRES_SEH(CancellationTokenSource_Abandon_Empty) {
     Mso::CancellationTokenSource ts1;
     ts1.Clear();
@@ -189,6 +211,105 @@ TEST_CLASS_EX (CancellationTokenTest, LibletAwareMemLeakDetection) {
     TestCheck(Mso::GetIFuture(t1)->IsSucceeded());
   }
 
+  TEST_METHOD(CancellationTokenSource_dtor_LastCopy) {
+    // The state is abandoned only when the last CancellationTokenSource copy is destroyed.
+    Mso::CancellationToken t1(GetEmptyCancellationToken());
+    {
+      Mso::CancellationTokenSource ts1;
+      t1 = ts1.GetToken();
+      {
+        Mso::CancellationTokenSource ts2(ts1);
+        Mso::CancellationTokenSource ts3;
+        ts3 = ts2;
+      }
+      TestCheck(!Mso::GetIFuture(t1)->IsDone());
+
+      Mso::CancellationTokenSource ts4(std::move(ts1));
+      TestCheck(!Mso::GetIFuture(t1)->IsDone());
+    }
+    TestCheck(!t1.IsCanceled());
+    TestCheck(Mso::GetIFuture(t1)->IsSucceeded());
+  }
+
+  TEST_METHOD(CancellationTokenSource_Clear_LastCopy) {
+    Mso::CancellationTokenSource ts1;
+    Mso::CancellationTokenSource ts2(ts1);
+    Mso::CancellationToken t1 = ts1.GetToken();
+    ts1.Clear();
+    TestCheck(!Mso::GetIFuture(t1)->IsDone());
+    ts2.Clear();
+    TestCheck(Mso::GetIFuture(t1)->IsSucceeded());
+    TestCheck(!t1.IsCanceled());
+  }
+
+  TEST_METHOD(CancellationTokenSource_Assign_ReleasesPrevious) {
+    Mso::CancellationTokenSource ts1;
+    Mso::CancellationToken t1 = ts1.GetToken();
+    Mso::CancellationTokenSource ts2;
+    ts1 = ts2;
+    TestCheck(Mso::GetIFuture(t1)->IsSucceeded());
+
+    // Self assignment keeps the state.
+    Mso::CancellationToken t2 = ts2.GetToken();
+    ts2 = ts1;
+    TestCheck(!Mso::GetIFuture(t2)->IsDone());
+    ts1.Cancel();
+    TestCheck(t2.IsCanceled());
+  }
+
+  TEST_METHOD(CancellationErrorCode_IsShared) {
+    const Mso::ErrorCode &error = Mso::CancellationErrorCode();
+    TestCheck(error);
+    TestCheck(error.IsHandled());
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(error));
+    TestCheck(&error == &Mso::CancellationErrorCode());
+  }
+
+  TEST_METHOD(Promise_TryCancel_UsesSharedErrorCode) {
+    Mso::Promise<int> p1;
+    Mso::Future<int> f1 = p1.AsFuture();
+    TestCheck(p1.TryCancel());
+    TestCheck(Mso::GetIFuture(f1)->GetError() == Mso::CancellationErrorCode());
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(CancellationTokenSource_CreateAndCancel_Perf) {
+    constexpr size_t tokenCount = 1000000;
+    using clock = std::chrono::steady_clock;
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    static std::atomic<size_t> s_allocationCount{0};
+    _CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(
+        [](int allocType, void *, size_t, int, long, const unsigned char *, int) noexcept -> int {
+          if (allocType == _HOOK_ALLOC) {
+            s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+          }
+          return TRUE;
+        });
+#endif
+
+    auto start = clock::now();
+    for (size_t i = 0; i < tokenCount; ++i) {
+      Mso::CancellationTokenSource tokenSource;
+      Mso::CancellationToken token = tokenSource.GetToken();
+      tokenSource.Cancel();
+      TestCheck(token.IsCanceled());
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    _CrtSetAllocHook(previousHook);
+    std::printf(
+        "Created and canceled %zu tokens in %.1f ms with %zu allocations\n",
+        tokenCount,
+        elapsed,
+        s_allocationCount.load());
+#else
+    std::printf("Created and canceled %zu tokens in %.1f ms\n", tokenCount, elapsed);
+#endif
+  }
+#endif // PERF_TESTS
+
   TEST_METHOD(CancellationToken_ctor_default) {
     Mso::CancellationToken t1;
     TestCheck(!t1);
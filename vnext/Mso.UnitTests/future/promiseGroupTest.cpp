@@ -6,6 +6,13 @@
 #include "motifCpp/libletAwareMemLeakDetection.h"
 #include "testCheck.h"
 #include "testExecutor.h"
+#include <atomic>
+#include <vector>
+
+#ifdef PERF_TESTS
+#include <chrono>
+#include <cstdio>
+#endif
 
 namespace FutureTests {
 
@@ -561,6 +568,95 @@ TEST_CLASS_EX (PromiseGroupTest, LibletAwareMemLeakDetection) {
     TestCheck(nullptr != p1);
   }
 
+  TEST_METHOD(PromiseGroup_AddCallback_InOrder) {
+    Mso::PromiseGroup<int> p1;
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+      p1.AddCallback([&order, i](const Mso::Maybe<int> &result) noexcept {
+        TestCheckEqual(5, result.GetValue());
+        order.push_back(i);
+      });
+    }
+
+    TestCheck(order.empty());
+    p1.SetValue(5);
+    TestCheck((order == std::vector<int>{0, 1, 2, 3, 4}));
+  }
+
+  TEST_METHOD(PromiseGroup_AddCallback_QueueBatches) {
+    Mso::PromiseGroup<int> p1;
+    Mso::DispatchQueue queues[2] = {Mso::DispatchQueue::MakeSerialQueue(), Mso::DispatchQueue::MakeSerialQueue()};
+    std::vector<int> order[2];
+    std::atomic<int> wrongQueueCount{0};
+    for (int i = 0; i < 10; ++i) {
+      int index = i % 2;
+      p1.AddCallback(queues[index], [&, index, i](const Mso::Maybe<int> &result) noexcept {
+        TestCheckEqual(5, result.GetValue());
+        if (!queues[index].IsCurrentQueue()) {
+          ++wrongQueueCount;
+        }
+
+        order[index].push_back(i);
+      });
+    }
+
+    p1.SetValue(5);
+    for (auto &queue : queues) {
+      Mso::FutureWait(Mso::PostFuture(queue, []() noexcept {}));
+    }
+
+    TestCheckEqual(0, wrongQueueCount.load());
+    TestCheck((order[0] == std::vector<int>{0, 2, 4, 6, 8}));
+    TestCheck((order[1] == std::vector<int>{1, 3, 5, 7, 9}));
+  }
+
+  TEST_METHOD(PromiseGroup_AddCallback_AfterCompletion) {
+    Mso::PromiseGroup<int> p1;
+    p1.SetValue(5);
+
+    int value = 0;
+    p1.AddCallback([&value](const Mso::Maybe<int> &result) noexcept { value = result.GetValue(); });
+    TestCheckEqual(5, value);
+  }
+
+  TEST_METHOD(PromiseGroup_AddCallback_WithAddFuture) {
+    Mso::PromiseGroup<int> p1;
+    int callbackValue = 0;
+    p1.AddCallback([&callbackValue](const Mso::Maybe<int> &result) noexcept { callbackValue = result.GetValue(); });
+    Mso::Future<int> f1 = p1.AddFuture();
+
+    p1.SetValue(5);
+    TestCheckEqual(5, callbackValue);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(f1));
+  }
+
+  TEST_METHOD(PromiseGroup_AddCallback_TrySetError) {
+    Mso::PromiseGroup<int> p1;
+    std::vector<int> order;
+    for (int i = 0; i < 3; ++i) {
+      p1.AddCallback([&order, i](const Mso::Maybe<int> &result) noexcept {
+        TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(result.GetError()));
+        order.push_back(i);
+      });
+    }
+
+    TestCheck(p1.TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true)));
+    TestCheck((order == std::vector<int>{0, 1, 2}));
+  }
+
+  TEST_METHOD(PromiseGroup_AddCallback_dtor_Unfulfilled) {
+    Mso::PromiseGroup<int> p1;
+    bool isCanceled = false;
+    p1.AddCallback([&isCanceled](const Mso::Maybe<int> &result) noexcept {
+      isCanceled = Mso::CancellationErrorProvider().IsOwnedErrorCode(result.GetError());
+    });
+
+    // Move p1 to the local variable p2 which should destroy the promise group when goes out of scope.
+    { Mso::PromiseGroup<int> p2(std::move(p1)); }
+
+    TestCheck(isCanceled);
+  }
+
   TEST_METHOD(PromiseGroupVoid_ctor_Default) {
     Mso::PromiseGroup<void> p1;
     TestCheck(p1);
@@ -821,6 +917,93 @@ TEST_CLASS_EX (PromiseGroupTest, LibletAwareMemLeakDetection) {
     TestCheck(p1 != nullptr);
     TestCheck(nullptr != p1);
   }
+
+  TEST_METHOD(PromiseGroupVoid_AddCallback_InOrder) {
+    Mso::PromiseGroup<void> p1;
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+      p1.AddCallback([&order, i](const Mso::Maybe<void> &result) noexcept {
+        TestCheck(result.IsValue());
+        order.push_back(i);
+      });
+    }
+
+    TestCheck(order.empty());
+    p1.SetValue();
+    TestCheck((order == std::vector<int>{0, 1, 2, 3, 4}));
+  }
+
+  TEST_METHOD(PromiseGroupVoid_AddCallback_Queue) {
+    Mso::PromiseGroup<void> p1;
+    Mso::DispatchQueue queue = Mso::DispatchQueue::MakeSerialQueue();
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+      p1.AddCallback(queue, [&order, i](const Mso::Maybe<void> &result) noexcept {
+        TestCheck(result.IsValue());
+        order.push_back(i);
+      });
+    }
+
+    p1.SetValue();
+    Mso::FutureWait(Mso::PostFuture(queue, []() noexcept {}));
+    TestCheck((order == std::vector<int>{0, 1, 2, 3, 4}));
+  }
+
+  TEST_METHOD(PromiseGroupVoid_AddCallback_TrySetError) {
+    Mso::PromiseGroup<void> p1;
+    std::vector<int> order;
+    for (int i = 0; i < 3; ++i) {
+      p1.AddCallback([&order, i](const Mso::Maybe<void> &result) noexcept {
+        TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(result.GetError()));
+        order.push_back(i);
+      });
+    }
+
+    TestCheck(p1.TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true)));
+    TestCheck((order == std::vector<int>{0, 1, 2}));
+  }
+
+#ifdef PERF_TESTS
+  TEST_METHOD(PromiseGroup_AddCallback_Perf) {
+    using clock = std::chrono::steady_clock;
+    for (int observerCount : {10, 1000, 100000}) {
+      auto futuresStart = clock::now();
+      {
+        Mso::PromiseGroup<int> p1;
+        int sum = 0;
+        std::vector<Mso::Future<void>> futures;
+        futures.reserve(observerCount);
+        for (int i = 0; i < observerCount; ++i) {
+          futures.push_back(
+              p1.AddFuture().Then(Mso::Executors::Inline{}, [&sum](int value) noexcept { sum += value; }));
+        }
+
+        p1.SetValue(1);
+        TestCheckEqual(observerCount, sum);
+      }
+      auto futuresTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - futuresStart).count();
+
+      auto callbacksStart = clock::now();
+      {
+        Mso::PromiseGroup<int> p1;
+        int sum = 0;
+        for (int i = 0; i < observerCount; ++i) {
+          p1.AddCallback([&sum](const Mso::Maybe<int> &result) noexcept { sum += result.GetValue(); });
+        }
+
+        p1.SetValue(1);
+        TestCheckEqual(observerCount, sum);
+      }
+      auto callbacksTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - callbacksStart).count();
+
+      std::printf(
+          "PromiseGroup with %d observers: AddFuture %lld us, AddCallback %lld us\n",
+          observerCount,
+          static_cast<long long>(futuresTime),
+          static_cast<long long>(callbacksTime));
+    }
+  }
+#endif // PERF_TESTS
 };
 
 } // namespace FutureTests
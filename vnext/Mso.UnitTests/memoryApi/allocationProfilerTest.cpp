@@ -0,0 +1,244 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "memoryApi/allocationProfiler.h"
+#include "memoryApi/memoryApi.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+namespace MemoryApiTests {
+
+// Returns the sum of the live samples with the given tag.
+static Mso::Memory::AllocationSample GetTaggedSamples(const char *tag) noexcept {
+  Mso::Memory::AllocationSample result{nullptr, tag, 0, 0, 0.0, 0.0};
+  for (const auto &sample : Mso::Memory::GetLiveAllocationSamples()) {
+    if (sample.Tag == tag) {
+      result.SampledCount += sample.SampledCount;
+      result.SampledBytes += sample.SampledBytes;
+      result.EstimatedCount += sample.EstimatedCount;
+      result.EstimatedBytes += sample.EstimatedBytes;
+    }
+  }
+
+  return result;
+}
+
+static std::vector<void *> AllocateBlocks(size_t count, size_t size) noexcept {
+  std::vector<void *> blocks;
+  blocks.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    blocks.push_back(Mso::Memory::Allocate(size));
+  }
+
+  return blocks;
+}
+
+static void FreeBlocks(std::vector<void *> &blocks) noexcept {
+  for (void *block : blocks) {
+    Mso::Memory::Free(block);
+  }
+
+  blocks.clear();
+}
+
+// Checks that the estimate is within the relative tolerance from the expected value.
+static bool IsNear(double expected, double estimate, double tolerance) noexcept {
+  return std::abs(estimate - expected) <= expected * tolerance;
+}
+
+TEST_CLASS_EX (AllocationProfilerTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(AllocationProfiler_Stopped_NoSamples) {
+    static const char tag[] = "Stopped";
+    Mso::Memory::StopAllocationProfiler();
+    TestCheck(!Mso::Memory::IsAllocationProfilerStarted());
+
+    Mso::Memory::AllocationTagScope tagScope{tag};
+    auto blocks = AllocateBlocks(100, 1024);
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    FreeBlocks(blocks);
+  }
+
+  TEST_METHOD(AllocationProfiler_IntervalOne_SamplesEveryAllocation) {
+    static const char tag[] = "Every";
+    Mso::Memory::StartAllocationProfiler(1);
+    TestCheck(Mso::Memory::IsAllocationProfilerStarted());
+
+    std::vector<void *> blocks;
+    {
+      Mso::Memory::AllocationTagScope tagScope{tag};
+      blocks = AllocateBlocks(10, 100);
+    }
+
+    auto samples = GetTaggedSamples(tag);
+    TestCheckEqual(10u, samples.SampledCount);
+    TestCheckEqual(1000u, samples.SampledBytes);
+    TestCheckEqual(1000.0, samples.EstimatedBytes);
+
+    FreeBlocks(blocks);
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_Reallocate_MovesSample) {
+    static const char tag[] = "Reallocate";
+    Mso::Memory::StartAllocationProfiler(1);
+
+    Mso::Memory::AllocationTagScope tagScope{tag};
+    void *block = Mso::Memory::Allocate(100);
+    block = Mso::Memory::Reallocate(&block, 4000);
+    TestCheck(block != nullptr);
+
+    auto samples = GetTaggedSamples(tag);
+    TestCheckEqual(1u, samples.SampledCount);
+    TestCheckEqual(4000u, samples.SampledBytes);
+
+    Mso::Memory::Free(block);
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_FailedReallocate_KeepsSample) {
+    static const char tag[] = "FailedReallocate";
+    Mso::Memory::StartAllocationProfiler(1);
+
+    Mso::Memory::AllocationTagScope tagScope{tag};
+    void *block = Mso::Memory::Allocate(100);
+    void *original = block;
+    TestCheck(Mso::Memory::Reallocate(&block, SIZE_MAX / 2) == nullptr);
+    TestCheck(block == original);
+
+    auto samples = GetTaggedSamples(tag);
+    TestCheckEqual(1u, samples.SampledCount);
+    TestCheckEqual(100u, samples.SampledBytes);
+
+    Mso::Memory::Free(block);
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_EstimatesSmallAllocations) {
+    // About 6% of the 256-byte blocks are sampled, which gives a few percent standard deviation.
+    static const char tag[] = "Small";
+    constexpr size_t blockCount = 40000;
+    constexpr size_t blockSize = 256;
+    Mso::Memory::StartAllocationProfiler(4096);
+
+    std::vector<void *> blocks;
+    {
+      Mso::Memory::AllocationTagScope tagScope{tag};
+      blocks = AllocateBlocks(blockCount, blockSize);
+    }
+
+    auto samples = GetTaggedSamples(tag);
+    TestCheck(samples.SampledCount < blockCount / 4);
+    TestCheck(IsNear(blockCount, samples.EstimatedCount, 0.15));
+    TestCheck(IsNear(blockCount * blockSize, samples.EstimatedBytes, 0.15));
+
+    // Free every other block: the estimate follows the live bytes.
+    for (size_t i = 0; i < blocks.size(); i += 2) {
+      Mso::Memory::Free(blocks[i]);
+      blocks[i] = nullptr;
+    }
+
+    samples = GetTaggedSamples(tag);
+    TestCheck(IsNear(blockCount * blockSize / 2, samples.EstimatedBytes, 0.15));
+
+    FreeBlocks(blocks);
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_EstimatesMixedAllocations) {
+    // Large blocks are almost always sampled, small ones rarely. The estimates must still match both patterns.
+    static const char smallTag[] = "MixedSmall";
+    static const char largeTag[] = "MixedLarge";
+    Mso::Memory::StartAllocationProfiler(16 * 1024);
+
+    std::vector<void *> smallBlocks;
+    std::vector<void *> largeBlocks;
+    for (size_t i = 0; i < 100; ++i) {
+      {
+        Mso::Memory::AllocationTagScope tagScope{largeTag};
+        largeBlocks.push_back(Mso::Memory::Allocate(256 * 1024));
+      }
+      {
+        Mso::Memory::AllocationTagScope tagScope{smallTag};
+        for (size_t j = 0; j < 1000; ++j) {
+          smallBlocks.push_back(Mso::Memory::Allocate(64 + j % 128));
+        }
+      }
+    }
+
+    double smallBytes = 100.0 * (1000 / 128 * (64 * 128 + 127 * 128 / 2) + (64 * 104 + 103 * 104 / 2));
+    TestCheck(IsNear(smallBytes, GetTaggedSamples(smallTag).EstimatedBytes, 0.15));
+    TestCheck(IsNear(100.0 * 256 * 1024, GetTaggedSamples(largeTag).EstimatedBytes, 0.02));
+
+    FreeBlocks(smallBlocks);
+    FreeBlocks(largeBlocks);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_ManyThreads) {
+    static const char tag[] = "Threads";
+    constexpr size_t threadCount = 4;
+    constexpr size_t blockCount = 20000;
+    constexpr size_t blockSize = 512;
+    Mso::Memory::StartAllocationProfiler(8192);
+
+    std::vector<std::vector<void *>> blocks(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&threadBlocks = blocks[i]]() noexcept {
+        Mso::Memory::AllocationTagScope tagScope{tag};
+        threadBlocks = AllocateBlocks(blockCount, blockSize);
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    TestCheck(IsNear(threadCount * blockCount * blockSize, GetTaggedSamples(tag).EstimatedBytes, 0.15));
+
+    // Blocks are freed on other threads than the ones that allocated them.
+    threads.clear();
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&threadBlocks = blocks[(i + 1) % threadCount]]() noexcept { FreeBlocks(threadBlocks); });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    TestCheckEqual(0u, GetTaggedSamples(tag).SampledCount);
+    Mso::Memory::StopAllocationProfiler();
+  }
+
+  TEST_METHOD(AllocationProfiler_GetAllocationProfile_PprofFormat) {
+    static const char tag[] = "Pprof";
+    Mso::Memory::StartAllocationProfiler(1);
+
+    std::vector<void *> blocks;
+    {
+      Mso::Memory::AllocationTagScope tagScope{tag};
+      blocks = AllocateBlocks(3, 100);
+    }
+
+    std::string profile = Mso::Memory::GetAllocationProfile();
+    TestCheck(profile.rfind("heap profile: ", 0) == 0);
+    TestCheck(profile.find("] @ heap_v2/1\n") != std::string::npos);
+    size_t tagPosition = profile.find("# tag: Pprof\n");
+    TestCheck(tagPosition != std::string::npos);
+    TestCheck(profile.find("3: 300 [3: 300] @ 0x", tagPosition) != std::string::npos);
+
+    FreeBlocks(blocks);
+    Mso::Memory::StopAllocationProfiler();
+  }
+};
+
+} // namespace MemoryApiTests
@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../../Microsoft.ReactNative/ReactHost/AsyncActionQueue.h"
+#include <map>
+#include <string>
+#include <vector>
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+using namespace Mso::React;
+
+namespace AsyncActionQueueTests {
+
+// A scheduler that runs tasks only when the test asks it to.
+// It makes the test thread the queue thread while the tasks are run.
+struct ManualScheduler : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, Mso::IDispatchQueueScheduler> {
+  void RunPendingTasks() noexcept {
+    if (auto queue = m_queue.GetStrongPtr()) {
+      Mso::DispatchTask task;
+      while (queue->TryDequeTask(task)) {
+        queue->InvokeTask(std::move(task), std::nullopt);
+      }
+    }
+  }
+
+ public: // IDispatchQueueScheduler
+  void IntializeScheduler(Mso::WeakPtr<Mso::IDispatchQueueService> &&queue) noexcept override {
+    m_queue = std::move(queue);
+  }
+
+  bool HasThreadAccess() noexcept override {
+    return true;
+  }
+
+  bool IsSerial() noexcept override {
+    return true;
+  }
+
+  void Post() noexcept override {}
+
+  void Shutdown() noexcept override {}
+
+  void AwaitTermination() noexcept override {}
+
+ private:
+  Mso::WeakPtr<Mso::IDispatchQueueService> m_queue;
+};
+
+// Creates actions that log their invocation and complete when the test completes them.
+struct AsyncActionQueueFixture {
+  AsyncActionQueueFixture() noexcept
+      : m_scheduler{Mso::Make<ManualScheduler>()},
+        m_queue{Mso::DispatchQueue::MakeCustomQueue(Mso::CntPtr<Mso::IDispatchQueueScheduler>{m_scheduler})},
+        m_actionQueue{Mso::Make<AsyncActionQueue>(m_queue)} {}
+
+  ~AsyncActionQueueFixture() noexcept {
+    // Cancel the incomplete actions. It may start the next pending actions that create new Promises.
+    while (!m_promises.empty()) {
+      auto promises = std::move(m_promises);
+      m_promises.clear();
+      promises.clear();
+      m_scheduler->RunPendingTasks();
+    }
+  }
+
+  AsyncAction MakeAction(std::string const &name) noexcept {
+    return [this, name]() noexcept {
+      Invoked.push_back(name);
+      return m_promises[name].AsFuture();
+    };
+  }
+
+  void Post(std::string const &name, AsyncActionKey key = nullptr) noexcept {
+    RunInQueue([&]() noexcept { Observe(name, m_actionQueue->PostAction(MakeAction(name), key)); });
+  }
+
+  void Post(std::string const &name1, std::string const &name2, AsyncActionKey key = nullptr) noexcept {
+    RunInQueue([&]() noexcept {
+      auto result = m_actionQueue->PostActions({MakeAction(name1), MakeAction(name2)}, key);
+      Observe(name1 + "+" + name2, std::move(result));
+    });
+  }
+
+  void Complete(std::string const &name) noexcept {
+    RunInQueue([&]() noexcept { m_promises[name].SetValue(); });
+  }
+
+  // The result of the Future returned for the posted action: "pending", "succeeded", "failed", or "canceled".
+  std::string Result(std::string const &name) noexcept {
+    auto it = m_results.find(name);
+    return it != m_results.end() ? it->second : "pending";
+  }
+
+  std::vector<std::string> Invoked;
+
+ private:
+  template <class TCallback>
+  void RunInQueue(TCallback &&callback) noexcept {
+    m_queue.Post(std::forward<TCallback>(callback));
+    m_scheduler->RunPendingTasks();
+  }
+
+  void Observe(std::string const &name, Mso::Future<void> &&future) noexcept {
+    future.Then(Mso::Executors::Inline{}, [this, name](Mso::Maybe<void> &&result) noexcept {
+      if (result.IsValue()) {
+        m_results[name] = "succeeded";
+      } else if (Mso::CancellationErrorProvider().IsOwnedErrorCode(result.GetError())) {
+        m_results[name] = "canceled";
+      } else {
+        m_results[name] = "failed";
+      }
+    });
+  }
+
+ private:
+  Mso::CntPtr<ManualScheduler> m_scheduler;
+  Mso::DispatchQueue m_queue;
+  Mso::CntPtr<AsyncActionQueue> m_actionQueue;
+  std::map<std::string, Mso::Promise<void>> m_promises;
+  std::map<std::string, std::string> m_results;
+};
+
+using Names = std::vector<std::string>;
+
+// Only the addresses are used as keys.
+int s_key1{0};
+int s_key2{0};
+
+TEST_CLASS_EX (AsyncActionQueueTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(AsyncActionQueue_RunsActionsInOrder) {
+    AsyncActionQueueFixture fixture;
+    fixture.Post("a");
+    fixture.Post("b");
+    fixture.Post("c");
+    TestCheck(fixture.Invoked == (Names{"a"}));
+
+    fixture.Complete("a");
+    TestCheck(fixture.Invoked == (Names{"a", "b"}));
+    TestCheckEqual("succeeded", fixture.Result("a"));
+    TestCheckEqual("pending", fixture.Result("b"));
+
+    fixture.Complete("b");
+    fixture.Complete("c");
+    TestCheck(fixture.Invoked == (Names{"a", "b", "c"}));
+    TestCheckEqual("succeeded", fixture.Result("c"));
+  }
+
+  TEST_METHOD(AsyncActionQueue_NullKeyIsNotSuperseded) {
+    AsyncActionQueueFixture fixture;
+    fixture.Post("a", nullptr);
+    fixture.Post("b", nullptr);
+    fixture.Post("c", nullptr);
+
+    fixture.Complete("a");
+    fixture.Complete("b");
+    fixture.Complete("c");
+    TestCheck(fixture.Invoked == (Names{"a", "b", "c"}));
+    TestCheckEqual("succeeded", fixture.Result("b"));
+  }
+
+  TEST_METHOD(AsyncActionQueue_SupersedesPendingActionsWithSameKey) {
+    AsyncActionQueueFixture fixture;
+    fixture.Post("a", &s_key1);
+    fixture.Post("b", &s_key1);
+    fixture.Post("c", &s_key1);
+    fixture.Post("d", &s_key1);
+
+    // The superseded actions are canceled right away, but the running one is not affected.
+    TestCheckEqual("pending", fixture.Result("a"));
+    TestCheckEqual("canceled", fixture.Result("b"));
+    TestCheckEqual("canceled", fixture.Result("c"));
+
+    fixture.Complete("a");
+    fixture.Complete("d");
+    TestCheck(fixture.Invoked == (Names{"a", "d"}));
+    TestCheckEqual("succeeded", fixture.Result("a"));
+    TestCheckEqual("succeeded", fixture.Result("d"));
+  }
+
+  TEST_METHOD(AsyncActionQueue_KeepsOrderOfOtherActions) {
+    AsyncActionQueueFixture fixture;
+    fixture.Post("a");
+    fixture.Post("b", &s_key1);
+    fixture.Post("c", &s_key2);
+    fixture.Post("d");
+    fixture.Post("e", &s_key1);
+
+    TestCheckEqual("canceled", fixture.Result("b"));
+    TestCheckEqual("pending", fixture.Result("c"));
+
+    for (auto name : {"a", "c", "d", "e"}) {
+      fixture.Complete(name);
+    }
+
+    TestCheck(fixture.Invoked == (Names{"a", "c", "d", "e"}));
+    TestCheckEqual("succeeded", fixture.Result("c"));
+    TestCheckEqual("succeeded", fixture.Result("d"));
+  }
+
+  TEST_METHOD(AsyncActionQueue_ActionListIsSupersededAsWhole) {
+    AsyncActionQueueFixture fixture;
+    fixture.Post("running");
+    fixture.Post("unload1", "load1", &s_key1);
+    fixture.Post("unload2", "load2", &s_key1);
+
+    // Items of the same list do not supersede each other.
+    TestCheckEqual("canceled", fixture.Result("unload1+load1"));
+    TestCheckEqual("pending", fixture.Result("unload2+load2"));
+
+    for (auto name : {"running", "unload2", "load2"}) {
+      fixture.Complete(name);
+    }
+
+    TestCheck(fixture.Invoked == (Names{"running", "unload2", "load2"}));
+    TestCheckEqual("succeeded", fixture.Result("unload2+load2"));
+  }
+};
+
+} // namespace AsyncActionQueueTests
@@ -11,8 +11,8 @@ CancellationTokenSource and CancellationToken provide support for cancellation p
 
 CancellationTokenSource is an owner of the cancellation token state.
 It has methods Cancel() and Abandon() which set the cancellation state to true and false.
-When all instances of CancellationTokenSource pointing to the same state are destroyed, then its ref count goes to zero
-and the state's destructor calls Abandon().
+When all instances of CancellationTokenSource pointing to the same state are destroyed, then their ref count goes to
+zero and Abandon() is called.
 The GetToken() method returns the CancellationToken associated with the CancellationTokenSource instance.
 
 CancellationToken is a class to observe the cancellation token state.
@@ -57,12 +57,14 @@ Note that only ref count affected by CancellationTokenSource instances defines w
 method is called. The CancellationToken instances can be considered as weak pointers and do not affect when the
 Abandon() method is called.
 
-Internally the cancellation token state has two IFuture instances.
-One is an IFuture instance pointed by CancellationTokenSource instances.
-Another is an observer IFuture instance pointed by CancellationToken instances.
-The first IFuture instance owns the second one as a continuation. Since only the first IFuture instance guarantees the
-lifetime of the pair, the CancellationTokenSource can be considered as a "strong" pointer, and CancellationToken as a
-"weak" pointer.
+Internally the cancellation token state is a single shared IFuture<bool> instance pointed by both
+CancellationTokenSource and CancellationToken instances. Its continuations are the subscribed observers. The IFuture
+task buffer has a separate ref count of CancellationTokenSource instances. When it goes to zero the state is abandoned.
+It is why CancellationTokenSource can be considered as a "strong" pointer, and CancellationToken as a "weak" pointer:
+CancellationToken keeps the state memory alive, but it does not delay the Abandon() call.
+
+Cancel() and Abandon() do not allocate error codes. To fail futures with a cancellation error without allocating new
+error state, use the shared error code returned by Mso::CancellationErrorCode().
 
 */
 
@@ -90,6 +92,9 @@ class CancellationTokenSource {
   //! CancellationTokenSource state becomes empty.
   LIBLET_PUBLICAPI CancellationTokenSource(CancellationTokenSource &&other) noexcept;
 
+  //! Abandons the state if it was the last CancellationTokenSource pointing to it.
+  LIBLET_PUBLICAPI ~CancellationTokenSource() noexcept;
+
   //! Assigns the state from the other CancellationTokenSource.
   LIBLET_PUBLICAPI CancellationTokenSource &operator=(const CancellationTokenSource &other) noexcept;
 
@@ -107,7 +112,7 @@ class CancellationTokenSource {
   LIBLET_PUBLICAPI explicit operator bool() const noexcept;
 
   //! Gets the CancellationToken associated with the CancellationTokenSource instance.
-  LIBLET_PUBLICAPI const CancellationToken &GetToken() const noexcept;
+  LIBLET_PUBLICAPI CancellationToken GetToken() const noexcept;
 
   //! Sets the cancellation state to true.
   LIBLET_PUBLICAPI void Cancel() const noexcept;
@@ -120,7 +125,7 @@ class CancellationTokenSource {
   friend Mso::Futures::IFuture *GetIFuture(const U &tokenSource) noexcept;
 
  private:
-  //! Points to the first instance in the pair of IFuture instances used for the cancellation state.
+  //! Points to the shared IFuture instance used for the cancellation state.
   Mso::CntPtr<Mso::Futures::IFuture> m_state;
 };
 
@@ -194,7 +199,7 @@ class CancellationToken {
   friend Mso::Futures::IFuture *GetIFuture(const U &token) noexcept;
 
  private:
-  //! Points to the second instance in the pair of IFuture instances used for the cancellation state.
+  //! Points to the shared IFuture instance used for the cancellation state.
   Mso::CntPtr<Mso::Futures::IFuture> m_state;
 };
 
@@ -13,6 +13,11 @@ MSO_GUID(CancellationErrorProviderGuid, "e7d1526a-efcf-4e62-a906-84fdcd4b6371")
 
 LIBLET_PUBLICAPI const ErrorProvider<bool, CancellationErrorProviderGuid> &CancellationErrorProvider() noexcept;
 
+//! A shared cancellation error code created once by CancellationErrorProvider().
+//! It is already marked as handled. Use it instead of CancellationErrorProvider().MakeErrorCode(true) to avoid
+//! allocating a new error state for each cancellation.
+LIBLET_PUBLICAPI const ErrorCode &CancellationErrorCode() noexcept;
+
 template <>
 LIBLET_PUBLICAPI void ErrorProvider<bool, CancellationErrorProviderGuid>::Throw(
     const ErrorCode &errorCode,
@@ -0,0 +1,202 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_FUTURE_DETAILS_PROMISEGROUPFANOUT_H
+#define MSO_FUTURE_DETAILS_PROMISEGROUPFANOUT_H
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "errorCode/maybe.h"
+#include "functional/functor.h"
+#include "futureTask.h"
+#include "ifuture.h"
+#include "object/refCountedObject.h"
+
+// PromiseGroup::AddCallback observes a PromiseGroup without creating a Future for each observer.
+// The callbacks are kept in one vector of PromiseGroupFanOut. It is shared by the PromiseGroup state and by the only
+// continuation that the state gets for all callbacks. When the PromiseGroup is completed, the callbacks are called in
+// one pass in the order they were added, and the callbacks for the same queue are posted to it as one task.
+
+namespace Mso::Futures {
+
+template <class T>
+Mso::Maybe<T> GetPromiseGroupResult(IFuture &state) noexcept {
+  if (state.IsSucceeded()) {
+    return Mso::Maybe<T>(*state.GetValue().As<T>());
+  }
+
+  return Mso::Maybe<T>(ErrorCode(state.GetError()));
+}
+
+template <>
+inline Mso::Maybe<void> GetPromiseGroupResult<void>(IFuture &state) noexcept {
+  if (state.IsSucceeded()) {
+    return Mso::Maybe<void>();
+  }
+
+  return Mso::Maybe<void>(ErrorCode(state.GetError()));
+}
+
+template <class T>
+class PromiseGroupFanOut final : public Mso::RefCountedObjectNoVTable<PromiseGroupFanOut<T>> {
+ public:
+  using CallbackType = Mso::Functor<void(const Mso::Maybe<T> &)>;
+
+  struct Entry {
+    Mso::DispatchQueue Queue; // The callback is called inline if the queue is null.
+    CallbackType Callback;
+  };
+
+  // Returns false without taking the callback if the group is already completed.
+  bool TryAdd(const Mso::DispatchQueue &queue, CallbackType &&callback) noexcept {
+    std::lock_guard<std::mutex> lock{m_lock};
+    if (m_isCompleted) {
+      return false;
+    }
+
+    m_entries.push_back(Entry{queue, std::move(callback)});
+    return true;
+  }
+
+  void Complete(const Mso::Maybe<T> &result) noexcept {
+    // Callbacks added while we call the previous ones are called in the next iteration.
+    // m_isCompleted is set only after all callbacks are called or posted to keep the order.
+    for (;;) {
+      std::vector<Entry> entries;
+      {
+        std::lock_guard<std::mutex> lock{m_lock};
+        if (m_entries.empty()) {
+          m_isCompleted = true;
+          return;
+        }
+
+        entries.swap(m_entries);
+      }
+
+      Call(entries, result);
+    }
+  }
+
+  static void Call(std::vector<Entry> &entries, const Mso::Maybe<T> &result) noexcept {
+    struct Batch {
+      Mso::DispatchQueue Queue;
+      std::vector<CallbackType> Callbacks;
+    };
+
+    // There are usually only a few queues, so we search them linearly.
+    std::vector<Batch> batches;
+    for (auto &entry : entries) {
+      if (!entry.Queue) {
+        entry.Callback(result);
+        continue;
+      }
+
+      auto it = std::find_if(
+          batches.begin(), batches.end(), [&entry](const Batch &batch) noexcept { return batch.Queue == entry.Queue; });
+      if (it == batches.end()) {
+        it = batches.insert(batches.end(), Batch{entry.Queue, {}});
+      }
+
+      it->Callbacks.push_back(std::move(entry.Callback));
+    }
+
+    for (auto &batch : batches) {
+      batch.Queue.Post([callbacks = std::move(batch.Callbacks), result]() noexcept {
+        for (const auto &callback : callbacks) {
+          callback(result);
+        }
+      });
+    }
+  }
+
+ private:
+  std::mutex m_lock;
+  bool m_isCompleted{false};
+  std::vector<Entry> m_entries;
+};
+
+// Task of the continuation that calls the PromiseGroupFanOut callbacks when the PromiseGroup is completed.
+template <class T>
+struct PromiseGroupFanOutTask {
+  static void Invoke(const ByteArrayView &taskBuffer, IFuture *future, IFuture *parentFuture) noexcept {
+    taskBuffer.As<PromiseGroupFanOutTask>()->FanOut->Complete(GetPromiseGroupResult<T>(*parentFuture));
+    future->TrySetSuccess(/*crashIfFailed:*/ true);
+  }
+
+  static void Catch(const ByteArrayView &taskBuffer, IFuture *future, ErrorCode &&parentError) noexcept {
+    taskBuffer.As<PromiseGroupFanOutTask>()->FanOut->Complete(Mso::Maybe<T>(ErrorCode(parentError)));
+    future->TrySetError(std::move(parentError));
+  }
+
+  constexpr static FutureCatchCallback *CatchPtr = &Catch;
+
+  Mso::CntPtr<PromiseGroupFanOut<T>> FanOut;
+};
+
+// Task of the PromiseGroup state. It owns the PromiseGroupFanOut created by the first AddCallback call.
+template <class T>
+struct PromiseGroupTask {
+  PromiseGroupTask() noexcept = default;
+  PromiseGroupTask(const PromiseGroupTask &) = delete;
+  PromiseGroupTask &operator=(const PromiseGroupTask &) = delete;
+
+  ~PromiseGroupTask() noexcept {
+    if (PromiseGroupFanOut<T> *fanOut = FanOut.load(std::memory_order_acquire)) {
+      fanOut->Release();
+    }
+  }
+
+  std::atomic<PromiseGroupFanOut<T> *> FanOut{nullptr};
+};
+
+template <class T>
+void AddPromiseGroupCallback(
+    IFuture &state,
+    const Mso::DispatchQueue &queue,
+    Mso::Functor<void(const Mso::Maybe<T> &)> &&callback) noexcept {
+  ByteArrayView stateTask = state.GetTask();
+  PromiseGroupTask<T> *task =
+      static_cast<PromiseGroupTask<T> *>(stateTask.VoidDataChecked(sizeof(PromiseGroupTask<T>)));
+
+  bool isNewFanOut = false;
+  PromiseGroupFanOut<T> *fanOut = task->FanOut.load(std::memory_order_acquire);
+  if (!fanOut) {
+    Mso::CntPtr<PromiseGroupFanOut<T>> newFanOut = Mso::Make<PromiseGroupFanOut<T>>();
+    if (task->FanOut.compare_exchange_strong(fanOut, newFanOut.Get(), std::memory_order_acq_rel)) {
+      fanOut = newFanOut.Detach();
+      isNewFanOut = true;
+    }
+  }
+
+  if (!fanOut->TryAdd(queue, std::move(callback))) {
+    // All callbacks added before are already called or posted.
+    std::vector<typename PromiseGroupFanOut<T>::Entry> entries;
+    entries.push_back({queue, std::move(callback)});
+    PromiseGroupFanOut<T>::Call(entries, GetPromiseGroupResult<T>(state));
+    return;
+  }
+
+  if (isNewFanOut) {
+    using FanOutTaskType = PromiseGroupFanOutTask<T>;
+    constexpr const auto &fanOutTraits = Mso::Futures::FutureTraitsProvider<
+        /*Options:    */ Mso::Futures::FutureOptions::DestroyTaskAfterInvoke,
+        /*ResultType: */ void,
+        /*TaskType:   */ FanOutTaskType,
+        /*PostType:   */ void,
+        /*InvokeType: */ FanOutTaskType,
+        /*CatchType:  */ FanOutTaskType>::Traits;
+
+    ByteArrayView fanOutTaskBuffer;
+    Mso::CntPtr<IFuture> fanOutFuture = MakeFuture(fanOutTraits, sizeof(FanOutTaskType), &fanOutTaskBuffer);
+    ::new (fanOutTaskBuffer.Data()) FanOutTaskType{Mso::CntPtr<PromiseGroupFanOut<T>>{fanOut}};
+    state.AddContinuation(std::move(fanOutFuture));
+  }
+}
+
+} // namespace Mso::Futures
+
+#endif // MSO_FUTURE_DETAILS_PROMISEGROUPFANOUT_H
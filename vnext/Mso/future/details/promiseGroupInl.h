@@ -18,12 +18,14 @@ inline PromiseGroup<T>::PromiseGroup() noexcept {
   constexpr const auto &promiseGroupTraits = Mso::Futures::FutureTraitsProvider<
       /*Options:     */ Mso::Futures::FutureOptions::IsShared | Mso::Futures::FutureOptions::CancelIfUnfulfilled,
       /*ResultType:  */ T,
-      /*TaskType:    */ void,
+      /*TaskType:    */ Mso::Futures::PromiseGroupTask<T>,
       /*PostType:    */ void,
       /*InvokeType:  */ void,
       /*AbandonType: */ void>::Traits;
 
-  m_state = Mso::Futures::MakeFuture(promiseGroupTraits, 0, nullptr);
+  Mso::Futures::ByteArrayView taskBuffer;
+  m_state = Mso::Futures::MakeFuture(promiseGroupTraits, sizeof(Mso::Futures::PromiseGroupTask<T>), &taskBuffer);
+  ::new (taskBuffer.Data()) Mso::Futures::PromiseGroupTask<T>();
 }
 
 template <class T>
@@ -77,6 +79,20 @@ inline Future<T> PromiseGroup<T>::AddFuture() const noexcept {
   return Mso::Future<T>(std::move(promise));
 }
 
+template <class T>
+inline void PromiseGroup<T>::AddCallback(
+    Mso::DispatchQueue const &queue,
+    Mso::Functor<void(const Mso::Maybe<T> &)> &&callback) const noexcept {
+  VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x02854120 /* tag_c7ue6 */);
+  Mso::Futures::AddPromiseGroupCallback<T>(*m_state, queue, std::move(callback));
+}
+
+template <class T>
+inline void PromiseGroup<T>::AddCallback(Mso::Functor<void(const Mso::Maybe<T> &)> &&callback) const noexcept {
+  VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x02854121 /* tag_c7ue7 */);
+  Mso::Futures::AddPromiseGroupCallback<T>(*m_state, nullptr, std::move(callback));
+}
+
 template <class T>
 inline void PromiseGroup<T>::SetValue(const T &value) const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x0150d407 /* tag_bunqh */);
@@ -161,7 +161,7 @@ inline bool Promise<T>::TryEmplaceValue(std::initializer_list<TArg> init, TArgs
 template <class T>
 inline bool Promise<T>::TryCancel() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x016056d0 /* tag_byf1q */);
-  return m_state->TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true), /*crashIfFailed:*/ false);
+  return m_state->TrySetError(Mso::ErrorCode(Mso::CancellationErrorCode()), /*crashIfFailed:*/ false);
 }
 
 template <class T>
@@ -18,6 +18,7 @@ MSO_PRAGMA_MANAGED_PUSH_OFF
 #include "details/executor.h"
 #include "details/futureTask.h"
 #include "details/ifuture.h"
+#include "details/promiseGroupFanOut.h"
 #include "details/resultTraits.h"
 #include "details/timeoutException.h"
 #include "future/cancellationToken.h"
@@ -795,6 +796,14 @@ struct PromiseGroup {
   /// to the PromiseGroup.
   Mso::Future<T> AddFuture() const noexcept;
 
+  /// Adds a callback to observe the group without creating a Future for it. Callbacks are called with the result of
+  /// the PromiseGroup in the order they were added. Callbacks for the same queue are posted to it as one task.
+  void AddCallback(Mso::DispatchQueue const &queue, Mso::Functor<void(const Mso::Maybe<T> &)> &&callback) const
+      noexcept;
+
+  /// Adds a callback that is called inline when the PromiseGroup is completed.
+  void AddCallback(Mso::Functor<void(const Mso::Maybe<T> &)> &&callback) const noexcept;
+
   /// Sets the value and completes the PromiseGroup. It can be called only once. Otherwise it VECs.
   void SetValue(const T &value) const noexcept;
 
@@ -899,6 +908,15 @@ struct PromiseGroup<void> {
   /// PromiseGroup.
   LIBLET_PUBLICAPI Mso::Future<void> AddFuture() const noexcept;
 
+  /// Adds a callback to observe the group without creating a Future for it. Callbacks are called with the result of
+  /// the PromiseGroup in the order they were added. Callbacks for the same queue are posted to it as one task.
+  LIBLET_PUBLICAPI void AddCallback(
+      Mso::DispatchQueue const &queue,
+      Mso::Functor<void(const Mso::Maybe<void> &)> &&callback) const noexcept;
+
+  /// Adds a callback that is called inline when the PromiseGroup is completed.
+  LIBLET_PUBLICAPI void AddCallback(Mso::Functor<void(const Mso::Maybe<void> &)> &&callback) const noexcept;
+
   /// Sets the value and completes the PromiseGroup. It can be called only once. Otherwise it VECs.
   LIBLET_PUBLICAPI void SetValue() const noexcept;
 
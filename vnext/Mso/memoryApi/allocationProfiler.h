@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_MEMORYAPI_ALLOCATIONPROFILER_H
+#define MSO_MEMORYAPI_ALLOCATIONPROFILER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "compilerAdapters/functionDecorations.h"
+
+/**
+  Sampling profiler for allocations made with Mso::Memory::AllocateEx and Mso::Memory::Reallocate.
+
+  The profiler is off by default and costs one relaxed atomic load per allocation and free while it is off.
+  When started, each thread counts its allocated bytes and samples allocations at Poisson-distributed byte intervals
+  with the given mean. Only sampled allocations record their caller address and the current AllocationTagScope tag,
+  and only they are kept in the live allocation table until they are freed.
+
+  Sampled values can be converted to estimates of all live allocations: an allocation of N bytes is sampled with
+  probability 1 - exp(-N / interval), so each sample stands for 1 / (1 - exp(-N / interval)) allocations.
+*/
+
+namespace Mso::Memory {
+
+/**
+  Starts sampling allocations on all threads. Live samples from the previous profiling session are discarded.
+  The sampleIntervalBytes is the average number of allocated bytes between two samples.
+  Use 1 to sample every allocation.
+*/
+LIBLET_PUBLICAPI void StartAllocationProfiler(size_t sampleIntervalBytes = 512 * 1024) noexcept;
+
+/**
+  Stops sampling allocations and discards live samples.
+*/
+LIBLET_PUBLICAPI void StopAllocationProfiler() noexcept;
+
+/**
+  Is the allocation profiler currently started?
+*/
+LIBLET_PUBLICAPI bool IsAllocationProfilerStarted() noexcept;
+
+/**
+  Live samples aggregated by caller address and tag.
+*/
+struct AllocationSample {
+  const void *Caller;
+  const char *Tag;
+  size_t SampledCount;
+  size_t SampledBytes;
+  double EstimatedCount;
+  double EstimatedBytes;
+};
+
+/**
+  Returns the live samples sorted by estimated bytes, largest first.
+*/
+LIBLET_PUBLICAPI std::vector<AllocationSample> GetLiveAllocationSamples() noexcept;
+
+/**
+  Returns the live samples as a heap profile in the legacy pprof text format.
+  Records are raw sampled values, and pprof scales them using the sample interval from the heap_v2 header.
+  Tags are written as comment lines before the records they apply to.
+*/
+LIBLET_PUBLICAPI std::string GetAllocationProfile() noexcept;
+
+/**
+  Tags allocations sampled on the current thread while the scope is alive.
+  The tag must be a string literal or otherwise outlive the profiling session.
+*/
+class AllocationTagScope {
+ public:
+  LIBLET_PUBLICAPI explicit AllocationTagScope(const char *tag) noexcept;
+  LIBLET_PUBLICAPI ~AllocationTagScope() noexcept;
+
+  AllocationTagScope(const AllocationTagScope &) = delete;
+  AllocationTagScope &operator=(const AllocationTagScope &) = delete;
+
+ private:
+  const char *m_previousTag;
+};
+
+} // namespace Mso::Memory
+
+#endif // MSO_MEMORYAPI_ALLOCATIONPROFILER_H
@@ -7,75 +7,84 @@
 #include "future/details/timeoutException.h"
 #include "future/future.h"
 #include "futureImpl.h"
+#include <atomic>
 
 namespace Mso {
 
-struct CancellationTokenSourceTask {
-  CancellationToken CancellationToken;
+// The task buffer of the shared cancellation state future. CancellationToken instances keep the state alive through
+// the future ref count, while SourceRefCount counts only CancellationTokenSource instances: when it drops to zero the
+// state is abandoned.
+struct CancellationTokenState {
+  std::atomic<uint32_t> SourceRefCount{1};
 };
 
-struct CancellationTokenTask {
-  static void Invoke(
-      const Mso::Futures::ByteArrayView & /*taskBuffer*/,
-      Mso::Futures::IFuture *future,
-      Mso::Futures::IFuture * /*parentFuture*/) noexcept {
-    future->SetValue<bool>(true);
-  }
+static CancellationTokenState &GetCancellationTokenState(Mso::Futures::IFuture &state) noexcept {
+  return *state.GetTask().As<CancellationTokenState>();
+}
 
-  static void Catch(
-      const Mso::Futures::ByteArrayView & /*taskBuffer*/,
-      Mso::Futures::IFuture *future,
-      Mso::ErrorCode && /*parentError*/) noexcept {
-    future->SetValue<bool>(false);
+static void AddSourceRef(const Mso::CntPtr<Mso::Futures::IFuture> &state) noexcept {
+  if (state) {
+    GetCancellationTokenState(*state).SourceRefCount.fetch_add(1, std::memory_order_relaxed);
   }
+}
 
-  constexpr static Mso::Futures::FutureCatchCallback *CatchPtr = &Catch;
-};
+static void ReleaseSourceRef(Mso::CntPtr<Mso::Futures::IFuture> &state) noexcept {
+  if (state) {
+    if (GetCancellationTokenState(*state).SourceRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      (void)state->TrySetValue<bool>(false);
+    }
+
+    state.Clear();
+  }
+}
 
 //=============================================================================
 // CancellationTokenSource implementation
 //=============================================================================
 
 LIBLET_PUBLICAPI CancellationTokenSource::CancellationTokenSource() noexcept {
-  constexpr const auto &tokenSourceTraits = Mso::Futures::FutureTraitsProvider<
-      /*Options:    */ Mso::Futures::FutureOptions::CancelIfUnfulfilled,
-      /*ResultType: */ void,
-      /*TaskType:   */ CancellationTokenSourceTask,
-      /*PostType:   */ void,
-      /*InvokeType: */ void,
-      /*CatchType:  */ void>::Traits;
-
-  constexpr const auto &tokenTraits = Mso::Futures::FutureTraitsProvider<
+  constexpr const auto &stateTraits = Mso::Futures::FutureTraitsProvider<
       /*Options:    */ Mso::Futures::FutureOptions::IsShared,
       /*ResultType: */ bool,
-      /*TaskType:   */ void,
+      /*TaskType:   */ CancellationTokenState,
       /*PostType:   */ void,
-      /*InvokeType: */ CancellationTokenTask,
-      /*CatchType:  */ CancellationTokenTask>::Traits;
+      /*InvokeType: */ void,
+      /*CatchType:  */ void>::Traits;
 
   Mso::Futures::ByteArrayView taskBuffer;
-  m_state = Mso::Futures::MakeFuture(tokenSourceTraits, sizeof(CancellationTokenSourceTask), &taskBuffer);
-  Mso::CntPtr<Mso::Futures::IFuture> tokenState = Mso::Futures::MakeFuture(tokenTraits, 0, nullptr);
-  CancellationToken token;
-  token.m_state = tokenState;
-  ::new (taskBuffer.VoidData()) CancellationTokenSourceTask{std::move(token)};
-  m_state->AddContinuation(std::move(tokenState));
+  m_state = Mso::Futures::MakeFuture(stateTraits, sizeof(CancellationTokenState), &taskBuffer);
+  ::new (taskBuffer.VoidData()) CancellationTokenState();
 }
 
 LIBLET_PUBLICAPI CancellationTokenSource::CancellationTokenSource(const CancellationTokenSource &other) noexcept
-    : m_state(other.m_state) {}
+    : m_state(other.m_state) {
+  AddSourceRef(m_state);
+}
 
 LIBLET_PUBLICAPI CancellationTokenSource::CancellationTokenSource(CancellationTokenSource &&other) noexcept
     : m_state(std::move(other.m_state)) {}
 
+LIBLET_PUBLICAPI CancellationTokenSource::~CancellationTokenSource() noexcept {
+  ReleaseSourceRef(m_state);
+}
+
 LIBLET_PUBLICAPI CancellationTokenSource &CancellationTokenSource::operator=(
     const CancellationTokenSource &other) noexcept {
-  m_state = other.m_state;
+  if (m_state.Get() != other.m_state.Get()) {
+    AddSourceRef(other.m_state);
+    ReleaseSourceRef(m_state);
+    m_state = other.m_state;
+  }
+
   return *this;
 }
 
 LIBLET_PUBLICAPI CancellationTokenSource &CancellationTokenSource::operator=(CancellationTokenSource &&other) noexcept {
-  m_state = std::move(other.m_state);
+  if (this != &other) {
+    ReleaseSourceRef(m_state);
+    m_state = std::move(other.m_state);
+  }
+
   return *this;
 }
 
@@ -85,27 +94,28 @@ LIBLET_PUBLICAPI void CancellationTokenSource::Swap(CancellationTokenSource &oth
 }
 
 LIBLET_PUBLICAPI void CancellationTokenSource::Clear() noexcept {
-  m_state.Clear();
+  ReleaseSourceRef(m_state);
 }
 
 LIBLET_PUBLICAPI CancellationTokenSource::operator bool() const noexcept {
   return !m_state.IsEmpty();
 }
 
-LIBLET_PUBLICAPI const CancellationToken &CancellationTokenSource::GetToken() const noexcept {
+LIBLET_PUBLICAPI CancellationToken CancellationTokenSource::GetToken() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x0130f546 /* tag_bmpvg */);
-  return reinterpret_cast<CancellationTokenSourceTask *>(Mso::GetIFuture(*this)->GetTask().VoidData())
-      ->CancellationToken;
+  CancellationToken token;
+  token.m_state = m_state;
+  return token;
 }
 
 LIBLET_PUBLICAPI void CancellationTokenSource::Cancel() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x0130f547 /* tag_bmpvh */);
-  m_state->TrySetSuccess();
+  (void)m_state->TrySetValue<bool>(true);
 }
 
 LIBLET_PUBLICAPI void CancellationTokenSource::Abandon() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x0130f548 /* tag_bmpvi */);
-  m_state->TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+  (void)m_state->TrySetValue<bool>(false);
 }
 
 /// True if two CancellationTokenSource have the same state instance.
@@ -249,6 +259,19 @@ LIBLET_PUBLICAPI const ErrorProvider<bool, CancellationErrorProviderGuid> &Cance
   return s_cancellationErrorProvider;
 }
 
+// The shared error code is marked as handled because nobody owns it: observers of cancelled futures are not required to
+// handle it, and its state is never destroyed while it is in use.
+static ErrorCode MakeHandledErrorCode(ErrorCode &&errorCode) noexcept {
+  errorCode.Handle();
+  return std::move(errorCode);
+}
+
+LIBLET_PUBLICAPI const ErrorCode &CancellationErrorCode() noexcept {
+  static const ErrorCode s_cancellationErrorCode{
+      MakeHandledErrorCode(CancellationErrorProvider().MakeErrorCode(true))};
+  return s_cancellationErrorCode;
+}
+
 //=============================================================================
 // TimeoutErrorProvider implementation
 //=============================================================================
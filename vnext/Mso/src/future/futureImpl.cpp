@@ -212,7 +212,7 @@ FutureImpl::~FutureImpl() noexcept {
 
     // Only set error if there are any continuations to observe it.
     if (HasContinuation()) {
-      TrySetError(CancellationErrorProvider().MakeErrorCode(true), /*crashIfFailed:*/ true);
+      TrySetError(Mso::ErrorCode(CancellationErrorCode()), /*crashIfFailed:*/ true);
       data = m_stateAndContinuation.load(std::memory_order_acquire);
     }
   }
@@ -970,7 +970,7 @@ FutureCallback::FutureCallback() noexcept {
 FutureCallback::~FutureCallback() noexcept {
   if (!m_isCalled) {
     // The FutureCallback is never called: we must cancel the future
-    GetFutureImpl(this)->TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+    GetFutureImpl(this)->TrySetError(Mso::ErrorCode(Mso::CancellationErrorCode()));
   }
 }
 
@@ -983,7 +983,7 @@ void FutureCallback::OnCancel() noexcept {
   VerifyElseCrashSzTag(!m_isCalled.exchange(true), "FutureCallback is called twice", 0x024c5891 /* tag_ctf8r */);
 
   // If dispatch queue cannot execute our callback then we try to cancel it.
-  GetFutureImpl(this)->TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+  GetFutureImpl(this)->TrySetError(Mso::ErrorCode(Mso::CancellationErrorCode()));
 }
 
 HRESULT __stdcall FutureCallback::QueryInterface(GUID const &riid, _COM_Outptr_ void **ppvObject) noexcept {
@@ -101,7 +101,7 @@ LIBLET_PUBLICAPI bool Promise<void>::TrySetValue(Mso::Maybe<void> &&value) const
 
 LIBLET_PUBLICAPI bool Promise<void>::TryCancel() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x0160560b /* tag_byfyl */);
-  return m_state->TrySetError(Mso::CancellationErrorProvider().MakeErrorCode(true), /*crashIfFailed:*/ false);
+  return m_state->TrySetError(Mso::ErrorCode(Mso::CancellationErrorCode()), /*crashIfFailed:*/ false);
 }
 
 LIBLET_PUBLICAPI void Promise<void>::SetError(const ErrorCode &errorCode) const noexcept {
@@ -13,12 +13,14 @@ LIBLET_PUBLICAPI PromiseGroup<void>::PromiseGroup() noexcept {
   constexpr const auto &promiseGroupTraits = Mso::Futures::FutureTraitsProvider<
       /*Options:     */ Mso::Futures::FutureOptions::IsShared | Mso::Futures::FutureOptions::CancelIfUnfulfilled,
       /*ResultType:  */ void,
-      /*TaskType:    */ void,
+      /*TaskType:    */ Mso::Futures::PromiseGroupTask<void>,
       /*PostType:    */ void,
       /*InvokeType:  */ void,
       /*AbandonType: */ void>::Traits;
 
-  m_state = Mso::Futures::MakeFuture(promiseGroupTraits, 0, nullptr);
+  Mso::Futures::ByteArrayView taskBuffer;
+  m_state = Mso::Futures::MakeFuture(promiseGroupTraits, sizeof(Mso::Futures::PromiseGroupTask<void>), &taskBuffer);
+  ::new (taskBuffer.Data()) Mso::Futures::PromiseGroupTask<void>();
 }
 
 LIBLET_PUBLICAPI PromiseGroup<void>::PromiseGroup(std::nullptr_t) noexcept {}
@@ -64,6 +66,19 @@ LIBLET_PUBLICAPI Future<void> PromiseGroup<void>::AddFuture() const noexcept {
   return Mso::Future<void>(std::move(promise));
 }
 
+LIBLET_PUBLICAPI void PromiseGroup<void>::AddCallback(
+    Mso::DispatchQueue const &queue,
+    Mso::Functor<void(const Mso::Maybe<void> &)> &&callback) const noexcept {
+  VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x02854122 /* tag_c7ue8 */);
+  Mso::Futures::AddPromiseGroupCallback<void>(*m_state, queue, std::move(callback));
+}
+
+LIBLET_PUBLICAPI void PromiseGroup<void>::AddCallback(
+    Mso::Functor<void(const Mso::Maybe<void> &)> &&callback) const noexcept {
+  VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x02854123 /* tag_c7ue9 */);
+  Mso::Futures::AddPromiseGroupCallback<void>(*m_state, nullptr, std::move(callback));
+}
+
 LIBLET_PUBLICAPI void PromiseGroup<void>::SetValue() const noexcept {
   VerifyElseCrashSzTag(!m_state.IsEmpty(), "State is empty.", 0x01605618 /* tag_byfyy */);
   m_state->TrySetSuccess(/*crashIfFailed:*/ true);
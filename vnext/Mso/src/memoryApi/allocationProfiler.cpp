@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "memoryApi/allocationProfiler.h"
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include "allocationProfilerHooks.h"
+
+namespace Mso::Memory {
+
+namespace Details {
+
+std::atomic<bool> g_isAllocationProfilerStarted{false};
+
+} // namespace Details
+
+namespace {
+
+using Details::LiveAllocation;
+
+// The live allocation table is split in shards to reduce contention between threads freeing sampled allocations.
+struct LiveAllocationShard {
+  std::mutex Mutex;
+  std::unordered_map<const void *, LiveAllocation> Allocations;
+};
+
+constexpr size_t LiveAllocationShardCount = 16;
+
+struct AllocationProfilerState {
+  std::atomic<size_t> SampleInterval{0};
+  std::atomic<uint32_t> SessionId{0};
+  std::atomic<size_t> LiveAllocationCount{0};
+  std::array<LiveAllocationShard, LiveAllocationShardCount> Shards;
+};
+
+// Per-thread sampling state. It has only trivial members to be usable from any allocation, including the ones made
+// during thread shutdown.
+struct ThreadSampler {
+  int64_t BytesUntilSample;
+  uint64_t RandomState;
+  uint32_t SessionId;
+  const char *Tag;
+  bool IsInProfiler;
+};
+
+thread_local ThreadSampler tls_sampler{};
+
+// The state is never destroyed because allocations can be freed after static destructors run.
+AllocationProfilerState &ProfilerState() noexcept {
+  static AllocationProfilerState *state = new AllocationProfilerState();
+  return *state;
+}
+
+LiveAllocationShard &GetShard(AllocationProfilerState &state, const void *pv) noexcept {
+  return state.Shards[(reinterpret_cast<uintptr_t>(pv) >> 4) % LiveAllocationShardCount];
+}
+
+// Prevents the profiler from sampling or looking up its own allocations.
+class ProfilerReentrancyGuard {
+ public:
+  ProfilerReentrancyGuard() noexcept : m_sampler{tls_sampler}, m_isReentrant{m_sampler.IsInProfiler} {
+    m_sampler.IsInProfiler = true;
+  }
+
+  ~ProfilerReentrancyGuard() noexcept {
+    m_sampler.IsInProfiler = m_isReentrant;
+  }
+
+  bool IsReentrant() const noexcept {
+    return m_isReentrant;
+  }
+
+ private:
+  ThreadSampler &m_sampler;
+  bool m_isReentrant;
+};
+
+uint64_t NextRandom(ThreadSampler &sampler) noexcept {
+  if (sampler.RandomState == 0) {
+    static std::atomic<uint64_t> s_seed{0x9E3779B97F4A7C15ull};
+    sampler.RandomState = s_seed.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) ^
+        reinterpret_cast<uintptr_t>(&sampler) ^ 0x2545F4914F6CDD1Dull;
+    if (sampler.RandomState == 0) {
+      sampler.RandomState = 1;
+    }
+  }
+
+  // xorshift64*
+  uint64_t x = sampler.RandomState;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  sampler.RandomState = x;
+  return x * 0x2545F4914F6CDD1Dull;
+}
+
+// Returns the number of bytes to allocate before the next sample. The intervals are exponentially distributed, so
+// that the sampled bytes are a Poisson process with the given mean interval.
+int64_t NextSampleInterval(ThreadSampler &sampler, size_t sampleInterval) noexcept {
+  if (sampleInterval <= 1) {
+    return 0;
+  }
+
+  // A uniform value in (0, 1].
+  double uniform = static_cast<double>((NextRandom(sampler) >> 11) + 1) * (1.0 / 9007199254740992.0);
+  double interval = -std::log(uniform) * static_cast<double>(sampleInterval);
+  return static_cast<int64_t>(std::min(interval, 1e18)) + 1;
+}
+
+// The inverse of the probability that an allocation of the given size is sampled.
+double SampleWeight(size_t size, size_t sampleInterval) noexcept {
+  if (sampleInterval <= 1 || size == 0) {
+    return 1.0;
+  }
+
+  return 1.0 / -std::expm1(-static_cast<double>(size) / static_cast<double>(sampleInterval));
+}
+
+void ClearLiveAllocations(AllocationProfilerState &state) noexcept {
+  ProfilerReentrancyGuard guard;
+  for (auto &shard : state.Shards) {
+    std::unordered_map<const void *, LiveAllocation> allocations;
+    {
+      std::lock_guard<std::mutex> lock{shard.Mutex};
+      state.LiveAllocationCount.fetch_sub(shard.Allocations.size(), std::memory_order_relaxed);
+      allocations.swap(shard.Allocations);
+    }
+  }
+}
+
+} // namespace
+
+namespace Details {
+
+void ProfileAllocation(void *pv, size_t cb, const void *caller) noexcept {
+  ThreadSampler &sampler = tls_sampler;
+  if (sampler.IsInProfiler) {
+    return;
+  }
+
+  AllocationProfilerState &state = ProfilerState();
+  uint32_t sessionId = state.SessionId.load(std::memory_order_acquire);
+  size_t sampleInterval = state.SampleInterval.load(std::memory_order_relaxed);
+  if (sampler.SessionId != sessionId) {
+    sampler.SessionId = sessionId;
+    sampler.BytesUntilSample = NextSampleInterval(sampler, sampleInterval);
+  }
+
+  sampler.BytesUntilSample -= static_cast<int64_t>(cb);
+  if (sampler.BytesUntilSample > 0) {
+    return;
+  }
+
+  sampler.BytesUntilSample = NextSampleInterval(sampler, sampleInterval);
+
+  ProfilerReentrancyGuard guard;
+  LiveAllocationShard &shard = GetShard(state, pv);
+  std::lock_guard<std::mutex> lock{shard.Mutex};
+  auto inserted = shard.Allocations.insert_or_assign(pv, LiveAllocation{cb, caller, sampler.Tag});
+  if (inserted.second) {
+    state.LiveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+bool ProfileFree(void *pv, LiveAllocation *removed) noexcept {
+  AllocationProfilerState &state = ProfilerState();
+  if (state.LiveAllocationCount.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  ProfilerReentrancyGuard guard;
+  if (guard.IsReentrant()) {
+    return false;
+  }
+
+  LiveAllocationShard &shard = GetShard(state, pv);
+  std::lock_guard<std::mutex> lock{shard.Mutex};
+  auto it = shard.Allocations.find(pv);
+  if (it == shard.Allocations.end()) {
+    return false;
+  }
+
+  if (removed) {
+    *removed = it->second;
+  }
+
+  shard.Allocations.erase(it);
+  state.LiveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+void ProfileRestore(void *pv, const LiveAllocation &allocation) noexcept {
+  ProfilerReentrancyGuard guard;
+  if (guard.IsReentrant()) {
+    return;
+  }
+
+  AllocationProfilerState &state = ProfilerState();
+  LiveAllocationShard &shard = GetShard(state, pv);
+  std::lock_guard<std::mutex> lock{shard.Mutex};
+  if (shard.Allocations.emplace(pv, allocation).second) {
+    state.LiveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+} // namespace Details
+
+LIBLET_PUBLICAPI void StartAllocationProfiler(size_t sampleIntervalBytes) noexcept {
+  AllocationProfilerState &state = ProfilerState();
+  Details::g_isAllocationProfilerStarted.store(false, std::memory_order_relaxed);
+  ClearLiveAllocations(state);
+  state.SampleInterval.store(sampleIntervalBytes, std::memory_order_relaxed);
+  state.SessionId.fetch_add(1, std::memory_order_release);
+  Details::g_isAllocationProfilerStarted.store(true, std::memory_order_release);
+}
+
+LIBLET_PUBLICAPI void StopAllocationProfiler() noexcept {
+  Details::g_isAllocationProfilerStarted.store(false, std::memory_order_release);
+  ClearLiveAllocations(ProfilerState());
+}
+
+LIBLET_PUBLICAPI bool IsAllocationProfilerStarted() noexcept {
+  return Details::g_isAllocationProfilerStarted.load(std::memory_order_acquire);
+}
+
+LIBLET_PUBLICAPI std::vector<AllocationSample> GetLiveAllocationSamples() noexcept {
+  AllocationProfilerState &state = ProfilerState();
+  size_t sampleInterval = state.SampleInterval.load(std::memory_order_relaxed);
+
+  ProfilerReentrancyGuard guard;
+  std::map<std::pair<const void *, const char *>, AllocationSample> samplesByCaller;
+  for (auto &shard : state.Shards) {
+    std::lock_guard<std::mutex> lock{shard.Mutex};
+    for (const auto &entry : shard.Allocations) {
+      const LiveAllocation &allocation = entry.second;
+      AllocationSample &sample = samplesByCaller
+                                     .try_emplace(
+                                         std::make_pair(allocation.Caller, allocation.Tag),
+                                         AllocationSample{allocation.Caller, allocation.Tag, 0, 0, 0.0, 0.0})
+                                     .first->second;
+      double weight = SampleWeight(allocation.Size, sampleInterval);
+      sample.SampledCount += 1;
+      sample.SampledBytes += allocation.Size;
+      sample.EstimatedCount += weight;
+      sample.EstimatedBytes += weight * static_cast<double>(allocation.Size);
+    }
+  }
+
+  std::vector<AllocationSample> samples;
+  samples.reserve(samplesByCaller.size());
+  for (const auto &entry : samplesByCaller) {
+    samples.push_back(entry.second);
+  }
+
+  std::sort(samples.begin(), samples.end(), [](const AllocationSample &left, const AllocationSample &right) noexcept {
+    return left.EstimatedBytes > right.EstimatedBytes;
+  });
+  return samples;
+}
+
+LIBLET_PUBLICAPI std::string GetAllocationProfile() noexcept {
+  std::vector<AllocationSample> samples = GetLiveAllocationSamples();
+  size_t sampleInterval = ProfilerState().SampleInterval.load(std::memory_order_relaxed);
+
+  // Group the records by tag to write each tag comment once.
+  std::stable_sort(samples.begin(), samples.end(), [](const AllocationSample &left, const AllocationSample &right) {
+    return std::less<const char *>{}(left.Tag, right.Tag);
+  });
+
+  size_t totalCount = 0;
+  size_t totalBytes = 0;
+  for (const auto &sample : samples) {
+    totalCount += sample.SampledCount;
+    totalBytes += sample.SampledBytes;
+  }
+
+  std::string profile;
+  char line[128];
+  auto appendCounts = [&line, &profile](size_t count, size_t bytes) noexcept {
+    snprintf(line, sizeof(line), "%zu: %zu [%zu: %zu] @", count, bytes, count, bytes);
+    profile += line;
+  };
+
+  profile += "heap profile: ";
+  appendCounts(totalCount, totalBytes);
+  snprintf(line, sizeof(line), " heap_v2/%zu\n", std::max<size_t>(sampleInterval, 1));
+  profile += line;
+
+  const char *currentTag = nullptr;
+  for (const auto &sample : samples) {
+    if (sample.Tag && sample.Tag != currentTag) {
+      profile += "# tag: ";
+      profile += sample.Tag;
+      profile += "\n";
+    }
+
+    currentTag = sample.Tag;
+    appendCounts(sample.SampledCount, sample.SampledBytes);
+    snprintf(line, sizeof(line), " 0x%" PRIxPTR "\n", reinterpret_cast<uintptr_t>(sample.Caller));
+    profile += line;
+  }
+
+  return profile;
+}
+
+LIBLET_PUBLICAPI AllocationTagScope::AllocationTagScope(const char *tag) noexcept : m_previousTag{tls_sampler.Tag} {
+  tls_sampler.Tag = tag;
+}
+
+LIBLET_PUBLICAPI AllocationTagScope::~AllocationTagScope() noexcept {
+  tls_sampler.Tag = m_previousTag;
+}
+
+} // namespace Mso::Memory
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_SRC_MEMORYAPI_ALLOCATIONPROFILERHOOKS_H
+#define MSO_SRC_MEMORYAPI_ALLOCATIONPROFILERHOOKS_H
+
+#include <atomic>
+#include <cstddef>
+
+// Hooks called by the Mso::Memory allocation functions. The checks are inline so that a stopped profiler costs
+// only a relaxed load.
+namespace Mso::Memory::Details {
+
+extern std::atomic<bool> g_isAllocationProfilerStarted;
+
+struct LiveAllocation {
+  size_t Size;
+  const void *Caller;
+  const char *Tag;
+};
+
+void ProfileAllocation(void *pv, size_t cb, const void *caller) noexcept;
+bool ProfileFree(void *pv, LiveAllocation *removed) noexcept;
+void ProfileRestore(void *pv, const LiveAllocation &allocation) noexcept;
+
+inline void OnAllocate(void *pv, size_t cb, const void *caller) noexcept {
+  if (g_isAllocationProfilerStarted.load(std::memory_order_relaxed) && pv) {
+    ProfileAllocation(pv, cb, caller);
+  }
+}
+
+inline void OnFree(void *pv) noexcept {
+  if (g_isAllocationProfilerStarted.load(std::memory_order_relaxed) && pv) {
+    ProfileFree(pv, nullptr);
+  }
+}
+
+// Removes the sample of a block that is about to be reallocated. Returns true with the removed sample if the block
+// was sampled, so that it can be put back with OnReallocateFailed.
+inline bool OnReallocate(void *pv, LiveAllocation &sample) noexcept {
+  return g_isAllocationProfilerStarted.load(std::memory_order_relaxed) && pv && ProfileFree(pv, &sample);
+}
+
+inline void OnReallocateFailed(void *pv, const LiveAllocation &sample) noexcept {
+  if (g_isAllocationProfilerStarted.load(std::memory_order_relaxed)) {
+    ProfileRestore(pv, sample);
+  }
+}
+
+} // namespace Mso::Memory::Details
+
+#endif // MSO_SRC_MEMORYAPI_ALLOCATIONPROFILERHOOKS_H
@@ -4,6 +4,8 @@
 #include "memoryApi/memoryApi.h"
 #include <cstdlib>
 #include <memory>
+#include "allocationProfilerHooks.h"
+#include "compilerAdapters/intrinsics.h"
 
 #if !__clang__ && !__GNUC__
 #pragma detect_mismatch("Allocator", "Crt")
@@ -17,21 +19,30 @@ namespace Mso {
 namespace Memory {
 
 _Use_decl_annotations_ void *AllocateEx(size_t cb, uint32_t /*allocFlags*/) noexcept {
-  return ::malloc(cb);
+  void *pv = ::malloc(cb);
+  Details::OnAllocate(pv, cb, MSO_FUNC_RETURN_ADDRESS());
+  return pv;
 }
 
 _Use_decl_annotations_ void *Reallocate(void **ppv, size_t cb) noexcept {
-  if (ppv == nullptr)
-    return Mso::Memory::Allocate(cb);
-
-  if (*ppv == nullptr) {
-    *ppv = Mso::Memory::Allocate(cb);
-    return *ppv;
+  const void *caller = MSO_FUNC_RETURN_ADDRESS();
+  if (ppv == nullptr || *ppv == nullptr) {
+    void *pv = ::malloc(cb);
+    Details::OnAllocate(pv, cb, caller);
+    if (ppv != nullptr) {
+      *ppv = pv;
+    }
+    return pv;
   }
 
+  // The sample must be removed before the block can be reused by another allocation. It is put back below if
+  // realloc fails and leaves the block in place.
+  Details::LiveAllocation sample;
+  bool isSampled = Details::OnReallocate(*ppv, sample);
   void *pv = ::realloc(*ppv, cb);
   if (pv != nullptr) {
     *ppv = pv;
+    Details::OnAllocate(pv, cb, caller);
   } else if (cb == 0) {
     // HeapReAlloc with 0 size returns valid pointer and we want all implementations do the same
     // realloc(ptr, 0) on Windows or Mac/iOS with ASAN frees the original pointer and returns null
@@ -40,13 +51,17 @@ _Use_decl_annotations_ void *Reallocate(void **ppv, size_t cb) noexcept {
     // so let's allocate a new 0-sized block if resize(ptr, 0) returns nullptr
     pv = ::malloc(0);
     *ppv = pv;
+    Details::OnAllocate(pv, 0, caller);
+  } else if (isSampled) {
+    // pv = nullptr, cb != 0: realloc failed and the original ptr is untouched, so it is still a live sample
+    Details::OnReallocateFailed(*ppv, sample);
   }
-  // else pv = nullptr, cb != 0: if realloc truly failed, the original ptr is untouched
 
   return pv;
 }
 
 _Use_decl_annotations_ void Free(void *pv) noexcept {
+  Details::OnFree(pv);
   ::free(pv);
 }
 
@@ -25,8 +25,8 @@ AsyncStorageManager::~AsyncStorageManager() {
 
 void AsyncStorageManager::putRequestOnQueue(
     AsyncStorageOperation operation,
-    const dynamic &args,
-    const module::CxxModule::Callback &jsCallback) noexcept {
+    dynamic &&args,
+    module::CxxModule::Callback jsCallback) noexcept {
   std::unique_ptr<AsyncRequestQueueArguments> arguments =
       make_unique<AsyncRequestQueueArguments>(operation, std::move(args), std::move(jsCallback));
   {
@@ -48,7 +48,7 @@ void AsyncStorageManager::consumeSetRequest() noexcept {
 
       uniqueMutex.unlock();
 
-      executeAsyncKVOperation(arguments->m_operation, arguments->m_args, arguments->m_jsCallback);
+      executeAsyncKVOperation(arguments->m_operation, std::move(arguments->m_args), arguments->m_jsCallback);
     }
   }
 }
@@ -62,10 +62,17 @@ void AsyncStorageManager::executeKVOperation(
     AsyncStorageOperation operation,
     const dynamic &args,
     const module::CxxModule::Callback &jsCallback) noexcept {
+  executeKVOperation(operation, dynamic(args), module::CxxModule::Callback(jsCallback));
+}
+
+void AsyncStorageManager::executeKVOperation(
+    AsyncStorageOperation operation,
+    dynamic &&args,
+    module::CxxModule::Callback jsCallback) noexcept {
   try {
     switch (operation) {
       case AsyncStorageOperation::multiGet:
-        multiGetInternal(args, jsCallback);
+        multiGetInternal(std::move(args), jsCallback);
         break;
 
       case AsyncStorageOperation::getAllKeys:
@@ -73,7 +80,7 @@ void AsyncStorageManager::executeKVOperation(
         break;
 
       default:
-        putRequestOnQueue(operation, args, jsCallback);
+        putRequestOnQueue(operation, std::move(args), std::move(jsCallback));
         break;
     }
   } catch (std::exception &e) {
@@ -83,16 +90,16 @@ void AsyncStorageManager::executeKVOperation(
 
 void AsyncStorageManager::executeAsyncKVOperation(
     AsyncStorageOperation operation,
-    const dynamic &args,
+    dynamic &&args,
     const module::CxxModule::Callback &jsCallback) noexcept {
   try {
     switch (operation) {
       case AsyncStorageOperation::multiSet:
-        multiSetInternal(args, jsCallback);
+        multiSetInternal(std::move(args), jsCallback);
         break;
 
       case AsyncStorageOperation::multiRemove:
-        multiRemoveInternal(args, jsCallback);
+        multiRemoveInternal(std::move(args), jsCallback);
         break;
 
       case AsyncStorageOperation::clear:
@@ -100,7 +107,7 @@ void AsyncStorageManager::executeAsyncKVOperation(
         break;
 
       case AsyncStorageOperation::multiMerge:
-        multiMergeInternal(args, jsCallback);
+        multiMergeInternal(std::move(args), jsCallback);
         break;
 
       default:
@@ -112,20 +119,25 @@ void AsyncStorageManager::executeAsyncKVOperation(
   }
 }
 
-void AsyncStorageManager::multiGetInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
+void AsyncStorageManager::multiGetInternal(dynamic &&args, const module::CxxModule::Callback &jsCallback) {
   std::vector<std::tuple<std::string, std::string>> retVals =
-      m_aofKVStorage->multiGet(FollyDynamicConverter::jsArgAsStringVector(args));
-  folly::dynamic jsRetVal = FollyDynamicConverter::tupleStringVectorAsRetVal(retVals);
-  jsCallback({noError, jsRetVal});
+      m_aofKVStorage->multiGet(FollyDynamicConverter::jsArgAsStringVector(std::move(args)));
+
+  // A braced list would copy the result values into the callback arguments.
+  std::vector<folly::dynamic> callbackArgs;
+  callbackArgs.reserve(2);
+  callbackArgs.push_back(noError);
+  callbackArgs.push_back(FollyDynamicConverter::tupleStringVectorAsRetVal(std::move(retVals)));
+  jsCallback(std::move(callbackArgs));
 }
 
-void AsyncStorageManager::multiSetInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiSet(FollyDynamicConverter::jsArgAsTupleStringVector(args));
+void AsyncStorageManager::multiSetInternal(dynamic &&args, const module::CxxModule::Callback &jsCallback) {
+  m_aofKVStorage->multiSet(FollyDynamicConverter::jsArgAsTupleStringVector(std::move(args)));
   jsCallback(noErrorVector);
 }
 
-void AsyncStorageManager::multiRemoveInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiRemove(FollyDynamicConverter::jsArgAsStringVector(args));
+void AsyncStorageManager::multiRemoveInternal(dynamic &&args, const module::CxxModule::Callback &jsCallback) {
+  m_aofKVStorage->multiRemove(FollyDynamicConverter::jsArgAsStringVector(std::move(args)));
   jsCallback(noErrorVector);
 }
 
@@ -135,16 +147,19 @@ void AsyncStorageManager::clearInternal(const dynamic &args, const module::CxxMo
   jsCallback(noErrorVector);
 }
 
-void AsyncStorageManager::multiMergeInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiMerge(FollyDynamicConverter::jsArgAsTupleStringVector(args));
+void AsyncStorageManager::multiMergeInternal(dynamic &&args, const module::CxxModule::Callback &jsCallback) {
+  m_aofKVStorage->multiMerge(FollyDynamicConverter::jsArgAsTupleStringVector(std::move(args)));
   jsCallback(noErrorVector);
 }
 
 void AsyncStorageManager::getAllKeysInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
   std::vector<std::string> keys = m_aofKVStorage->getAllKeys();
   if (!keys.empty()) {
-    folly::dynamic jsRetVal = FollyDynamicConverter::stringVectorAsRetVal(keys);
-    jsCallback({noError, jsRetVal});
+    std::vector<folly::dynamic> callbackArgs;
+    callbackArgs.reserve(2);
+    callbackArgs.push_back(noError);
+    callbackArgs.push_back(FollyDynamicConverter::stringVectorAsRetVal(std::move(keys)));
+    jsCallback(std::move(callbackArgs));
   } else {
     jsCallback({"AsyncStorageError - No Keys Found", {}});
   }
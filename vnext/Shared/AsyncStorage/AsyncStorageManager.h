@@ -25,12 +25,18 @@ class AsyncStorageManager {
       const folly::dynamic &args,
       const xplat::module::CxxModule::Callback &jsCallback) noexcept;
 
+  // Moves the keys and values out of args instead of copying them.
+  void executeKVOperation(
+      AsyncStorageOperation operation,
+      folly::dynamic &&args,
+      xplat::module::CxxModule::Callback jsCallback) noexcept;
+
  private:
   struct AsyncRequestQueueArguments {
     AsyncRequestQueueArguments(
         AsyncStorageOperation paramOperation,
-        const folly::dynamic &&paramArgs,
-        const xplat::module::CxxModule::Callback &&paramJsCallback) noexcept
+        folly::dynamic &&paramArgs,
+        xplat::module::CxxModule::Callback &&paramJsCallback) noexcept
         : m_operation(paramOperation), m_args(std::move(paramArgs)), m_jsCallback(std::move(paramJsCallback)) {}
 
     AsyncStorageOperation m_operation;
@@ -51,20 +57,20 @@ class AsyncStorageManager {
 
   void executeAsyncKVOperation(
       AsyncStorageOperation operation,
-      const folly::dynamic &args,
+      folly::dynamic &&args,
       const xplat::module::CxxModule::Callback &jsCallback) noexcept;
 
   void consumeSetRequest() noexcept;
   void putRequestOnQueue(
       AsyncStorageOperation operation,
-      const folly::dynamic &args,
-      const xplat::module::CxxModule::Callback &jsCallback) noexcept;
+      folly::dynamic &&args,
+      xplat::module::CxxModule::Callback jsCallback) noexcept;
 
-  void multiGetInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiSetInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiRemoveInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
+  void multiGetInternal(folly::dynamic &&args, const xplat::module::CxxModule::Callback &jsCallback);
+  void multiSetInternal(folly::dynamic &&args, const xplat::module::CxxModule::Callback &jsCallback);
+  void multiRemoveInternal(folly::dynamic &&args, const xplat::module::CxxModule::Callback &jsCallback);
   void clearInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiMergeInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
+  void multiMergeInternal(folly::dynamic &&args, const xplat::module::CxxModule::Callback &jsCallback);
   void getAllKeysInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
 };
 } // namespace react
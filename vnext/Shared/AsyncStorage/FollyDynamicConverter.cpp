@@ -47,5 +47,53 @@ folly::dynamic FollyDynamicConverter::tupleStringVectorAsRetVal(
   }
   return jsRetVals;
 }
+
+std::vector<string> FollyDynamicConverter::jsArgAsStringVector(dynamic &&args) noexcept {
+  // args is array[array[]]
+  auto &jsKeys = args[0];
+  std::vector<string> keys;
+  keys.reserve(jsKeys.size());
+  for (auto &jsKey : jsKeys) {
+    keys.emplace_back(std::move(jsKey.getString()));
+  }
+  return keys;
+}
+
+std::vector<tuple<string, string>> FollyDynamicConverter::jsArgAsTupleStringVector(dynamic &&args) noexcept {
+  // args is array[array[array[]]]
+  auto &jsKVs = args[0];
+  std::vector<tuple<string, string>> kVVector;
+  kVVector.reserve(jsKVs.size());
+  const int iKeyPos = 0;
+  const int iValuePos = 1;
+  for (auto &jsKV : jsKVs) {
+    kVVector.emplace_back(std::move(jsKV[iKeyPos].getString()), std::move(jsKV[iValuePos].getString()));
+  }
+  return kVVector;
+}
+
+folly::dynamic FollyDynamicConverter::stringVectorAsRetVal(std::vector<string> &&vec) noexcept {
+  // Resize first to allocate the array once. Null values do not allocate.
+  folly::dynamic jsRetVals = folly::dynamic::array;
+  jsRetVals.resize(vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    jsRetVals[i] = std::move(vec[i]);
+  }
+  return jsRetVals;
+}
+
+folly::dynamic FollyDynamicConverter::tupleStringVectorAsRetVal(std::vector<tuple<string, string>> &&vec) noexcept {
+  folly::dynamic jsRetVals = folly::dynamic::array;
+  jsRetVals.resize(vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    // dynamic::array(...) would copy the strings out of its initializer list.
+    auto &jsRetVal = jsRetVals[i];
+    jsRetVal = folly::dynamic::array;
+    jsRetVal.resize(2);
+    jsRetVal[0] = std::move(std::get<0>(vec[i]));
+    jsRetVal[1] = std::move(std::get<1>(vec[i]));
+  }
+  return jsRetVals;
+}
 } // namespace react
 } // namespace facebook
@@ -19,6 +19,13 @@ class FollyDynamicConverter {
   static std::vector<tuple<string, string>> jsArgAsTupleStringVector(const dynamic &args) noexcept;
   static folly::dynamic stringVectorAsRetVal(const std::vector<string> &vec) noexcept;
   static folly::dynamic tupleStringVectorAsRetVal(const std::vector<tuple<string, string>> &vec) noexcept;
+
+  // The rvalue overloads move the strings instead of copying them.
+  // The moved-from args and vec are left with unspecified string values.
+  static std::vector<string> jsArgAsStringVector(dynamic &&args) noexcept;
+  static std::vector<tuple<string, string>> jsArgAsTupleStringVector(dynamic &&args) noexcept;
+  static folly::dynamic stringVectorAsRetVal(std::vector<string> &&vec) noexcept;
+  static folly::dynamic tupleStringVectorAsRetVal(std::vector<tuple<string, string>> &&vec) noexcept;
 };
 } // namespace react
 } // namespace facebook
\ No newline at end of file
@@ -120,25 +120,29 @@ vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &ke
 }
 
 void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePairs) {
+  multiSet(vector<tuple<string, string>>(keyValuePairs));
+}
+
+void KeyValueStorage::multiSet(vector<tuple<string, string>> &&keyValuePairs) {
   waitForStorageLoadComplete();
 
-  stringstream appendEntry;
   bool fUpdateStorageFile = false;
 
-  for (auto const &kvTuple : keyValuePairs) {
-    string key = get<0>(kvTuple);
-    string value = get<1>(kvTuple);
+  for (auto &kvTuple : keyValuePairs) {
+    string &key = get<0>(kvTuple);
+    string &value = get<1>(kvTuple);
 
     // check if we need to modify the storage file
     // 1. if key does not exist
     // 2. if keys exists and value is different
-    if (m_kvMap.find(key) == m_kvMap.end() || m_kvMap[key] != value) {
+    auto it = m_kvMap.find(key);
+    if (it == m_kvMap.end()) {
       // update the in-memory map
-      m_kvMap[key] = value;
+      m_kvMap.emplace(std::move(key), std::move(value));
+      fUpdateStorageFile = true;
+    } else if (it->second != value) {
+      it->second = std::move(value);
       fUpdateStorageFile = true;
-      escapeString(key);
-      escapeString(value);
-      appendEntry << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
     }
   }
 
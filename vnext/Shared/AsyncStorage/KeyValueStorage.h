@@ -18,6 +18,7 @@ class KeyValueStorage {
 
   std::vector<std::tuple<std::string, std::string>> multiGet(const std::vector<std::string> &keys);
   void multiSet(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
+  void multiSet(std::vector<std::tuple<std::string, std::string>> &&keyValuePairs);
   void multiRemove(const std::vector<std::string> &keys);
   void multiMerge(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
   void clear();
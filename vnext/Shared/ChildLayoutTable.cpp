@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "ChildLayoutTable.h"
+
+namespace facebook {
+namespace react {
+
+void ChildLayoutTable::CommitLayout(const void *child, const LayoutFrame &frame) {
+  auto &layout = m_children[child];
+  if (!layout.hasFrame || layout.frame.width != frame.width || layout.frame.height != frame.height) {
+    layout.needsMeasure = true;
+  }
+
+  layout.frame = frame;
+  layout.hasFrame = true;
+}
+
+bool ChildLayoutTable::TakeNeedsMeasure(const void *child) {
+  auto &layout = m_children[child];
+  bool needsMeasure = layout.needsMeasure;
+  layout.needsMeasure = false;
+  return needsMeasure;
+}
+
+const LayoutFrame *ChildLayoutTable::ArrangeChild(const void *child) noexcept {
+  auto it = m_children.find(child);
+  if (it == m_children.end()) {
+    return nullptr;
+  }
+
+  if (it->second.arrangePass != m_arrangePass) {
+    it->second.arrangePass = m_arrangePass;
+    ++m_arrangedCount;
+  }
+
+  return it->second.hasFrame ? &it->second.frame : nullptr;
+}
+
+void ChildLayoutTable::EndArrange() {
+  if (m_arrangedCount < m_children.size()) {
+    for (auto it = m_children.begin(); it != m_children.end();) {
+      if (it->second.arrangePass != m_arrangePass) {
+        it = m_children.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  ++m_arrangePass;
+  m_arrangedCount = 0;
+}
+
+void ChildLayoutTable::RemoveChild(const void *child) noexcept {
+  m_children.erase(child);
+}
+
+void ChildLayoutTable::Clear() noexcept {
+  m_children.clear();
+  m_arrangedCount = 0;
+}
+
+size_t ChildLayoutTable::Size() const noexcept {
+  return m_children.size();
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "LayoutAnimationPlanner.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+// Keeps the frames computed by Yoga for the children of a native panel, so
+// that the panel can arrange its children without reading them back from the
+// platform views, and only measures the children whose size may have changed.
+// Children are identified by an opaque pointer that stays valid while they
+// are in the panel.
+class ChildLayoutTable {
+ public:
+  // Records the frame committed for a child by a layout pass. The child is
+  // measured again if its size changed.
+  void CommitLayout(const void *child, const LayoutFrame &frame);
+
+  // Returns true if the child must be measured, which is the case for
+  // children that were never measured since they were added and children whose
+  // size changed since they were last measured. Clears the request.
+  bool TakeNeedsMeasure(const void *child);
+
+  // Returns the committed frame of a child, or nullptr if no layout pass
+  // reached it yet. Children that are not arranged between two calls to
+  // EndArrange are forgotten, so that the table drops the children that were
+  // removed from the panel without RemoveChild.
+  const LayoutFrame *ArrangeChild(const void *child) noexcept;
+  void EndArrange();
+
+  void RemoveChild(const void *child) noexcept;
+  void Clear() noexcept;
+
+  size_t Size() const noexcept;
+
+ private:
+  struct ChildLayout {
+    LayoutFrame frame;
+    bool hasFrame{false};
+    bool needsMeasure{true};
+    uint32_t arrangePass{0};
+  };
+
+  std::unordered_map<const void *, ChildLayout> m_children;
+  uint32_t m_arrangePass{1};
+  size_t m_arrangedCount{0};
+};
+
+} // namespace react
+} // namespace facebook
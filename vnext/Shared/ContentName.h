@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// The content name of a view is the name given to it for accessibility when it
+// has no label: the names of its children in document order, separated by
+// spaces. Children without a name are skipped.
+
+inline void AppendContentName(std::wstring &name, std::wstring_view childName) {
+  if (childName.empty()) {
+    return;
+  }
+
+  if (!name.empty()) {
+    name += L' ';
+  }
+  name += childName;
+}
+
+// childNameOf returns the name of a child, as anything convertible to a
+// std::wstring_view, and an empty string for children without a name.
+template <typename Children, typename ChildNameOf>
+std::wstring ComposeContentName(const Children &children, ChildNameOf &&childNameOf) {
+  std::wstring name;
+  for (const auto &child : children) {
+    const auto &childName = childNameOf(child);
+    AppendContentName(name, childName);
+  }
+  return name;
+}
+
+// Caches the content name of a view for its automation peer. The name is built
+// again when the content version of the view changes, when its children are no
+// longer the same elements in the same order, or when the name of a child could
+// change without a new content version. Comparing the children catches the
+// ones that are added or removed without going through the view.
+template <typename ChildId>
+class ContentNameCache {
+ public:
+  // childIdOf returns a value that identifies a child. childNameOf(child,
+  // isCacheable) returns the name of a child, and sets isCacheable to false if
+  // that name may change without a new content version. Returns true if the
+  // name was built again.
+  template <typename Children, typename ChildIdOf, typename ChildNameOf>
+  bool Update(uint64_t version, const Children &children, ChildIdOf &&childIdOf, ChildNameOf &&childNameOf) {
+    if (IsValid(version, children, childIdOf)) {
+      return false;
+    }
+
+    m_childIds.clear();
+    m_isCacheable = true;
+    m_name = ComposeContentName(children, [&](const auto &child) {
+      m_childIds.push_back(childIdOf(child));
+      return childNameOf(child, m_isCacheable);
+    });
+    m_version = version;
+    m_isValid = true;
+    return true;
+  }
+
+  const std::wstring &Name() const noexcept {
+    return m_name;
+  }
+
+ private:
+  template <typename Children, typename ChildIdOf>
+  bool IsValid(uint64_t version, const Children &children, ChildIdOf &childIdOf) const {
+    if (!m_isValid || !m_isCacheable || version != m_version) {
+      return false;
+    }
+
+    size_t index = 0;
+    for (const auto &child : children) {
+      if (index == m_childIds.size() || !(m_childIds[index] == childIdOf(child))) {
+        return false;
+      }
+      ++index;
+    }
+
+    return index == m_childIds.size();
+  }
+
+ private:
+  std::wstring m_name;
+  std::vector<ChildId> m_childIds;
+  uint64_t m_version{0};
+  bool m_isValid{false};
+  bool m_isCacheable{false};
+};
+
+} // namespace react
+} // namespace facebook
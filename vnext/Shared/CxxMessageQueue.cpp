@@ -7,7 +7,7 @@
 
 #include <mutex>
 #include <queue>
-#include <unordered_map>
+#include <utility>
 
 #include <glog/logging.h>
 
@@ -28,18 +28,6 @@ time_point now() {
 
 class Task {
  public:
-  static Task *create(std::function<void()> &&func) {
-    return new Task{std::move(func), false, time_point()};
-  }
-
-  static Task *createSync(std::function<void()> &&func) {
-    return new Task{std::move(func), true, time_point()};
-  }
-
-  static Task *createDelayed(std::function<void()> &&func, time_point startTime) {
-    return new Task{std::move(func), false, startTime};
-  }
-
   std::function<void()> func;
   // This flag is just to mark that the task is expected to be synchronous. If
   // a synchronous task races with stopping the queue, the thread waiting on
@@ -49,6 +37,8 @@ class Task {
   time_point startTime;
 
   folly::AtomicIntrusiveLinkedListHook<Task> hook;
+  // Next task in the free list of the TaskPool.
+  Task *nextFree{nullptr};
 
   // Should this sort consider id also?
   struct Compare {
@@ -58,11 +48,85 @@ class Task {
   };
 };
 
+// Recycles the tasks of a queue so that posting to a queue that runs at a
+// steady pace does not allocate. Tasks are acquired by any producer thread and
+// released by the thread running the queue. The pool keeps at most
+// kMaxFreeTasks tasks, which bounds the memory kept after a burst of posts.
+class TaskPool {
+ public:
+  static constexpr size_t kMaxFreeTasks = 256;
+
+  struct Releaser {
+    void operator()(Task *t) const {
+      pool->release(t);
+    }
+
+    TaskPool *pool;
+  };
+
+  using TaskPtr = std::unique_ptr<Task, Releaser>;
+
+  ~TaskPool() {
+    while (freeTasks_) {
+      delete std::exchange(freeTasks_, freeTasks_->nextFree);
+    }
+  }
+
+  Task *acquire(std::function<void()> &&func, bool sync, time_point startTime) {
+    Task *t = nullptr;
+    {
+      std::lock_guard<std::mutex> g(lock_);
+      if (freeTasks_) {
+        t = std::exchange(freeTasks_, freeTasks_->nextFree);
+        --freeCount_;
+      }
+    }
+
+    if (!t) {
+      t = new Task();
+    }
+
+    // Moving a std::function never allocates: small callables are stored in
+    // its inline buffer and larger ones keep their existing heap storage.
+    t->func = std::move(func);
+    t->sync = sync;
+    t->startTime = startTime;
+    return t;
+  }
+
+  void release(Task *t) {
+    // The callable is destroyed outside of the lock since it may run
+    // arbitrary code.
+    t->func = nullptr;
+    {
+      std::lock_guard<std::mutex> g(lock_);
+      if (freeCount_ < kMaxFreeTasks) {
+        t->nextFree = std::exchange(freeTasks_, t);
+        ++freeCount_;
+        return;
+      }
+    }
+
+    delete t;
+  }
+
+  TaskPtr own(Task *t) {
+    return TaskPtr(t, Releaser{this});
+  }
+
+ private:
+  std::mutex lock_;
+  Task *freeTasks_{nullptr};
+  size_t freeCount_{0};
+};
+
 class DelayedTaskQueue {
  public:
+  explicit DelayedTaskQueue(TaskPool &pool) : pool_(pool) {}
+
   ~DelayedTaskQueue() {
     while (!queue_.empty()) {
-      delete queue_.top();
+      pool_.release(queue_.top());
       queue_.pop();
     }
   }
@@ -73,7 +137,7 @@ class DelayedTaskQueue {
       if (now() < d->startTime) {
         break;
       }
-      auto owned = std::unique_ptr<Task>(queue_.top());
+      auto owned = pool_.own(queue_.top());
       queue_.pop();
       owned->func();
     }
@@ -92,6 +156,7 @@ class DelayedTaskQueue {
   }
 
  private:
+  TaskPool &pool_;
   std::priority_queue<Task *, std::vector<Task *>, Task::Compare> queue_;
 };
 
@@ -100,16 +165,16 @@ class DelayedTaskQueue {
 class CxxMessageQueue::QueueRunner {
  public:
   ~QueueRunner() {
-    queue_.sweep([](Task *t) { delete t; });
+    queue_.sweep([this](Task *t) { pool_.release(t); });
   }
 
   void enqueue(std::function<void()> &&func) {
-    enqueueTask(Task::create(std::move(func)));
+    enqueueTask(pool_.acquire(std::move(func), false, time_point()));
   }
 
   void enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
     if (delayMs) {
-      enqueueTask(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)));
+      enqueueTask(pool_.acquire(std::move(func), false, now() + std::chrono::milliseconds(delayMs)));
     } else {
       enqueue(std::move(func));
     }
@@ -117,10 +182,13 @@ class CxxMessageQueue::QueueRunner {
 
   void enqueueSync(std::function<void()> &&func) {
     EventFlag done;
-    enqueueTask(Task::createSync([&]() mutable {
-      func();
-      done.set();
-    }));
+    enqueueTask(pool_.acquire(
+        [&]() mutable {
+          func();
+          done.set();
+        },
+        true,
+        time_point()));
     if (stopped_) {
       // If this queue is stopped_, the sync task might never actually run.
       throw std::runtime_error("Stopped within enqueueSync.");
@@ -173,7 +241,7 @@ class CxxMessageQueue::QueueRunner {
   // delayed tasks whose scheduled time has arrived.
   void sweep() {
     queue_.sweep([this](Task *t) {
-      std::unique_ptr<Task> owned(t);
+      auto owned = pool_.own(t);
       if (stopped_.load(std::memory_order_relaxed)) {
         if (t->sync) {
           throw std::runtime_error("Sync task posted while stopped.");
@@ -211,10 +279,12 @@ class CxxMessageQueue::QueueRunner {
 
   std::thread::id tid_;
 
+  // Declared first so that it outlives the tasks of both queues.
+  TaskPool pool_;
   folly::AtomicIntrusiveLinkedList<Task, &Task::hook> queue_;
 
   std::atomic_bool stopped_{false};
-  DelayedTaskQueue delayed_;
+  DelayedTaskQueue delayed_{pool_};
 
   BinarySemaphore pending_;
   EventFlag finished_;
@@ -259,50 +329,30 @@ bool CxxMessageQueue::isOnQueue() {
 }
 
 namespace {
-struct MQRegistry {
-  std::weak_ptr<CxxMessageQueue> find(std::thread::id tid) {
-    std::lock_guard<std::mutex> g(lock_);
-    auto iter = registry_.find(tid);
-    if (iter == registry_.end())
-      return std::weak_ptr<CxxMessageQueue>();
-    return iter->second;
-  }
-
-  void registerQueue(std::thread::id tid, std::weak_ptr<CxxMessageQueue> mq) {
-    std::lock_guard<std::mutex> g(lock_);
-    registry_[tid] = mq;
-  }
-
-  void unregister(std::thread::id tid) {
-    std::lock_guard<std::mutex> g(lock_);
-    registry_.erase(tid);
-  }
-
- private:
-  std::mutex lock_;
-  std::unordered_map<std::thread::id, std::weak_ptr<CxxMessageQueue>> registry_;
-};
-
-MQRegistry &getMQRegistry() {
-  static MQRegistry *mq_registry = new MQRegistry();
-  return *mq_registry;
-}
+// Queue whose runloop runs on this thread. It is only set while the runloop
+// runs, which makes current() a thread local read instead of a lookup in a
+// shared registry.
+thread_local const std::weak_ptr<CxxMessageQueue> *tlsCurrentQueue{nullptr};
 } // namespace
 
 std::weak_ptr<CxxMessageQueue> CxxMessageQueue::current() {
-  auto tid = std::this_thread::get_id();
-  return getMQRegistry().find(tid);
+  return tlsCurrentQueue ? *tlsCurrentQueue : std::weak_ptr<CxxMessageQueue>();
 }
 
 std::function<void()> CxxMessageQueue::getRunLoop(std::shared_ptr<CxxMessageQueue> mq) {
   return [capture = mq->qr_, weakMq = std::weak_ptr<CxxMessageQueue>(mq)] {
     capture->bindToThisThread();
-    auto tid = std::this_thread::get_id();
 
     // TODO: handle nested runloops (either allow them or throw an exception).
-    getMQRegistry().registerQueue(tid, weakMq);
+    struct CurrentQueueScope {
+      ~CurrentQueueScope() {
+        tlsCurrentQueue = previousQueue;
+      }
+
+      const std::weak_ptr<CxxMessageQueue> *previousQueue;
+    } scope{std::exchange(tlsCurrentQueue, &weakMq)};
+
     capture->run();
-    getMQRegistry().unregister(tid);
   };
 }
 
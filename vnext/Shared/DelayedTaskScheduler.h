@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Queue of tasks ordered by their deadline. Tasks with the same deadline keep
+// the order in which they were pushed. It is not thread safe.
+template <class TClock = std::chrono::steady_clock>
+class DelayedTaskQueue {
+ public:
+  using Clock = TClock;
+  using TimePoint = typename Clock::time_point;
+  using Task = std::function<void()>;
+
+  void Push(TimePoint deadline, Task &&task) {
+    m_entries.push(Entry{deadline, m_nextSequence++, std::move(task)});
+  }
+
+  // Removes and returns all tasks whose deadline is not after now.
+  std::vector<Task> PopDueTasks(TimePoint now) {
+    std::vector<Task> dueTasks;
+    while (!m_entries.empty() && m_entries.top().Deadline <= now) {
+      // priority_queue::top is const, but the entry is removed right away.
+      dueTasks.push_back(std::move(const_cast<Entry &>(m_entries.top()).Action));
+      m_entries.pop();
+    }
+
+    return dueTasks;
+  }
+
+  std::optional<TimePoint> NextDeadline() const {
+    if (m_entries.empty()) {
+      return std::nullopt;
+    }
+
+    return m_entries.top().Deadline;
+  }
+
+  bool Empty() const noexcept {
+    return m_entries.empty();
+  }
+
+  size_t Size() const noexcept {
+    return m_entries.size();
+  }
+
+  void Clear() noexcept {
+    m_entries = {};
+  }
+
+ private:
+  struct Entry {
+    TimePoint Deadline;
+    uint64_t Sequence;
+    Task Action;
+  };
+
+  // Compares only the deadline and sequence so that moved-from tasks are never
+  // accessed by the priority queue.
+  struct EntryLater {
+    bool operator()(const Entry &left, const Entry &right) const noexcept {
+      return left.Deadline > right.Deadline || (left.Deadline == right.Deadline && left.Sequence > right.Sequence);
+    }
+  };
+
+ private:
+  std::priority_queue<Entry, std::vector<Entry>, EntryLater> m_entries;
+  uint64_t m_nextSequence{0};
+};
+
+// Owns a timer thread that hands delayed tasks to a dispatcher as soon as their
+// deadline is reached. The thread sleeps until the earliest deadline instead of
+// polling. Destroying the scheduler stops and joins the thread. Tasks that are
+// not due yet are dropped.
+template <class TClock = std::chrono::steady_clock>
+class DelayedTaskScheduler {
+ public:
+  using Clock = TClock;
+  using TimePoint = typename Clock::time_point;
+  using Task = std::function<void()>;
+  using Dispatcher = std::function<void(Task &&)>;
+
+  explicit DelayedTaskScheduler(Dispatcher &&dispatcher)
+      : m_dispatcher{std::move(dispatcher)}, m_timerThread{[this]() { TimerFunc(); }} {}
+
+  ~DelayedTaskScheduler() noexcept {
+    Shutdown();
+  }
+
+  DelayedTaskScheduler(const DelayedTaskScheduler &) = delete;
+  DelayedTaskScheduler &operator=(const DelayedTaskScheduler &) = delete;
+
+  template <class TRep, class TPeriod>
+  void PostDelayedTask(Task &&task, std::chrono::duration<TRep, TPeriod> delay) {
+    PostTaskAt(std::move(task), Clock::now() + std::chrono::duration_cast<typename Clock::duration>(delay));
+  }
+
+  void PostTaskAt(Task &&task, TimePoint deadline) {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      if (m_isStopRequested) {
+        return;
+      }
+
+      m_tasks.Push(deadline, std::move(task));
+    }
+
+    // The new task may be due earlier than the one the timer thread waits for.
+    m_tasksChanged.notify_one();
+  }
+
+  // Stops the timer thread and waits for it to finish. Tasks that are not due
+  // yet are dropped. It is safe to call it more than once.
+  void Shutdown() noexcept {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_isStopRequested = true;
+      m_tasks.Clear();
+    }
+
+    m_tasksChanged.notify_one();
+
+    if (m_timerThread.joinable() && m_timerThread.get_id() != std::this_thread::get_id()) {
+      m_timerThread.join();
+    }
+  }
+
+  size_t PendingTaskCount() const noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_tasks.Size();
+  }
+
+ private:
+  void TimerFunc() noexcept {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (!m_isStopRequested) {
+      auto nextDeadline = m_tasks.NextDeadline();
+      if (!nextDeadline) {
+        m_tasksChanged.wait(lock);
+        continue;
+      }
+
+      if (Clock::now() < *nextDeadline) {
+        // Wakes up at the deadline, or earlier if a task is posted or the
+        // scheduler is shut down. Either way we recompute the next deadline.
+        m_tasksChanged.wait_until(lock, *nextDeadline);
+        continue;
+      }
+
+      auto dueTasks = m_tasks.PopDueTasks(Clock::now());
+      lock.unlock();
+      for (auto &task : dueTasks) {
+        m_dispatcher(std::move(task));
+      }
+
+      lock.lock();
+    }
+  }
+
+ private:
+  const Dispatcher m_dispatcher;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_tasksChanged;
+  DelayedTaskQueue<Clock> m_tasks;
+  bool m_isStopRequested{false};
+  std::thread m_timerThread; // must be the last field to start after others are initialized.
+};
+
+} // namespace react
+} // namespace facebook
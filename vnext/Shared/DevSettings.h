@@ -4,6 +4,7 @@
 #pragma once
 #include "Logging.h"
 #include "MemoryTracker.h"
+#include "SoftExceptionLimiter.h"
 
 #include <IRedBoxHandler.h>
 #include <functional>
@@ -55,6 +56,11 @@ struct DevSettings {
   NativeLoggingHook loggingCallback;
   std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler;
 
+  /// Limits the soft exceptions that are reported to the redboxHandler.
+  /// Repeated ones are reported in periodic summaries. Fatal errors are
+  /// always reported.
+  SoftExceptionLimits softExceptionLimits;
+
   /// Enables the user to set a custom root path for bundle resolution
   std::string bundleRootPath;
 
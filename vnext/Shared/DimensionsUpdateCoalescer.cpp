@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "DimensionsUpdateCoalescer.h"
+
+namespace Microsoft::ReactNative {
+
+bool operator==(const DeviceDimensions &left, const DeviceDimensions &right) noexcept {
+  return left.windowWidth == right.windowWidth && left.windowHeight == right.windowHeight &&
+      left.scale == right.scale && left.textScaleFactor == right.textScaleFactor && left.dpi == right.dpi &&
+      left.screenWidth == right.screenWidth && left.screenHeight == right.screenHeight;
+}
+
+bool operator!=(const DeviceDimensions &left, const DeviceDimensions &right) noexcept {
+  return !(left == right);
+}
+
+DimensionsUpdateCoalescer::DimensionsUpdateCoalescer(Clock::duration interval, const DeviceDimensions &initial) noexcept
+    : m_interval{interval}, m_dimensions{initial}, m_reportedDimensions{initial} {}
+
+DimensionsUpdateCoalescer::UpdateResult DimensionsUpdateCoalescer::Update(
+    const DeviceDimensions &dimensions,
+    Clock::time_point now) noexcept {
+  m_dimensions = dimensions;
+
+  // The deferred report sends the latest dimensions.
+  if (m_hasDeferredReport || m_dimensions == m_reportedDimensions) {
+    return UpdateResult::None;
+  }
+
+  if (m_hasReported && now - m_lastReportTime < m_interval) {
+    m_hasDeferredReport = true;
+    return UpdateResult::Defer;
+  }
+
+  m_reportedDimensions = m_dimensions;
+  m_lastReportTime = now;
+  m_hasReported = true;
+  return UpdateResult::Report;
+}
+
+bool DimensionsUpdateCoalescer::OnTimer(Clock::time_point now) noexcept {
+  if (!m_hasDeferredReport) {
+    return false;
+  }
+
+  m_hasDeferredReport = false;
+  if (m_dimensions == m_reportedDimensions) {
+    return false;
+  }
+
+  m_reportedDimensions = m_dimensions;
+  m_lastReportTime = now;
+  return true;
+}
+
+bool DimensionsUpdateCoalescer::HasDeferredReport() const noexcept {
+  return m_hasDeferredReport;
+}
+
+DimensionsUpdateCoalescer::Clock::time_point DimensionsUpdateCoalescer::DeferredReportTime() const noexcept {
+  return m_lastReportTime + m_interval;
+}
+
+const DeviceDimensions &DimensionsUpdateCoalescer::Dimensions() const noexcept {
+  return m_dimensions;
+}
+
+} // namespace Microsoft::ReactNative
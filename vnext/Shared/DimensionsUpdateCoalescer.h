@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Microsoft::ReactNative {
+
+// The values that the DeviceInfo module reports as Dimensions.
+struct DeviceDimensions {
+  float windowWidth{0};
+  float windowHeight{0};
+  float scale{0};
+  double textScaleFactor{0};
+  float dpi{0};
+  uint32_t screenWidth{0};
+  uint32_t screenHeight{0};
+};
+
+bool operator==(const DeviceDimensions &left, const DeviceDimensions &right) noexcept;
+bool operator!=(const DeviceDimensions &left, const DeviceDimensions &right) noexcept;
+
+// Decides when the DeviceInfo module reports new dimensions to JavaScript.
+// Updates that do not change the dimensions are not reported. Bursts of
+// updates, e.g. while a window is resized, are reported at most once per
+// interval: an update that comes within the interval of the last report is
+// deferred, and the latest dimensions are reported when the interval ends.
+// The class does not own a timer. Times are passed in, and the caller calls
+// OnTimer at the time returned by DeferredReportTime.
+class DimensionsUpdateCoalescer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class UpdateResult {
+    // Nothing to report now.
+    None,
+    // The dimensions must be reported now.
+    Report,
+    // A report was deferred. The caller must call OnTimer at
+    // DeferredReportTime.
+    Defer,
+  };
+
+  // The initial dimensions are the ones JavaScript already knows.
+  DimensionsUpdateCoalescer(Clock::duration interval, const DeviceDimensions &initial) noexcept;
+
+  UpdateResult Update(const DeviceDimensions &dimensions, Clock::time_point now) noexcept;
+
+  // Ends the deferral. Returns true if the latest dimensions must be reported,
+  // which is not the case if they went back to the last reported ones.
+  bool OnTimer(Clock::time_point now) noexcept;
+
+  bool HasDeferredReport() const noexcept;
+  Clock::time_point DeferredReportTime() const noexcept;
+
+  // The latest dimensions passed to Update.
+  const DeviceDimensions &Dimensions() const noexcept;
+
+ private:
+  Clock::duration m_interval;
+  DeviceDimensions m_dimensions;
+  DeviceDimensions m_reportedDimensions;
+  Clock::time_point m_lastReportTime{};
+  bool m_hasReported{false};
+  bool m_hasDeferredReport{false};
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "WebSocketCallPipeline.h"
+
+#include <algorithm>
+
+namespace react::uwp {
+
+WebSocketCallPipeline::WebSocketCallPipeline(SendBatch &&sendBatch) noexcept : m_sendBatch(std::move(sendBatch)) {}
+
+void WebSocketCallPipeline::Send(std::string &&message) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  Enqueue(std::move(message), lock);
+}
+
+void WebSocketCallPipeline::Call(int requestId, std::string &&message, Completion &&completion) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_pendingCalls.push_back(PendingCall{requestId, std::move(completion)});
+  Enqueue(std::move(message), lock);
+}
+
+void WebSocketCallPipeline::Enqueue(std::string &&message, std::unique_lock<std::mutex> &lock) {
+  m_queuedMessages.push_back(std::move(message));
+  if (m_isSending) {
+    return;
+  }
+
+  m_isSending = true;
+  auto batch = std::move(m_queuedMessages);
+  m_queuedMessages.clear();
+  lock.unlock();
+
+  m_sendBatch(std::move(batch));
+}
+
+std::vector<std::string> WebSocketCallPipeline::OnBatchSent() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto batch = std::move(m_queuedMessages);
+  m_queuedMessages.clear();
+  m_isSending = !batch.empty();
+  return batch;
+}
+
+bool WebSocketCallPipeline::OnReply(int requestId, std::string &&result) {
+  std::lock_guard<std::mutex> deliveryLock(m_deliveryMutex);
+  std::vector<PendingCall> completedCalls;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Replies usually come in order, so the call is found at the front.
+    auto it = std::find_if(m_pendingCalls.begin(), m_pendingCalls.end(), [requestId](const PendingCall &call) {
+      return call.requestId == requestId;
+    });
+    if (it == m_pendingCalls.end() || it->hasResult) {
+      return false;
+    }
+
+    it->hasResult = true;
+    it->result = std::move(result);
+
+    while (!m_pendingCalls.empty() && m_pendingCalls.front().hasResult) {
+      completedCalls.push_back(std::move(m_pendingCalls.front()));
+      m_pendingCalls.pop_front();
+    }
+  }
+
+  for (auto &call : completedCalls) {
+    call.completion(std::move(call.result));
+  }
+
+  return true;
+}
+
+void WebSocketCallPipeline::OnBatchFailed() noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_queuedMessages.clear();
+  m_pendingCalls.clear();
+  m_isSending = false;
+}
+
+void WebSocketCallPipeline::Reset() noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_queuedMessages.clear();
+  m_pendingCalls.clear();
+}
+
+size_t WebSocketCallPipeline::PendingCallCount() const noexcept {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_pendingCalls.size();
+}
+
+} // namespace react::uwp
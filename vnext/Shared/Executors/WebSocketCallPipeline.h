@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace react::uwp {
+
+// Pipelines the calls that WebSocketJSExecutor makes to the remote JavaScript
+// debugger. A call does not wait for the reply of the previous one: messages
+// are queued, and the messages queued while the transport writes a batch are
+// written together in the next batch. Replies may be received in any order,
+// but their results are delivered in the order of the calls.
+class WebSocketCallPipeline {
+ public:
+  // Starts writing a batch of messages in order. The writer calls OnBatchSent
+  // when done, and no other batch is sent before that.
+  using SendBatch = std::function<void(std::vector<std::string> &&messages)>;
+
+  // Receives the result of a call.
+  using Completion = std::function<void(std::string &&result)>;
+
+  explicit WebSocketCallPipeline(SendBatch &&sendBatch) noexcept;
+
+  // Queues a message whose reply, if any, is not handled by the pipeline.
+  void Send(std::string &&message);
+
+  // Queues the message of a call. The completion is called with its result
+  // after the completions of all previous calls.
+  void Call(int requestId, std::string &&message, Completion &&completion);
+
+  // Returns the messages queued while the last batch was written, which the
+  // writer writes next. If there are none, the next message is sent through
+  // SendBatch.
+  std::vector<std::string> OnBatchSent();
+
+  // Records the result of a call and delivers the results that are no longer
+  // waiting for previous calls. Returns false if no pending call has this id.
+  bool OnReply(int requestId, std::string &&result);
+
+  // Called by the writer instead of OnBatchSent when writing a batch failed.
+  // Drops the queued messages and the pending calls like Reset, and lets the
+  // next message start a new batch.
+  void OnBatchFailed() noexcept;
+
+  // Drops the queued messages and the pending calls, whose completions are
+  // not called. Used when the connection fails. A batch that is being written
+  // is still finished by its writer.
+  void Reset() noexcept;
+
+  size_t PendingCallCount() const noexcept;
+
+ private:
+  struct PendingCall {
+    int requestId;
+    Completion completion;
+    bool hasResult{false};
+    std::string result;
+  };
+
+  void Enqueue(std::string &&message, std::unique_lock<std::mutex> &lock);
+
+  SendBatch m_sendBatch;
+
+  mutable std::mutex m_mutex;
+  std::vector<std::string> m_queuedMessages;
+  bool m_isSending{false};
+  std::deque<PendingCall> m_pendingCalls;
+
+  // Keeps completions in call order when replies arrive on several threads.
+  std::mutex m_deliveryMutex;
+};
+
+} // namespace react::uwp
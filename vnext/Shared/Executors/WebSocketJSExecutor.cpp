@@ -33,7 +33,9 @@ WebSocketJSExecutor::WebSocketJSExecutor(
     : m_delegate(delegate),
       m_messageQueueThread(messageQueueThread),
       m_socket(),
-      m_socketDataWriter(m_socket.OutputStream()) {
+      m_socketDataWriter(m_socket.OutputStream()),
+      m_pipeline(std::make_shared<WebSocketCallPipeline>(
+          [this](std::vector<std::string> &&messages) { WriteMessagesAsync(std::move(messages)); })) {
   m_msgReceived = m_socket.MessageReceived(winrt::auto_revoke, [this](auto &&, auto &&args) {
     try {
       std::string response;
@@ -67,6 +69,8 @@ WebSocketJSExecutor::WebSocketJSExecutor(
 WebSocketJSExecutor::~WebSocketJSExecutor() {
   m_closed.revoke();
   m_msgReceived.revoke();
+  m_pipeline->Reset();
+  m_lifetimeToken.reset();
 }
 
 void WebSocketJSExecutor::initializeRuntime() {
@@ -101,27 +105,18 @@ void WebSocketJSExecutor::registerBundle(uint32_t bundleId, const std::string &b
 }
 
 void WebSocketJSExecutor::flush() {
-  folly::dynamic jarray = folly::dynamic::array();
-  auto calls = Call("flushedQueue", jarray);
-  if (m_delegate && !IsInError())
-    m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+  CallAsync("flushedQueue", folly::dynamic::array());
 }
 
 void WebSocketJSExecutor::callFunction(
     const std::string &moduleId,
     const std::string &methodId,
     const folly::dynamic &arguments) {
-  folly::dynamic jarray = folly::dynamic::array(moduleId, methodId, arguments);
-  auto calls = Call("callFunctionReturnFlushedQueue", jarray);
-  if (m_delegate && !IsInError())
-    m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+  CallAsync("callFunctionReturnFlushedQueue", folly::dynamic::array(moduleId, methodId, arguments));
 }
 
 void WebSocketJSExecutor::invokeCallback(const double callbackId, const folly::dynamic &arguments) {
-  folly::dynamic jarray = folly::dynamic::array(callbackId, arguments);
-  auto calls = Call("invokeCallbackAndReturnFlushedQueue", jarray);
-  if (m_delegate && !IsInError())
-    m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+  CallAsync("invokeCallbackAndReturnFlushedQueue", folly::dynamic::array(callbackId, arguments));
 }
 
 void WebSocketJSExecutor::setGlobalVariable(
@@ -146,30 +141,46 @@ void WebSocketJSExecutor::destroy() {
   if (State::Connected == m_state || State::Running == m_state)
     m_socket.Close();
 
+  m_pipeline->Reset();
   SetState(State::Disposed);
 }
 
-std::string WebSocketJSExecutor::Call(const std::string &methodName, folly::dynamic &arguments) {
+// Calls are made on the message queue thread, so request ids follow the call
+// order. The results are posted back to that thread in the same order.
+void WebSocketJSExecutor::CallAsync(const std::string &methodName, folly::dynamic &&arguments) {
   int requestId = ++m_requestId;
 
   if (!IsRunning()) {
     OnHitError("Executor instance not connected to a WebSocket endpoint.");
-    return std::string();
+    return;
   }
 
   try {
     folly::dynamic request =
         folly::dynamic::object("id", requestId)("method", methodName)("arguments", std::move(arguments));
-    std::string str = folly::toJson(request);
-    std::string strReturn = SendMessageAsync(requestId, str).get();
-    return strReturn;
+    m_pipeline->Call(
+        requestId,
+        folly::toJson(request),
+        [this, weakToken = std::weak_ptr<int>(m_lifetimeToken), queue = m_messageQueueThread](std::string &&calls) {
+          queue->runOnQueue([this, weakToken, calls = std::move(calls)]() mutable {
+            if (weakToken.expired() || !m_delegate || IsInError())
+              return;
+
+            try {
+              m_delegate->callNativeModules(*this, folly::parseJson(std::move(calls)), true);
+            } catch (const std::exception &e) {
+              OnHitError(e.what());
+            }
+          });
+        });
   } catch (const std::exception &e) {
     OnHitError(e.what());
-    return std::string();
   }
 }
 
 void WebSocketJSExecutor::OnHitError(std::string message) {
+  // The results of the calls made before the error are not delivered.
+  m_pipeline->Reset();
   if (m_errorCallback != nullptr)
     m_errorCallback(message);
   SetState(State::Error);
@@ -242,13 +253,9 @@ std::future<std::string> WebSocketJSExecutor::SendMessageAsync(int requestId, co
   auto future = it->second.get_future();
 
   if (!IsDisposed()) {
-    m_socket.Control().MessageType(winrt::Windows::Networking::Sockets::SocketMessageType::Utf8);
-
-    winrt::array_view<const uint8_t> arr(
-        Microsoft::Common::Utilities::CheckedReinterpretCast<const uint8_t *>(message.c_str()),
-        Microsoft::Common::Utilities::CheckedReinterpretCast<const uint8_t *>(message.c_str()) + message.length());
-    m_socketDataWriter.WriteBytes(arr);
-    m_socketDataWriter.StoreAsync();
+    // Goes through the pipeline so that it is not written in the middle of
+    // a batch of calls.
+    m_pipeline->Send(std::string(message));
   } else {
     // Disposed, immediately return empty
     auto promise(std::move(it->second));
@@ -260,26 +267,72 @@ std::future<std::string> WebSocketJSExecutor::SendMessageAsync(int requestId, co
   return future;
 }
 
+// Each message is written as its own WebSocket message, since the debugger
+// proxy reads one request per message. Messages queued while a batch is
+// written are written in the next batch, without waiting for replies.
+winrt::fire_and_forget WebSocketJSExecutor::WriteMessagesAsync(std::vector<std::string> messages) {
+  // Copied before the first suspension, so that the writes do not depend on
+  // the lifetime of the executor.
+  auto socket = m_socket;
+  auto writer = m_socketDataWriter;
+  auto pipeline = m_pipeline;
+  auto queue = m_messageQueueThread;
+  std::weak_ptr<int> weakToken = m_lifetimeToken;
+
+  try {
+    socket.Control().MessageType(winrt::Windows::Networking::Sockets::SocketMessageType::Utf8);
+
+    while (!messages.empty()) {
+      for (const auto &message : messages) {
+        winrt::array_view<const uint8_t> arr(
+            Microsoft::Common::Utilities::CheckedReinterpretCast<const uint8_t *>(message.c_str()),
+            Microsoft::Common::Utilities::CheckedReinterpretCast<const uint8_t *>(message.c_str()) + message.length());
+        writer.WriteBytes(arr);
+        co_await writer.StoreAsync();
+      }
+
+      messages = pipeline->OnBatchSent();
+    }
+  } catch (winrt::hresult_error const &e) {
+    // Lets later messages be written, e.g. when the runtime is prepared again.
+    pipeline->OnBatchFailed();
+    auto message = Microsoft::Common::Unicode::Utf16ToUtf8(e.message().c_str(), e.message().size());
+    queue->runOnQueue([this, weakToken, message = std::move(message)]() {
+      if (!weakToken.expired())
+        OnHitError(message);
+    });
+  }
+}
+
 void WebSocketJSExecutor::OnMessageReceived(const std::string &msg) {
   folly::dynamic parsed = folly::parseJson(msg);
   auto it_parsed = parsed.find("replyID");
   if (it_parsed != parsed.items().end()) {
     int replyId = it_parsed->second.asInt();
 
-    std::lock_guard<std::mutex> lock(m_lockPromises);
-    auto it_promise = m_promises.find(replyId);
-    if (it_promise != m_promises.end()) {
-      auto promise(std::move(it_promise->second));
-      m_promises.erase(it_promise);
+    auto it_error = parsed.find("error");
+    if (it_error != parsed.items().end() && it_error->second.isString()) {
+      OnHitError(it_error->second.asString());
+    }
 
-      it_parsed = parsed.find("result");
-      if (it_parsed != parsed.items().end() && it_parsed->second.isString()) {
-        std::string result = it_parsed->second.asString();
-        promise.set_value(result);
-      } else {
-        promise.set_value("");
+    std::string result;
+    it_parsed = parsed.find("result");
+    if (it_parsed != parsed.items().end() && it_parsed->second.isString()) {
+      result = it_parsed->second.asString();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_lockPromises);
+      auto it_promise = m_promises.find(replyId);
+      if (it_promise != m_promises.end()) {
+        auto promise(std::move(it_promise->second));
+        m_promises.erase(it_promise);
+        promise.set_value(std::move(result));
+        return;
       }
     }
+
+    m_pipeline->OnReply(replyId, std::move(result));
   }
 }
 
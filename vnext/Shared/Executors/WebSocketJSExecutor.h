@@ -12,6 +12,7 @@
 #pragma warning(pop)
 
 #include <WebSocketJSExecutorFactory.h>
+#include "WebSocketCallPipeline.h"
 
 #include <memory>
 #include <unordered_map>
@@ -71,8 +72,9 @@ class WebSocketJSExecutor : public facebook::react::JSExecutor {
  private:
   bool PrepareJavaScriptRuntime(int milliseconds);
   void PollPrepareJavaScriptRuntime();
-  std::string Call(const std::string &methodName, folly::dynamic &arguments);
+  void CallAsync(const std::string &methodName, folly::dynamic &&arguments);
   std::future<std::string> SendMessageAsync(int requestId, const std::string &message);
+  winrt::fire_and_forget WriteMessagesAsync(std::vector<std::string> messages);
   void OnMessageReceived(const std::string &msg);
   void flush();
 
@@ -115,6 +117,14 @@ class WebSocketJSExecutor : public facebook::react::JSExecutor {
   std::mutex m_lockPromises;
   std::unordered_map<int, std::promise<std::string>> m_promises;
 
+  // Calls are pipelined: they do not wait for the reply of the previous call,
+  // and their results are passed to callNativeModules in call order.
+  std::shared_ptr<WebSocketCallPipeline> m_pipeline;
+
+  // Expires when the executor is destroyed, so that results and errors
+  // posted to the message queue thread are dropped.
+  std::shared_ptr<int> m_lifetimeToken{std::make_shared<int>(0)};
+
   State m_state = State::Disconnected;
   std::function<void(std::string)> m_errorCallback;
   std::function<void()> m_debuggerAttachCallback;
@@ -47,6 +47,14 @@ struct INativeUIManager {
       facebook::react::ShadowNode &childShadowNode,
       uint64_t index) = 0;
   virtual void RemoveView(facebook::react::ShadowNode &shadowNode, bool removeChildren = true) = 0;
+  // Removes the views of a dropped subtree. The subtree root comes first in
+  // nodes, and its native children are removed only if removeChildren is true.
+  // The other nodes are dropped with it, so their children are not removed.
+  virtual void RemoveViews(const std::vector<facebook::react::ShadowNode *> &nodes, bool removeChildren) = 0;
+  // Called before a deleted view is removed from its parent. Returns true if
+  // the native view stays in its parent until its layout animation has ended.
+  // The native children of the view must then be kept as well.
+  virtual bool DeferRemoveView(facebook::react::ShadowNode &shadowNode) = 0;
   virtual void ReplaceView(facebook::react::ShadowNode &shadowNode) = 0;
   virtual void UpdateView(facebook::react::ShadowNode &shadowNode, folly::dynamic /*ReadableMap*/ props) = 0;
   virtual void onBatchComplete() = 0;
@@ -28,6 +28,7 @@ class IUIManager {
 
   virtual folly::dynamic getConstantsForViewManager(const std::string &viewManager) = 0;
   virtual void populateViewManagerConstants(std::map<std::string, folly::dynamic> &constants) = 0;
+  virtual folly::dynamic getViewManagerNames() = 0;
   virtual void createView(int64_t tag, std::string &&className, int64_t rootViewTag, folly::dynamic &&props) = 0;
   virtual void configureNextLayoutAnimation(
       folly::dynamic &&config,
@@ -76,6 +77,13 @@ std::unique_ptr<facebook::xplat::module::CxxModule> createUIManagerModule(
     std::shared_ptr<IUIManager> &&uimanager,
     std::shared_ptr<MessageQueueThread> &&uiQueue) noexcept;
 
+// With lazyViewManagerConstants the module constants only list the view manager names,
+// and JavaScript requests the constants of a view manager when it is first used.
+std::unique_ptr<facebook::xplat::module::CxxModule> createUIManagerModule(
+    std::shared_ptr<IUIManager> &&uimanager,
+    std::shared_ptr<MessageQueueThread> &&uiQueue,
+    bool lazyViewManagerConstants) noexcept;
+
 // Deprecated: use the overloaded version with two parameters.
 // It is here because it is being exported
 std::unique_ptr<facebook::xplat::module::CxxModule> createUIManagerModule(std::shared_ptr<IUIManager> uimanager);
@@ -0,0 +1,263 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "LayoutAnimationPlanner.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr std::array<float, 4> c_linearControlPoints{0.0f, 0.0f, 1.0f, 1.0f};
+constexpr std::array<float, 4> c_easeInControlPoints{0.42f, 0.0f, 1.0f, 1.0f};
+constexpr std::array<float, 4> c_easeOutControlPoints{0.0f, 0.0f, 0.58f, 1.0f};
+constexpr std::array<float, 4> c_easeInEaseOutControlPoints{0.42f, 0.0f, 0.58f, 1.0f};
+// Approximates the curve iOS uses to animate the keyboard.
+constexpr std::array<float, 4> c_keyboardControlPoints{0.17f, 0.59f, 0.4f, 0.77f};
+
+constexpr size_t c_springKeyFrameCount = 60;
+constexpr float c_minSpringDamping = 0.1f;
+// The spring is considered settled when its amplitude drops below this ratio.
+constexpr float c_springSettleThreshold = 0.001f;
+
+// Samples a spring going from 0 to 1 over a normalized duration of 1. The
+// stiffness is chosen so that the spring settles at the end of the duration.
+std::vector<LayoutTransitionKeyFrame> SampleSpring(float damping, float initialVelocity) {
+  const float zeta = std::clamp(damping, c_minSpringDamping, 1.0f);
+  const float omega = -std::log(c_springSettleThreshold) / zeta;
+
+  std::vector<LayoutTransitionKeyFrame> keyFrames;
+  keyFrames.reserve(c_springKeyFrameCount);
+  for (size_t i = 1; i < c_springKeyFrameCount; ++i) {
+    const float t = static_cast<float>(i) / c_springKeyFrameCount;
+    float displacement;
+    if (zeta < 1.0f) {
+      const float omegaD = omega * std::sqrt(1.0f - zeta * zeta);
+      const float b = (initialVelocity - zeta * omega) / omegaD;
+      displacement = std::exp(-zeta * omega * t) * (-std::cos(omegaD * t) + b * std::sin(omegaD * t));
+    } else {
+      displacement = std::exp(-omega * t) * (-1.0f + (initialVelocity - omega) * t);
+    }
+
+    keyFrames.push_back({t, 1.0f + displacement});
+  }
+
+  keyFrames.push_back({1.0f, 1.0f});
+  return keyFrames;
+}
+
+void AddAppearanceChannels(
+    LayoutAnimation::AnimatableProperty animatedProp,
+    float from,
+    float to,
+    std::vector<LayoutTransitionChannel> &channels) {
+  switch (animatedProp) {
+    case LayoutAnimation::AnimatableProperty::ScaleX:
+      channels.push_back({LayoutTransitionProperty::ScaleX, from, to});
+      break;
+    case LayoutAnimation::AnimatableProperty::ScaleY:
+      channels.push_back({LayoutTransitionProperty::ScaleY, from, to});
+      break;
+    case LayoutAnimation::AnimatableProperty::ScaleXY:
+      channels.push_back({LayoutTransitionProperty::ScaleX, from, to});
+      channels.push_back({LayoutTransitionProperty::ScaleY, from, to});
+      break;
+    case LayoutAnimation::AnimatableProperty::Opacity:
+    case LayoutAnimation::AnimatableProperty::None:
+    default:
+      // Views without an animated property fade in and out.
+      channels.push_back({LayoutTransitionProperty::Opacity, from, to});
+      break;
+  }
+}
+
+void AddFrameChannel(
+    LayoutTransitionProperty property,
+    float from,
+    float to,
+    std::vector<LayoutTransitionChannel> &channels) {
+  if (from != to) {
+    channels.push_back({property, from, to});
+  }
+}
+
+} // namespace
+
+bool LayoutFrame::operator==(const LayoutFrame &other) const noexcept {
+  return left == other.left && top == other.top && width == other.width && height == other.height;
+}
+
+bool LayoutFrame::operator!=(const LayoutFrame &other) const noexcept {
+  return !(*this == other);
+}
+
+void LayoutAnimationPlanner::UpdateNodeLayout(int64_t tag, int64_t parentTag, const LayoutFrame &frame) {
+  auto it = m_frames.find(tag);
+  if (it == m_frames.end()) {
+    m_frames.emplace(tag, frame);
+    m_changes[tag] = PendingChange{LayoutChange::Created, parentTag, frame, frame};
+    return;
+  }
+
+  if (it->second == frame) {
+    return;
+  }
+
+  auto changeIt = m_changes.find(tag);
+  if (changeIt != m_changes.end()) {
+    // Several layout passes may run before the next plan. Keep the first
+    // origin and the latest destination.
+    changeIt->second.to = frame;
+    changeIt->second.parentTag = parentTag;
+  } else {
+    m_changes[tag] = PendingChange{LayoutChange::Updated, parentTag, it->second, frame};
+  }
+
+  it->second = frame;
+}
+
+void LayoutAnimationPlanner::AddNodeFrame(int64_t tag, const LayoutFrame &frame) {
+  m_frames.emplace(tag, frame);
+}
+
+bool LayoutAnimationPlanner::DeleteNode(int64_t tag) {
+  auto it = m_frames.find(tag);
+  if (it == m_frames.end()) {
+    return false;
+  }
+
+  const LayoutFrame frame = it->second;
+  m_frames.erase(it);
+
+  auto changeIt = m_changes.find(tag);
+  if (changeIt != m_changes.end() && changeIt->second.change == LayoutChange::Created) {
+    // The node was never shown with an animation, so it disappears right away.
+    m_changes.erase(changeIt);
+    return false;
+  }
+
+  m_changes[tag] = PendingChange{LayoutChange::Deleted, -1, frame, frame};
+  return true;
+}
+
+void LayoutAnimationPlanner::RemoveNode(int64_t tag) noexcept {
+  m_frames.erase(tag);
+
+  auto changeIt = m_changes.find(tag);
+  if (changeIt != m_changes.end() && changeIt->second.change != LayoutChange::Deleted) {
+    m_changes.erase(changeIt);
+  }
+}
+
+std::vector<LayoutTransition> LayoutAnimationPlanner::PlanTransitions(
+    const LayoutAnimation::LayoutAnimations &animations) {
+  std::vector<LayoutTransition> transitions;
+  transitions.reserve(m_changes.size());
+
+  for (const auto &tagAndChange : m_changes) {
+    const int64_t tag = tagAndChange.first;
+    const PendingChange &change = tagAndChange.second;
+
+    const LayoutAnimation::LayoutAnimationProperties *props = nullptr;
+    switch (change.change) {
+      case LayoutChange::Created: {
+        auto parentIt = m_changes.find(change.parentTag);
+        if (parentIt != m_changes.end() && parentIt->second.change == LayoutChange::Created) {
+          // The parent animates the whole created subtree.
+          continue;
+        }
+
+        props = &animations.createAnimationProps;
+        break;
+      }
+      case LayoutChange::Updated:
+        props = &animations.updateAnimationProps;
+        break;
+      case LayoutChange::Deleted:
+        props = &animations.deleteAnimationProps;
+        break;
+    }
+
+    if (props->animationType == LayoutAnimation::AnimationType::None) {
+      continue;
+    }
+
+    LayoutTransition transition{tag, change.change, props->animationType, props->duration, props->delay};
+    transition.timing = TimingFor(*props);
+    transition.frame = change.to;
+
+    switch (change.change) {
+      case LayoutChange::Created:
+        AddAppearanceChannels(props->animatedProp, 0.0f, 1.0f, transition.channels);
+        break;
+      case LayoutChange::Deleted:
+        AddAppearanceChannels(props->animatedProp, 1.0f, 0.0f, transition.channels);
+        break;
+      case LayoutChange::Updated:
+        AddFrameChannel(LayoutTransitionProperty::Left, change.from.left, change.to.left, transition.channels);
+        AddFrameChannel(LayoutTransitionProperty::Top, change.from.top, change.to.top, transition.channels);
+        AddFrameChannel(LayoutTransitionProperty::Width, change.from.width, change.to.width, transition.channels);
+        AddFrameChannel(LayoutTransitionProperty::Height, change.from.height, change.to.height, transition.channels);
+        break;
+    }
+
+    if (!transition.channels.empty()) {
+      transitions.push_back(std::move(transition));
+    }
+  }
+
+  m_changes.clear();
+  return transitions;
+}
+
+void LayoutAnimationPlanner::DiscardChanges() noexcept {
+  m_changes.clear();
+}
+
+void LayoutAnimationPlanner::Clear() noexcept {
+  m_frames.clear();
+  m_changes.clear();
+}
+
+bool LayoutAnimationPlanner::HasChanges() const noexcept {
+  return !m_changes.empty();
+}
+
+/*static*/ LayoutTransitionTiming LayoutAnimationPlanner::TimingFor(
+    const LayoutAnimation::LayoutAnimationProperties &props) {
+  LayoutTransitionTiming timing;
+  switch (props.animationType) {
+    case LayoutAnimation::AnimationType::EaseIn:
+      timing.controlPoints = c_easeInControlPoints;
+      break;
+    case LayoutAnimation::AnimationType::EaseOut:
+      timing.controlPoints = c_easeOutControlPoints;
+      break;
+    case LayoutAnimation::AnimationType::EaseInEaseOut:
+      timing.controlPoints = c_easeInEaseOutControlPoints;
+      break;
+    case LayoutAnimation::AnimationType::Keyboard:
+      timing.controlPoints = c_keyboardControlPoints;
+      break;
+    case LayoutAnimation::AnimationType::Spring: {
+      // The initial velocity is relative to the whole distance per second.
+      const float initialVelocity = props.springAnimationProperties.initialVelocity * props.duration / 1000.0f;
+      timing.kind = LayoutTransitionTiming::Kind::KeyFrames;
+      timing.keyFrames = SampleSpring(props.springAnimationProperties.springDamping, initialVelocity);
+      break;
+    }
+    case LayoutAnimation::AnimationType::Linear:
+    case LayoutAnimation::AnimationType::None:
+    default:
+      timing.controlPoints = c_linearControlPoints;
+      break;
+  }
+
+  return timing;
+}
+
+} // namespace react
+} // namespace facebook
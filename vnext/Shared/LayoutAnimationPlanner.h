@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "LayoutAnimation.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Position and size of a node as computed by Yoga, relative to its parent.
+struct LayoutFrame {
+  float left = 0.0f;
+  float top = 0.0f;
+  float width = 0.0f;
+  float height = 0.0f;
+
+  bool operator==(const LayoutFrame &other) const noexcept;
+  bool operator!=(const LayoutFrame &other) const noexcept;
+};
+
+enum class LayoutChange {
+  Created,
+  Updated,
+  Deleted,
+};
+
+enum class LayoutTransitionProperty {
+  Left,
+  Top,
+  Width,
+  Height,
+  Opacity,
+  ScaleX,
+  ScaleY,
+};
+
+// Animated value of one property. The value moves from 'from' to 'to' following
+// the timing of the transition that owns the channel.
+struct LayoutTransitionChannel {
+  LayoutTransitionProperty property;
+  float from;
+  float to;
+};
+
+// A key frame maps the normalized time of a transition to its normalized
+// progress. Progress may overshoot 1.0 for spring animations.
+struct LayoutTransitionKeyFrame {
+  float time;
+  float progress;
+};
+
+// Describes how the progress of a transition evolves over time. Bezier curves
+// map directly to platform easing functions. Springs have no common platform
+// representation, so they are sampled into key frames.
+struct LayoutTransitionTiming {
+  enum class Kind {
+    CubicBezier,
+    KeyFrames,
+  };
+
+  Kind kind = Kind::CubicBezier;
+  std::array<float, 4> controlPoints{0.0f, 0.0f, 1.0f, 1.0f}; // x1, y1, x2, y2
+  std::vector<LayoutTransitionKeyFrame> keyFrames;
+};
+
+// Animation that a platform must run for one node after a layout pass.
+struct LayoutTransition {
+  int64_t tag;
+  LayoutChange change;
+  LayoutAnimation::AnimationType animationType;
+  float duration; // ms
+  float delay; // ms
+  LayoutTransitionTiming timing;
+
+  // Final frame of a created or updated node, last known frame of a deleted node.
+  LayoutFrame frame;
+  std::vector<LayoutTransitionChannel> channels;
+};
+
+// Diffs the results of consecutive layout passes and turns the differences
+// into transitions for the current LayoutAnimation configuration. It has no
+// platform dependencies: the UI manager reports the frames computed by Yoga and
+// deleted nodes, and applies the returned transitions.
+class LayoutAnimationPlanner {
+ public:
+  // Records the frame of a node that has a new layout. A node without a
+  // previous frame is created, otherwise it is updated if the frame changed.
+  // Only the root of a created subtree is animated, so the parent tag is used
+  // to skip nodes whose parent is created in the same plan.
+  void UpdateNodeLayout(int64_t tag, int64_t parentTag, const LayoutFrame &frame);
+
+  // Records the current frame of a node that was laid out before the planner
+  // started tracking it. The frame is the origin of the next changes of the
+  // node. Does nothing if the node already has a frame.
+  void AddNodeFrame(int64_t tag, const LayoutFrame &frame);
+
+  // Marks a node as deleted so that its removal can be animated. Returns false
+  // if the node was never laid out or was created since the last plan, in
+  // which case there is nothing to animate and the node is simply forgotten.
+  bool DeleteNode(int64_t tag);
+
+  // Forgets a node that is removed without animation.
+  void RemoveNode(int64_t tag) noexcept;
+
+  // Returns the transitions for all changes recorded since the previous call
+  // to PlanTransitions or DiscardChanges. Changes whose animation type is None
+  // produce no transition.
+  std::vector<LayoutTransition> PlanTransitions(const LayoutAnimation::LayoutAnimations &animations);
+
+  // Drops the changes recorded so far, e.g. when no layout animation is configured.
+  void DiscardChanges() noexcept;
+
+  // Forgets all frames and changes, e.g. once the planned transitions started.
+  void Clear() noexcept;
+
+  bool HasChanges() const noexcept;
+
+  static LayoutTransitionTiming TimingFor(const LayoutAnimation::LayoutAnimationProperties &props);
+
+ private:
+  struct PendingChange {
+    LayoutChange change;
+    int64_t parentTag;
+    LayoutFrame from;
+    LayoutFrame to;
+  };
+
+ private:
+  std::unordered_map<int64_t, LayoutFrame> m_frames;
+  std::unordered_map<int64_t, PendingChange> m_changes;
+};
+
+} // namespace react
+} // namespace facebook
@@ -34,7 +34,7 @@ std::vector<facebook::xplat::module::CxxModule::Method> AsyncStorageModule::getM
                                    // Callback(error, returnValue)
           {
             m_asyncStorageManager->executeKVOperation(
-                AsyncStorageManager::AsyncStorageOperation::multiGet, args, jsCallback);
+                AsyncStorageManager::AsyncStorageOperation::multiGet, std::move(args), std::move(jsCallback));
           }),
 
       Method(
@@ -45,7 +45,7 @@ std::vector<facebook::xplat::module::CxxModule::Method> AsyncStorageModule::getM
                                    // KeyValuePairs , Callback(error)
           {
             m_asyncStorageManager->executeKVOperation(
-                AsyncStorageManager::AsyncStorageOperation::multiSet, args, jsCallback);
+                AsyncStorageManager::AsyncStorageOperation::multiSet, std::move(args), std::move(jsCallback));
           }),
 
       // The 'multiMerge' method is currently not implemented. We assume that
@@ -59,7 +59,7 @@ std::vector<facebook::xplat::module::CxxModule::Method> AsyncStorageModule::getM
                                                     // Keys , Callback(error)
           {
             m_asyncStorageManager->executeKVOperation(
-                AsyncStorageManager::AsyncStorageOperation::multiRemove, args, jsCallback);
+                AsyncStorageManager::AsyncStorageOperation::multiRemove, std::move(args), std::move(jsCallback));
           }),
 
       Method(
@@ -69,7 +69,7 @@ std::vector<facebook::xplat::module::CxxModule::Method> AsyncStorageModule::getM
               Callback jsCallback) // params - args is unused , Callback(error)
           {
             m_asyncStorageManager->executeKVOperation(
-                AsyncStorageManager::AsyncStorageOperation::clear, args, jsCallback);
+                AsyncStorageManager::AsyncStorageOperation::clear, std::move(args), std::move(jsCallback));
           }),
 
       Method(
@@ -78,7 +78,7 @@ std::vector<facebook::xplat::module::CxxModule::Method> AsyncStorageModule::getM
                                                     // Callback(error, returnValue)
           {
             m_asyncStorageManager->executeKVOperation(
-                AsyncStorageManager::AsyncStorageOperation::getAllKeys, args, jsCallback);
+                AsyncStorageManager::AsyncStorageOperation::getAllKeys, std::move(args), std::move(jsCallback));
           }),
   };
 }
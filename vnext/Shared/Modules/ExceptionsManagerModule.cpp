@@ -2,9 +2,11 @@
 // Licensed under the MIT License.
 
 #include "ExceptionsManagerModule.h"
+#include <DelayedTaskScheduler.h>
 #include <assert.h>
 #include <cxxreact/JsArgumentHelpers.h>
 #include <sstream>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
@@ -142,10 +144,141 @@ Mso::React::ErrorInfo CreateErrorInfo2(const folly::dynamic &args) noexcept {
   return errorInfo;
 }
 
+std::string CreateFingerprint(const std::string &message, const folly::dynamic *stack, size_t frameCount) noexcept {
+  ErrorFingerprint fingerprint{message, frameCount};
+  if (stack && stack->isArray()) {
+    for (const auto &stackFrame : *stack) {
+      if (stackFrame.isObject() &&
+          !fingerprint.AddFrame(
+              RetrieveOptionalStringFromMap(stackFrame, "file"),
+              RetrieveOptionalStringFromMap(stackFrame, "methodName"),
+              RetrieveIntFromMap(stackFrame, "lineNumber"),
+              RetrieveIntFromMap(stackFrame, "column"))) {
+        break;
+      }
+    }
+  }
+
+  return fingerprint.Value();
+}
+
+int64_t ToUnixTimeMilliseconds(SoftExceptionLimiter::Clock::time_point time) noexcept {
+  auto systemTime = std::chrono::system_clock::now() +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(time - SoftExceptionLimiter::Clock::now());
+  return std::chrono::duration_cast<std::chrono::milliseconds>(systemTime.time_since_epoch()).count();
+}
+
 } // namespace
 
-ExceptionsManagerModule::ExceptionsManagerModule(std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler)
-    : m_redboxHandler(std::move(redboxHandler)) {}
+// Forwards soft exceptions to the redbox handler through a SoftExceptionLimiter,
+// and reports the summaries of the suppressed ones. It is only used on the
+// native queue.
+class ExceptionsManagerModule::SoftExceptionReporter
+    : public std::enable_shared_from_this<ExceptionsManagerModule::SoftExceptionReporter> {
+ public:
+  SoftExceptionReporter(
+      std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler,
+      std::shared_ptr<MessageQueueThread> nativeQueue,
+      const SoftExceptionLimits &limits) noexcept
+      : m_redboxHandler{std::move(redboxHandler)}, m_nativeQueue{std::move(nativeQueue)}, m_limiter{limits} {}
+
+  // The error info is only created for the reports that are forwarded or
+  // summarized.
+  template <class TCreateErrorInfo>
+  void Report(const std::string &message, const folly::dynamic *stack, TCreateErrorInfo &&createErrorInfo) {
+    auto now = SoftExceptionLimiter::Clock::now();
+    ReportDueSummaries(now);
+
+    std::string fingerprint = CreateFingerprint(message, stack, m_limiter.Limits().FingerprintFrameCount);
+    switch (m_limiter.OnReport(fingerprint, /*isFatal:*/ false, now)) {
+      case SoftExceptionLimiter::Action::Forward:
+        m_redboxHandler->showNewError(createErrorInfo(), Mso::React::ErrorType::JSSoft);
+        break;
+      case SoftExceptionLimiter::Action::StartSummary:
+        // Reports of untracked errors are summarized with the first of them.
+        m_summaryErrorInfos[m_limiter.IsTracked(fingerprint) ? fingerprint : std::string{}] = createErrorInfo();
+        ScheduleSummaries();
+        break;
+      case SoftExceptionLimiter::Action::Count:
+        break;
+    }
+  }
+
+ private:
+  void ReportDueSummaries(SoftExceptionLimiter::Clock::time_point now) {
+    for (auto &summary : m_limiter.TakeDueSummaries(now)) {
+      auto it = m_summaryErrorInfos.find(summary.Fingerprint);
+      if (it == m_summaryErrorInfos.end()) {
+        continue;
+      }
+
+      Mso::React::ErrorInfo errorInfo = std::move(it->second);
+      m_summaryErrorInfos.erase(it);
+
+      std::ostringstream suffix;
+      suffix << "\n\n(" << summary.Count
+             << (summary.Fingerprint.empty() ? " reports of this and other errors were suppressed)"
+                                             : " more reports of this error were suppressed)");
+      errorInfo.Message += suffix.str();
+
+      if (!errorInfo.ExtraData.isObject()) {
+        errorInfo.ExtraData = folly::dynamic::object();
+      }
+      errorInfo.ExtraData["suppressedCount"] = summary.Count;
+      errorInfo.ExtraData["firstSuppressedTime"] = ToUnixTimeMilliseconds(summary.FirstReportTime);
+      errorInfo.ExtraData["lastSuppressedTime"] = ToUnixTimeMilliseconds(summary.LastReportTime);
+
+      // The summaries that are due while dev support is disabled are dropped.
+      if (m_redboxHandler->isDevSupportEnabled()) {
+        m_redboxHandler->showNewError(std::move(errorInfo), Mso::React::ErrorType::JSSoft);
+      }
+    }
+  }
+
+  // Summaries become due in the order in which they start, so one scheduled
+  // task at a time is enough.
+  void ScheduleSummaries() {
+    if (!m_nativeQueue || m_isSummaryTaskScheduled || !m_limiter.HasPendingSummary()) {
+      return;
+    }
+
+    if (!m_scheduler) {
+      m_scheduler = std::make_unique<DelayedTaskScheduler<SoftExceptionLimiter::Clock>>(
+          [nativeQueue = m_nativeQueue](std::function<void()> &&task) { nativeQueue->runOnQueue(std::move(task)); });
+    }
+
+    m_isSummaryTaskScheduled = true;
+    m_scheduler->PostTaskAt(
+        [weakThis = weak_from_this()]() {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->m_isSummaryTaskScheduled = false;
+            strongThis->ReportDueSummaries(SoftExceptionLimiter::Clock::now());
+            strongThis->ScheduleSummaries();
+          }
+        },
+        m_limiter.NextSummaryTime());
+  }
+
+ private:
+  const std::shared_ptr<Mso::React::IRedBoxHandler> m_redboxHandler;
+  const std::shared_ptr<MessageQueueThread> m_nativeQueue;
+  SoftExceptionLimiter m_limiter;
+  // The first suppressed report of each pending summary.
+  std::unordered_map<std::string, Mso::React::ErrorInfo> m_summaryErrorInfos;
+  std::unique_ptr<DelayedTaskScheduler<SoftExceptionLimiter::Clock>> m_scheduler;
+  bool m_isSummaryTaskScheduled{false};
+};
+
+ExceptionsManagerModule::ExceptionsManagerModule(
+    std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler,
+    std::shared_ptr<MessageQueueThread> nativeQueue,
+    const SoftExceptionLimits &softExceptionLimits)
+    : m_redboxHandler(std::move(redboxHandler)) {
+  if (m_redboxHandler) {
+    m_softExceptionReporter =
+        std::make_shared<SoftExceptionReporter>(m_redboxHandler, std::move(nativeQueue), softExceptionLimits);
+  }
+}
 
 std::string ExceptionsManagerModule::getName() {
   return name;
@@ -157,6 +290,7 @@ std::map<std::string, folly::dynamic> ExceptionsManagerModule::getConstants() {
 
 std::vector<facebook::xplat::module::CxxModule::Method> ExceptionsManagerModule::getMethods() {
   auto redboxHandler = m_redboxHandler;
+  auto softExceptionReporter = m_softExceptionReporter;
   return {Method(
               "reportFatalException",
               [redboxHandler](folly::dynamic args) noexcept {
@@ -172,20 +306,29 @@ std::vector<facebook::xplat::module::CxxModule::Method> ExceptionsManagerModule:
 
           Method(
               "reportSoftException",
-              [redboxHandler](folly::dynamic args) noexcept {
+              [redboxHandler, softExceptionReporter](folly::dynamic args) noexcept {
                 if (redboxHandler && redboxHandler->isDevSupportEnabled()) {
-                  redboxHandler->showNewError(std::move(CreateErrorInfo(args)), Mso::React::ErrorType::JSSoft);
+                  softExceptionReporter->Report(
+                      facebook::xplat::jsArgAsString(args, 0), &args[1], [&args]() { return CreateErrorInfo(args); });
                 }
               }),
 
           Method(
               "reportException",
-              [redboxHandler](folly::dynamic args) noexcept {
+              [redboxHandler, softExceptionReporter](folly::dynamic args) noexcept {
                 if (redboxHandler && redboxHandler->isDevSupportEnabled()) {
-                  auto isFatal = RetrieveOptionalBoolFromMap(args[0], "isFatal");
-                  redboxHandler->showNewError(
-                      std::move(CreateErrorInfo2(args[0])),
-                      isFatal ? Mso::React::ErrorType::JSFatal : Mso::React::ErrorType::JSSoft);
+                  const folly::dynamic &exception = args[0];
+                  auto isFatal = RetrieveOptionalBoolFromMap(exception, "isFatal");
+                  if (isFatal) {
+                    // Fatal errors are never suppressed.
+                    redboxHandler->showNewError(
+                        std::move(CreateErrorInfo2(exception)), Mso::React::ErrorType::JSFatal);
+                  } else {
+                    softExceptionReporter->Report(
+                        RetrieveOptionalStringFromMap(exception, "message"),
+                        exception.get_ptr("stack"),
+                        [&exception]() { return CreateErrorInfo2(exception); });
+                  }
                 }
               }),
 
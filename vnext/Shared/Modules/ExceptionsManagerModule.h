@@ -5,9 +5,12 @@
 
 #include <DevSettings.h>
 #include <IRedBoxHandler.h>
+#include <SoftExceptionLimiter.h>
 #include <cxxreact/CxxModule.h>
+#include <cxxreact/MessageQueueThread.h>
 #include <folly/dynamic.h>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace facebook {
@@ -15,7 +18,13 @@ namespace react {
 
 class ExceptionsManagerModule : public facebook::xplat::module::CxxModule {
  public:
-  ExceptionsManagerModule(std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler);
+  // Repeated soft exceptions are summarized within softExceptionLimits. The
+  // summaries are reported on nativeQueue, the queue that runs the methods of
+  // the module. Without it, they are reported with the next soft exception.
+  ExceptionsManagerModule(
+      std::shared_ptr<Mso::React::IRedBoxHandler> redboxHandler,
+      std::shared_ptr<MessageQueueThread> nativeQueue = nullptr,
+      const SoftExceptionLimits &softExceptionLimits = {});
 
   static constexpr const char *name = "ExceptionsManager";
 
@@ -25,7 +34,10 @@ class ExceptionsManagerModule : public facebook::xplat::module::CxxModule {
   std::vector<Method> getMethods() override;
 
  private:
+  class SoftExceptionReporter;
+
   std::shared_ptr<Mso::React::IRedBoxHandler> m_redboxHandler;
+  std::shared_ptr<SoftExceptionReporter> m_softExceptionReporter;
 };
 
 } // namespace react
@@ -37,10 +37,17 @@ UIManager::~UIManager() noexcept {
 }
 
 folly::dynamic UIManager::getConstantsForViewManager(const std::string &className) {
-  const IViewManager *vm = GetViewManager(className);
-  if (vm != nullptr)
-    return vm->GetConstants();
-  return nullptr;
+  // The constants do not change, so they are built once for each view manager.
+  std::lock_guard<std::mutex> lock(m_viewManagerConstantsMutex);
+  auto it = m_viewManagerConstants.find(className);
+  if (it == m_viewManagerConstants.end()) {
+    const IViewManager *vm = GetViewManager(className);
+    if (vm == nullptr)
+      return nullptr;
+    it = m_viewManagerConstants.emplace(className, vm->GetConstants()).first;
+  }
+
+  return it->second;
 }
 
 void UIManager::populateViewManagerConstants(std::map<std::string, dynamic> &constants) {
@@ -48,6 +55,13 @@ void UIManager::populateViewManagerConstants(std::map<std::string, dynamic> &con
     constants.emplace(vm->GetName(), vm->GetConstants());
 }
 
+folly::dynamic UIManager::getViewManagerNames() {
+  folly::dynamic names = folly::dynamic::array();
+  for (auto &&vm : m_viewManagers)
+    names.push_back(vm->GetName());
+  return names;
+}
+
 IViewManager *UIManager::GetViewManager(const std::string &className) const {
   for (auto &&vm : m_viewManagers) {
     if (!strcmp(vm->GetName(), className.c_str()))
@@ -83,23 +97,37 @@ void UIManager::zombieView(int64_t tag) {
 }
 
 void UIManager::DropView(int64_t tag, bool removeChildren /*= true*/, bool zombieView /* = false */) {
-  auto &node = m_nodeRegistry.getNode(tag);
-
-  node.onDropViewInstance();
-
-  m_nativeUIManager->RemoveView(node, removeChildren);
+  // Collect the subtree with an explicit stack, so that deep trees do not
+  // overflow the call stack. The nodes are in the same pre-order as before.
+  std::vector<ShadowNode *> nodes;
+  std::vector<int64_t> tags;
+  std::vector<int64_t> pendingTags{tag};
+  while (!pendingTags.empty()) {
+    auto &node = m_nodeRegistry.getNode(pendingTags.back());
+    pendingTags.pop_back();
+    nodes.push_back(&node);
+    tags.push_back(node.m_tag);
+    pendingTags.insert(pendingTags.end(), node.m_children.rbegin(), node.m_children.rend());
+  }
 
-  if (zombieView)
-    node.m_zombie = true;
+  for (auto node : nodes) {
+    node->onDropViewInstance();
+    if (zombieView)
+      node->m_zombie = true;
+  }
 
-  for (auto childTag : node.m_children)
-    DropView(childTag, removeChildren, zombieView);
+  m_nativeUIManager->RemoveViews(nodes, removeChildren);
 
-  if (removeChildren)
-    node.removeAllChildren();
+  // The rest of the subtree is released together with its root.
+  if (removeChildren) {
+    for (auto node : nodes) {
+      if (node == nodes.front() || node->IsWindowed())
+        node->removeAllChildren();
+    }
+  }
 
   if (!zombieView)
-    m_nodeRegistry.removeNode(tag);
+    m_nodeRegistry.removeNodes(std::move(tags));
 }
 
 void UIManager::removeSubviewsFromContainerWithID(int64_t containerTag) {
@@ -211,6 +239,13 @@ void UIManager::manageChildren(
   std::sort(viewsToAdd.begin(), viewsToAdd.end(), ViewAtIndex::ViewAtIndexCompare);
   std::sort(viewsToRemove.begin(), viewsToRemove.end(), ViewAtIndex::ViewAtIndexCompare);
 
+  // A layout animation may keep deleted views on screen until it ends, so it
+  // must see them before they are removed from their parent.
+  std::vector<bool> isRemoveDeferred(numToRemove);
+  for (size_t i = 0; i < numToRemove; ++i) {
+    isRemoveDeferred[i] = m_nativeUIManager->DeferRemoveView(m_nodeRegistry.getNode(tagsToDelete[i]));
+  }
+
   // Apply changes to the ReactShadowNode hierarchy.
   for (auto i = static_cast<int>(viewsToRemove.size()) - 1; i >= 0; --i) {
     auto viewAtIndex = viewsToRemove[i];
@@ -233,8 +268,8 @@ void UIManager::manageChildren(
     m_nativeUIManager->AddView(shadowNodeToManage, shadowNodeToAdd, viewAtIndex->index);
   }
 
-  for (auto tagToDelete : tagsToDelete)
-    DropView(tagToDelete);
+  for (size_t i = 0; i < numToRemove; ++i)
+    DropView(tagsToDelete[i], !isRemoveDeferred[i]);
 }
 
 void UIManager::configureNextLayoutAnimation(
@@ -451,8 +486,11 @@ ShadowNode &UIManager::GetShadowNodeForTag(int64_t tag) {
 
 UIManagerModule::UIManagerModule(
     std::shared_ptr<IUIManager> &&manager,
-    std::shared_ptr<MessageQueueThread> &&uiQueue) noexcept
-    : m_manager{std::move(manager)}, m_uiQueue{std::move(uiQueue)} {}
+    std::shared_ptr<MessageQueueThread> &&uiQueue,
+    bool lazyViewManagerConstants) noexcept
+    : m_manager{std::move(manager)},
+      m_uiQueue{std::move(uiQueue)},
+      m_lazyViewManagerConstants{lazyViewManagerConstants} {}
 
 UIManagerModule::~UIManagerModule() noexcept {
   if (m_uiQueue) {
@@ -468,7 +506,13 @@ std::string UIManagerModule::getName() {
 std::map<std::string, folly::dynamic> UIManagerModule::getConstants() {
   std::map<std::string, folly::dynamic> constants{};
 
-  m_manager->populateViewManagerConstants(constants);
+  if (m_lazyViewManagerConstants) {
+    // JavaScript defines a lazy property for each name that calls getConstantsForViewManager.
+    constants.emplace("ViewManagerNames", m_manager->getViewManagerNames());
+    constants.emplace("LazyViewManagersEnabled", true);
+  } else {
+    m_manager->populateViewManagerConstants(constants);
+  }
 
   return constants;
 }
@@ -579,7 +623,14 @@ shared_ptr<IUIManager> createIUIManager(
 std::unique_ptr<facebook::xplat::module::CxxModule> createUIManagerModule(
     std::shared_ptr<IUIManager> &&uimanager,
     std::shared_ptr<MessageQueueThread> &&uiQueue) noexcept {
-  return std::make_unique<UIManagerModule>(std::move(uimanager), std::move(uiQueue));
+  return createUIManagerModule(std::move(uimanager), std::move(uiQueue), /*lazyViewManagerConstants:*/ false);
+}
+
+std::unique_ptr<facebook::xplat::module::CxxModule> createUIManagerModule(
+    std::shared_ptr<IUIManager> &&uimanager,
+    std::shared_ptr<MessageQueueThread> &&uiQueue,
+    bool lazyViewManagerConstants) noexcept {
+  return std::make_unique<UIManagerModule>(std::move(uimanager), std::move(uiQueue), lazyViewManagerConstants);
 }
 
 // Deprecated
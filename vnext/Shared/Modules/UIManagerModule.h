@@ -7,6 +7,8 @@
 #include <ShadowNodeRegistry.h>
 #include <ViewManager.h>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace facebook {
@@ -26,6 +28,7 @@ class UIManager : public IUIManager, INativeUIManagerHost {
   // IUIManager
   folly::dynamic getConstantsForViewManager(const std::string &className) override;
   void populateViewManagerConstants(std::map<std::string, folly::dynamic> &constants) override;
+  folly::dynamic getViewManagerNames() override;
   void configureNextLayoutAnimation(
       folly::dynamic &&config,
       facebook::xplat::module::CxxModule::Callback success,
@@ -77,6 +80,10 @@ class UIManager : public IUIManager, INativeUIManagerHost {
   ShadowNodeRegistry m_nodeRegistry;
   INativeUIManager *m_nativeUIManager;
 
+  // Constants of the view managers requested by getConstantsForViewManager.
+  std::mutex m_viewManagerConstantsMutex;
+  std::unordered_map<std::string, folly::dynamic> m_viewManagerConstants;
+
   void manageChildren(
       int64_t viewTag,
       std::vector<int64_t> &moveFrom,
@@ -94,7 +101,10 @@ class UIManager : public IUIManager, INativeUIManagerHost {
 
 class UIManagerModule : public facebook::xplat::module::CxxModule {
  public:
-  UIManagerModule(std::shared_ptr<IUIManager> &&manager, std::shared_ptr<MessageQueueThread> &&uiQueue) noexcept;
+  UIManagerModule(
+      std::shared_ptr<IUIManager> &&manager,
+      std::shared_ptr<MessageQueueThread> &&uiQueue,
+      bool lazyViewManagerConstants = false) noexcept;
   ~UIManagerModule() noexcept override;
 
   // CxxModule
@@ -105,6 +115,7 @@ class UIManagerModule : public facebook::xplat::module::CxxModule {
  private:
   std::shared_ptr<IUIManager> m_manager;
   std::shared_ptr<MessageQueueThread> m_uiQueue;
+  bool m_lazyViewManagerConstants;
 };
 
 } // namespace react
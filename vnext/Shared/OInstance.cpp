@@ -634,8 +634,10 @@ std::vector<std::unique_ptr<NativeModule>> InstanceImpl::GetDefaultNativeModules
   modules.push_back(std::make_unique<CxxNativeModule>(
       m_innerInstance,
       "ExceptionsManager",
-      [redboxHandler = m_devSettings->redboxHandler]() mutable {
-        return std::make_unique<ExceptionsManagerModule>(redboxHandler);
+      [redboxHandler = m_devSettings->redboxHandler,
+       nativeQueue,
+       softExceptionLimits = m_devSettings->softExceptionLimits]() mutable {
+        return std::make_unique<ExceptionsManagerModule>(redboxHandler, nativeQueue, softExceptionLimits);
       },
       nativeQueue));
 
@@ -26,6 +26,12 @@ struct ShadowNode {
   virtual void RemoveChildAt(int64_t indexToRemove) = 0;
   virtual void createView() = 0;
 
+  // Windowed views are shown outside of the view tree of their parent, so they must be
+  // detached on their own when their subtree is dropped.
+  virtual bool IsWindowed() {
+    return false;
+  }
+
   int64_t m_tag{0};
   std::string m_className;
   std::vector<int64_t> m_children;
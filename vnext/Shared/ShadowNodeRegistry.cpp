@@ -6,6 +6,7 @@
 #include "ViewManager.h"
 
 #include <glog/logging.h>
+#include <algorithm>
 
 namespace facebook {
 namespace react {
@@ -47,6 +48,19 @@ void ShadowNodeRegistry::removeNode(int64_t tag) {
   m_allNodes.erase(tag);
 }
 
+void ShadowNodeRegistry::removeNodes(std::vector<int64_t> &&tags) {
+  // The views of a subtree are usually created together, so most of the
+  // sorted tags follow each other in the map and need no lookup.
+  std::sort(tags.begin(), tags.end());
+  auto iter = m_allNodes.begin();
+  for (auto tag : tags) {
+    if (iter == m_allNodes.end() || iter->first != tag)
+      iter = m_allNodes.lower_bound(tag);
+    if (iter != m_allNodes.end() && iter->first == tag)
+      iter = m_allNodes.erase(iter);
+  }
+}
+
 void ShadowNodeRegistry::removeAllRootViews(const std::function<void(int64_t rootViewTag)> &fn) {
   while (!m_roots.empty())
     fn(*m_roots.begin());
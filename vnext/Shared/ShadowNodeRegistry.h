@@ -25,6 +25,7 @@ struct ShadowNodeRegistry {
   ShadowNode &getNode(int64_t tag);
   ShadowNode *findNode(int64_t tag);
   void removeNode(int64_t tag);
+  void removeNodes(std::vector<int64_t> &&tags);
 
   void removeAllRootViews(const std::function<void(int64_t rootViewTag)> &);
 
@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "SoftExceptionLimiter.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+//=============================================================================
+// ErrorFingerprint implementation
+//=============================================================================
+
+ErrorFingerprint::ErrorFingerprint(std::string_view message, size_t maxFrameCount)
+    : m_value{message}, m_remainingFrameCount{maxFrameCount} {}
+
+bool ErrorFingerprint::AddFrame(std::string_view file, std::string_view method, int line, int column) {
+  if (m_remainingFrameCount == 0) {
+    return false;
+  }
+
+  file = file.substr(0, file.find('?'));
+  size_t lastSeparator = file.find_last_of("/\\");
+  if (lastSeparator != std::string_view::npos) {
+    file.remove_prefix(lastSeparator + 1);
+  }
+
+  m_value += '\n';
+  m_value += method;
+  m_value += '@';
+  m_value += file;
+  m_value += ':';
+  m_value += std::to_string(line);
+  m_value += ':';
+  m_value += std::to_string(column);
+
+  --m_remainingFrameCount;
+  return true;
+}
+
+const std::string &ErrorFingerprint::Value() const noexcept {
+  return m_value;
+}
+
+//=============================================================================
+// SoftExceptionLimiter implementation
+//=============================================================================
+
+SoftExceptionLimiter::SoftExceptionLimiter(const SoftExceptionLimits &limits) noexcept : m_limits{limits} {}
+
+const SoftExceptionLimits &SoftExceptionLimiter::Limits() const noexcept {
+  return m_limits;
+}
+
+SoftExceptionLimiter::Action
+SoftExceptionLimiter::OnReport(const std::string &fingerprint, bool isFatal, Clock::time_point now) {
+  if (isFatal) {
+    return Action::Forward;
+  }
+
+  Entry *entry = FindOrAddEntry(fingerprint, now);
+  if (!entry) {
+    return Suppress(m_untrackedEntry, {}, now);
+  }
+
+  PruneForwardTimes(entry->ForwardTimes, now);
+  PruneForwardTimes(m_forwardTimes, now);
+
+  // Once a report of the window is counted, the later ones are counted too, so
+  // that the summary covers all of them.
+  if (entry->PendingSummary.Count > 0 || entry->ForwardTimes.size() >= m_limits.MaxReportsPerError ||
+      m_forwardTimes.size() >= m_limits.MaxReports) {
+    return Suppress(*entry, fingerprint, now);
+  }
+
+  entry->ForwardTimes.push_back(now);
+  m_forwardTimes.push_back(now);
+  return Action::Forward;
+}
+
+std::vector<SoftExceptionLimiter::Summary> SoftExceptionLimiter::TakeDueSummaries(Clock::time_point now) {
+  std::vector<Summary> summaries;
+  auto takeIfDue = [&](Summary &summary) {
+    if (summary.Count > 0 && now - summary.FirstReportTime >= m_limits.Window) {
+      summaries.push_back(std::move(summary));
+      summary = Summary{};
+    }
+  };
+
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    takeIfDue(it->second.PendingSummary);
+    if (IsIdle(it->second, now)) {
+      it = m_entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  takeIfDue(m_untrackedEntry.PendingSummary);
+  return summaries;
+}
+
+bool SoftExceptionLimiter::HasPendingSummary() const noexcept {
+  if (m_untrackedEntry.PendingSummary.Count > 0) {
+    return true;
+  }
+
+  return std::any_of(
+      m_entries.begin(), m_entries.end(), [](const auto &entry) { return entry.second.PendingSummary.Count > 0; });
+}
+
+SoftExceptionLimiter::Clock::time_point SoftExceptionLimiter::NextSummaryTime() const noexcept {
+  auto nextTime = Clock::time_point::max();
+  auto update = [&](const Summary &summary) {
+    if (summary.Count > 0) {
+      nextTime = (std::min)(nextTime, summary.FirstReportTime + m_limits.Window);
+    }
+  };
+
+  update(m_untrackedEntry.PendingSummary);
+  for (const auto &entry : m_entries) {
+    update(entry.second.PendingSummary);
+  }
+
+  return nextTime;
+}
+
+bool SoftExceptionLimiter::IsTracked(const std::string &fingerprint) const noexcept {
+  return m_entries.find(fingerprint) != m_entries.end();
+}
+
+size_t SoftExceptionLimiter::TrackedErrorCount() const noexcept {
+  return m_entries.size();
+}
+
+SoftExceptionLimiter::Entry *SoftExceptionLimiter::FindOrAddEntry(
+    const std::string &fingerprint,
+    Clock::time_point now) {
+  auto it = m_entries.find(fingerprint);
+  if (it != m_entries.end()) {
+    return &it->second;
+  }
+
+  if (m_entries.size() >= m_limits.MaxTrackedErrors) {
+    // Makes room by forgetting the errors that have nothing left to count.
+    for (auto entryIt = m_entries.begin(); entryIt != m_entries.end();) {
+      if (IsIdle(entryIt->second, now)) {
+        entryIt = m_entries.erase(entryIt);
+      } else {
+        ++entryIt;
+      }
+    }
+
+    if (m_entries.size() >= m_limits.MaxTrackedErrors) {
+      return nullptr;
+    }
+  }
+
+  return &m_entries[fingerprint];
+}
+
+SoftExceptionLimiter::Action
+SoftExceptionLimiter::Suppress(Entry &entry, const std::string &fingerprint, Clock::time_point now) {
+  Summary &summary = entry.PendingSummary;
+  summary.LastReportTime = now;
+  if (summary.Count++ == 0) {
+    summary.Fingerprint = fingerprint;
+    summary.FirstReportTime = now;
+    return Action::StartSummary;
+  }
+
+  return Action::Count;
+}
+
+void SoftExceptionLimiter::PruneForwardTimes(std::deque<Clock::time_point> &times, Clock::time_point now) const
+    noexcept {
+  while (!times.empty() && now - times.front() >= m_limits.Window) {
+    times.pop_front();
+  }
+}
+
+bool SoftExceptionLimiter::IsIdle(Entry &entry, Clock::time_point now) const noexcept {
+  PruneForwardTimes(entry.ForwardTimes, now);
+  return entry.ForwardTimes.empty() && entry.PendingSummary.Count == 0;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Identifies the reports of the same error: its message and its top stack
+// frames. Frames are normalized so that the same code location gives the same
+// fingerprint across bundle URLs: only the last path component of the file is
+// kept, without the query string.
+class ErrorFingerprint {
+ public:
+  ErrorFingerprint(std::string_view message, size_t maxFrameCount);
+
+  // Returns false, without adding the frame, once maxFrameCount frames were
+  // added.
+  bool AddFrame(std::string_view file, std::string_view method, int line, int column);
+
+  const std::string &Value() const noexcept;
+
+ private:
+  std::string m_value;
+  size_t m_remainingFrameCount;
+};
+
+struct SoftExceptionLimits {
+  // The length of the sliding window in which forwarded reports are counted,
+  // and the interval at which suppressed reports are summarized.
+  std::chrono::milliseconds Window{10000};
+
+  // The number of reports of the same error that are forwarded per window.
+  uint32_t MaxReportsPerError{1};
+
+  // The number of reports of all errors that are forwarded per window.
+  uint32_t MaxReports{20};
+
+  // The number of errors whose reports are counted at once. Reports of other
+  // errors are counted together once the limit is reached.
+  size_t MaxTrackedErrors{256};
+
+  // The number of stack frames in a fingerprint.
+  size_t FingerprintFrameCount{5};
+};
+
+// Decides which soft exception reports are forwarded to the redbox handler.
+// The first reports of an error are forwarded right away, within the limits
+// per error and for all errors. The other reports of the window are counted
+// and summarized once the window of the first one ends. Fatal errors are always
+// forwarded and are not counted. Times are passed in, so that the limiter does
+// not depend on a clock.
+class SoftExceptionLimiter {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Action {
+    // Forward the report now.
+    Forward,
+    // The report is the first one of a summary. The caller keeps its details
+    // to report them with the summary.
+    StartSummary,
+    // The report is counted in a summary.
+    Count,
+  };
+
+  // The reports of an error that were not forwarded.
+  struct Summary {
+    // Empty for the reports of errors that were not tracked.
+    std::string Fingerprint;
+    uint32_t Count{0};
+    Clock::time_point FirstReportTime;
+    Clock::time_point LastReportTime;
+  };
+
+  explicit SoftExceptionLimiter(const SoftExceptionLimits &limits = {}) noexcept;
+
+  const SoftExceptionLimits &Limits() const noexcept;
+
+  Action OnReport(const std::string &fingerprint, bool isFatal, Clock::time_point now);
+
+  // Returns the summaries whose window ended, and forgets the errors that have
+  // no report left in the window.
+  std::vector<Summary> TakeDueSummaries(Clock::time_point now);
+
+  // The time at which the next summary is due, if any report is counted.
+  bool HasPendingSummary() const noexcept;
+  Clock::time_point NextSummaryTime() const noexcept;
+
+  // Whether the reports of an error are counted in its own summary, rather
+  // than with the other untracked errors.
+  bool IsTracked(const std::string &fingerprint) const noexcept;
+
+  size_t TrackedErrorCount() const noexcept;
+
+ private:
+  struct Entry {
+    // The times of the forwarded reports that are in the window.
+    std::deque<Clock::time_point> ForwardTimes;
+    Summary PendingSummary;
+  };
+
+  Entry *FindOrAddEntry(const std::string &fingerprint, Clock::time_point now);
+  Action Suppress(Entry &entry, const std::string &fingerprint, Clock::time_point now);
+  void PruneForwardTimes(std::deque<Clock::time_point> &times, Clock::time_point now) const noexcept;
+  bool IsIdle(Entry &entry, Clock::time_point now) const noexcept;
+
+  SoftExceptionLimits m_limits;
+  std::unordered_map<std::string, Entry> m_entries;
+  // Counts the reports of errors that are not tracked.
+  Entry m_untrackedEntry;
+  std::deque<Clock::time_point> m_forwardTimes;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "TextInputReconciler.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+bool IsHighSurrogate(wchar_t ch) noexcept {
+  return ch >= 0xD800 && ch <= 0xDBFF;
+}
+
+bool IsLowSurrogate(wchar_t ch) noexcept {
+  return ch >= 0xDC00 && ch <= 0xDFFF;
+}
+
+} // namespace
+
+TextInputEdit DiffText(std::wstring_view oldText, std::wstring_view newText) noexcept {
+  const size_t maxPrefix = std::min(oldText.size(), newText.size());
+  size_t prefix = std::mismatch(oldText.begin(), oldText.begin() + maxPrefix, newText.begin()).first - oldText.begin();
+
+  // The code unit after the prefix differs, or is missing, in one of the texts.
+  // If the prefix ends with a high surrogate, its low surrogate belongs to the
+  // edit.
+  if (prefix > 0 && IsHighSurrogate(oldText[prefix - 1])) {
+    --prefix;
+  }
+
+  const size_t maxSuffix = maxPrefix - prefix;
+  size_t suffix =
+      std::mismatch(oldText.rbegin(), oldText.rbegin() + maxSuffix, newText.rbegin()).first - oldText.rbegin();
+
+  // The prefix does not end with a high surrogate, so a low surrogate starting
+  // the suffix always has its high surrogate in the edit.
+  if (suffix > 0 && IsLowSurrogate(oldText[oldText.size() - suffix])) {
+    --suffix;
+  }
+
+  return {prefix, oldText.size() - suffix, newText.substr(prefix, newText.size() - suffix - prefix)};
+}
+
+void ApplyTextInputEdit(std::wstring &text, const TextInputEdit &edit) {
+  assert(edit.start <= edit.end && edit.end <= text.size());
+  text.replace(edit.start, edit.end - edit.start, edit.text);
+}
+
+bool TextInputReconciler::HasBaseline() const noexcept {
+  return m_hasBaseline;
+}
+
+void TextInputReconciler::Reset(std::wstring_view text) {
+  m_text.assign(text);
+  m_hasBaseline = true;
+}
+
+void TextInputReconciler::Clear() noexcept {
+  m_text.clear();
+  m_hasBaseline = false;
+}
+
+TextInputEdit TextInputReconciler::TakeEdit(std::wstring_view currentText) {
+  assert(m_hasBaseline);
+  auto edit = DiffText(m_text, currentText);
+  ApplyTextInputEdit(m_text, edit);
+  return edit;
+}
+
+const std::wstring &TextInputReconciler::Text() const noexcept {
+  return m_text;
+}
+
+} // namespace react
+} // namespace facebook
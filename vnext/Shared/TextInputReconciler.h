@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace facebook {
+namespace react {
+
+// Replacement of the [start, end) range of a text by 'text'. Offsets are in
+// UTF-16 code units of the text before the edit, and never split a surrogate
+// pair.
+struct TextInputEdit {
+  size_t start = 0;
+  size_t end = 0;
+  std::wstring_view text;
+};
+
+// Returns the smallest edit that turns oldText into newText, found by skipping
+// the common prefix and suffix of both texts. The inserted text of the edit
+// points into newText.
+TextInputEdit DiffText(std::wstring_view oldText, std::wstring_view newText) noexcept;
+
+// Applies an edit returned by DiffText to a copy of the old text.
+void ApplyTextInputEdit(std::wstring &text, const TextInputEdit &edit);
+
+// Keeps the last text reported to JavaScript by a text input, so that changes
+// can be reported as edits of that text instead of the whole content.
+// Changes that happen between two reports are merged into a single edit.
+class TextInputReconciler {
+ public:
+  // False until the first call to Reset. The text must be reported in full
+  // while there is no baseline.
+  bool HasBaseline() const noexcept;
+
+  // Sets the text known to JavaScript.
+  void Reset(std::wstring_view text);
+
+  // Drops the baseline, e.g. when the native control is replaced.
+  void Clear() noexcept;
+
+  // Returns the edit from the last reported text to currentText and makes
+  // currentText the new baseline. The inserted text of the edit points into
+  // currentText. Requires a baseline.
+  TextInputEdit TakeEdit(std::wstring_view currentText);
+
+  const std::wstring &Text() const noexcept;
+
+ private:
+  std::wstring m_text;
+  bool m_hasBaseline{false};
+};
+
+} // namespace react
+} // namespace facebook
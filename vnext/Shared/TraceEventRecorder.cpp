@@ -0,0 +1,344 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "TraceEventRecorder.h"
+
+#include <cassert>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+std::atomic<uint64_t> s_nextRecorderId{1};
+
+// The state that the current thread used last, to avoid the lookup when the same recorder is used again.
+struct ThreadStateCache {
+  uint64_t RecorderId{0};
+  void *State{nullptr};
+};
+
+thread_local ThreadStateCache tlsThreadStateCache;
+
+uint32_t CurrentThreadId() noexcept {
+#ifdef _WIN32
+  return ::GetCurrentThreadId();
+#else
+  return static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
+}
+
+size_t RoundUpToPowerOfTwo(size_t value) noexcept {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+} // namespace
+
+//=============================================================================
+// TraceNameTable implementation
+//=============================================================================
+
+uint32_t TraceNameTable::Intern(std::string_view name) {
+  {
+    std::shared_lock<std::shared_mutex> lock{m_mutex};
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) {
+      return it->second;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock{m_mutex};
+  auto it = m_ids.find(name);
+  if (it != m_ids.end()) {
+    return it->second;
+  }
+
+  auto id = static_cast<uint32_t>(m_names.size());
+  const std::string &storedName = m_names.emplace_back(name);
+  m_ids.emplace(storedName, id);
+  return id;
+}
+
+const std::string &TraceNameTable::Name(uint32_t id) const noexcept {
+  std::shared_lock<std::shared_mutex> lock{m_mutex};
+  assert(id < m_names.size());
+  return m_names[id];
+}
+
+size_t TraceNameTable::Size() const noexcept {
+  std::shared_lock<std::shared_mutex> lock{m_mutex};
+  return m_names.size();
+}
+
+//=============================================================================
+// TraceEventBuffer implementation
+//=============================================================================
+
+TraceEventBuffer::TraceEventBuffer(size_t capacity, uint32_t threadId)
+    : m_slots(RoundUpToPowerOfTwo(capacity)), m_mask{m_slots.size() - 1}, m_threadId{threadId} {}
+
+bool TraceEventBuffer::TryPush(
+    TraceEventKind kind,
+    uint32_t nameId,
+    int64_t value,
+    const char *args,
+    std::chrono::steady_clock::time_point timestamp) {
+  size_t tail = m_tail.load(std::memory_order_relaxed);
+  if (tail - m_head.load(std::memory_order_acquire) == m_slots.size()) {
+    return false;
+  }
+
+  TraceEvent &slot = m_slots[tail & m_mask];
+  slot.Kind = kind;
+  slot.Timestamp = timestamp;
+  slot.NameId = nameId;
+  slot.Value = value;
+  slot.Args.assign(args ? args : "");
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+size_t TraceEventBuffer::Drain(std::vector<TraceEvent> &events, size_t count) {
+  size_t head = m_head.load(std::memory_order_relaxed);
+  size_t tail = m_tail.load(std::memory_order_acquire);
+  for (size_t i = head; i != tail; ++i, ++count) {
+    const TraceEvent &slot = m_slots[i & m_mask];
+    TraceEvent &event = count < events.size() ? events[count] : events.emplace_back();
+    event.Kind = slot.Kind;
+    event.ThreadId = m_threadId;
+    event.Timestamp = slot.Timestamp;
+    event.NameId = slot.NameId;
+    event.Value = slot.Value;
+    // Copy rather than swap, so that neither the slot nor the event loses its string buffer.
+    event.Args.assign(slot.Args);
+  }
+
+  m_head.store(tail, std::memory_order_release);
+  return count;
+}
+
+//=============================================================================
+// TraceEventRecorder implementation
+//=============================================================================
+
+TraceEventRecorder::TraceEventRecorder(size_t capacityPerThread)
+    : m_id{s_nextRecorderId++}, m_capacityPerThread{capacityPerThread} {}
+
+TraceEventRecorder::~TraceEventRecorder() noexcept {
+  StopFlushing();
+}
+
+void TraceEventRecorder::SetSampleRate(uint32_t sampleRate) noexcept {
+  m_sampleRate = sampleRate ? sampleRate : 1;
+}
+
+void TraceEventRecorder::StartFlushing(FlushCallback &&callback, std::chrono::milliseconds interval) {
+  std::lock_guard<std::mutex> lock{m_flushThreadMutex};
+  if (m_flushThread.joinable()) {
+    return;
+  }
+
+  m_stopFlushing = false;
+  m_flushThread = std::thread{[this, callback = std::move(callback), interval]() mutable noexcept {
+    FlushLoop(std::move(callback), interval);
+  }};
+}
+
+void TraceEventRecorder::StopFlushing() noexcept {
+  std::thread flushThread;
+  {
+    std::lock_guard<std::mutex> lock{m_flushThreadMutex};
+    m_stopFlushing = true;
+    flushThread = std::move(m_flushThread);
+  }
+
+  if (flushThread.joinable()) {
+    m_flushThreadWakeUp.notify_all();
+    flushThread.join();
+  }
+}
+
+void TraceEventRecorder::FlushLoop(FlushCallback callback, std::chrono::milliseconds interval) noexcept {
+  for (;;) {
+    bool isStopping = false;
+    {
+      std::unique_lock<std::mutex> lock{m_flushThreadMutex};
+      isStopping = m_flushThreadWakeUp.wait_for(lock, interval, [this]() noexcept { return m_stopFlushing; });
+    }
+
+    // The last flush delivers the events recorded before StopFlushing.
+    Flush(callback);
+    if (isStopping) {
+      return;
+    }
+  }
+}
+
+size_t TraceEventRecorder::Flush(const FlushCallback &callback) {
+  std::lock_guard<std::mutex> flushLock{m_flushMutex};
+
+  size_t count = 0;
+  {
+    // New threads may be added while we drain, but existing ones are never removed.
+    std::lock_guard<std::mutex> lock{m_threadsMutex};
+    for (auto &entry : m_threads) {
+      count = entry.second->Buffer.Drain(m_batch, count);
+    }
+  }
+
+  if (count > 0) {
+    callback(TraceEventBatch{m_batch.data(), count});
+  }
+
+  return count;
+}
+
+const std::string &TraceEventRecorder::Name(uint32_t nameId) const noexcept {
+  return m_names.Name(nameId);
+}
+
+uint64_t TraceEventRecorder::DroppedEventCount() const noexcept {
+  return m_droppedEventCount.load(std::memory_order_relaxed);
+}
+
+TraceEventRecorder::ThreadState *TraceEventRecorder::CurrentThreadState() noexcept {
+  ThreadStateCache &cache = tlsThreadStateCache;
+  if (cache.RecorderId == m_id) {
+    return static_cast<ThreadState *>(cache.State);
+  }
+
+  try {
+    std::lock_guard<std::mutex> lock{m_threadsMutex};
+    auto &state = m_threads[std::this_thread::get_id()];
+    if (!state) {
+      state = std::make_unique<ThreadState>(m_capacityPerThread, CurrentThreadId());
+    }
+
+    cache.RecorderId = m_id;
+    cache.State = state.get();
+    return state.get();
+  } catch (...) {
+    // The trace hooks must not throw. The event is lost, as when the buffer is full.
+    m_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+}
+
+uint32_t TraceEventRecorder::InternName(ThreadState &state, const char *profileName) {
+  auto address = reinterpret_cast<uintptr_t>(profileName);
+  RecentName &recent = state.RecentNames[((address >> 4) ^ address) % state.RecentNames.size()];
+
+  // Callers may reuse the same buffer for different names, so the pointer alone does not identify the name.
+  // The interned strings never change or move, and can be read without the lock.
+  if (recent.ProfileName == profileName && *recent.Name == profileName) {
+    return recent.Id;
+  }
+
+  uint32_t id = m_names.Intern(profileName);
+  recent.ProfileName = profileName;
+  recent.Name = &m_names.Name(id);
+  recent.Id = id;
+  return id;
+}
+
+void TraceEventRecorder::Record(
+    ThreadState &state,
+    TraceEventKind kind,
+    const char *profileName,
+    int64_t value,
+    const char *args) noexcept {
+  auto timestamp = std::chrono::steady_clock::now();
+  try {
+    uint32_t nameId = InternName(state, profileName ? profileName : "");
+    if (state.Buffer.TryPush(kind, nameId, value, args, timestamp)) {
+      return;
+    }
+  } catch (...) {
+    // Interning a new name or growing the Args string of the slot failed. The event is dropped.
+  }
+
+  m_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TraceEventRecorder::SectionSampler::Begin(uint32_t sampleRate) noexcept {
+  if (Depth++ == 0) {
+    IsSampled = Sequence++ % sampleRate == 0;
+  }
+
+  return IsSampled;
+}
+
+bool TraceEventRecorder::SectionSampler::End(uint32_t sampleRate) noexcept {
+  if (Depth == 0) {
+    // The section began before the recording started.
+    return sampleRate == 1;
+  }
+
+  --Depth;
+  return IsSampled;
+}
+
+void TraceEventRecorder::JSBeginSection(const char *profileName, const char *args) noexcept {
+  ThreadState *state = CurrentThreadState();
+  if (state && state->JSSections.Begin(m_sampleRate.load(std::memory_order_relaxed))) {
+    Record(*state, TraceEventKind::JSBeginSection, profileName, 0, args);
+  }
+}
+
+void TraceEventRecorder::JSEndSection() noexcept {
+  ThreadState *state = CurrentThreadState();
+  if (state && state->JSSections.End(m_sampleRate.load(std::memory_order_relaxed))) {
+    Record(*state, TraceEventKind::JSEndSection, nullptr, 0, nullptr);
+  }
+}
+
+void TraceEventRecorder::JSBeginAsyncSection(const char *profileName, int cookie) noexcept {
+  if (static_cast<uint32_t>(cookie) % m_sampleRate.load(std::memory_order_relaxed) == 0) {
+    if (ThreadState *state = CurrentThreadState()) {
+      Record(*state, TraceEventKind::JSBeginAsyncSection, profileName, cookie, nullptr);
+    }
+  }
+}
+
+void TraceEventRecorder::JSEndAsyncSection(const char *profileName, int cookie) noexcept {
+  if (static_cast<uint32_t>(cookie) % m_sampleRate.load(std::memory_order_relaxed) == 0) {
+    if (ThreadState *state = CurrentThreadState()) {
+      Record(*state, TraceEventKind::JSEndAsyncSection, profileName, cookie, nullptr);
+    }
+  }
+}
+
+void TraceEventRecorder::JSCounter(const char *profileName, int value) noexcept {
+  ThreadState *state = CurrentThreadState();
+  if (state && state->CounterSequence++ % m_sampleRate.load(std::memory_order_relaxed) == 0) {
+    Record(*state, TraceEventKind::JSCounter, profileName, value, nullptr);
+  }
+}
+
+void TraceEventRecorder::NativeBeginSection(const char *profileName, const char *args) noexcept {
+  ThreadState *state = CurrentThreadState();
+  if (state && state->NativeSections.Begin(m_sampleRate.load(std::memory_order_relaxed))) {
+    Record(*state, TraceEventKind::NativeBeginSection, profileName, 0, args);
+  }
+}
+
+void TraceEventRecorder::NativeEndSection(
+    const char *profileName,
+    const char *args,
+    std::chrono::nanoseconds duration) noexcept {
+  ThreadState *state = CurrentThreadState();
+  if (state && state->NativeSections.End(m_sampleRate.load(std::memory_order_relaxed))) {
+    Record(*state, TraceEventKind::NativeEndSection, profileName, duration.count(), args);
+  }
+}
+
+} // namespace react
+} // namespace facebook
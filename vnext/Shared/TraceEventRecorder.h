@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "Tracing.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+enum class TraceEventKind : uint8_t {
+  JSBeginSection,
+  JSEndSection,
+  JSBeginAsyncSection,
+  JSEndAsyncSection,
+  JSCounter,
+  NativeBeginSection,
+  NativeEndSection,
+};
+
+struct TraceEvent {
+  TraceEventKind Kind{TraceEventKind::JSBeginSection};
+
+  // The OS id of the thread that recorded the event.
+  uint32_t ThreadId{0};
+
+  // When the event was recorded. The events are delivered later, so handlers must not use the time of delivery.
+  std::chrono::steady_clock::time_point Timestamp;
+
+  // The interned profile name. TraceEventRecorder::Name returns the string for it.
+  uint32_t NameId{0};
+
+  // The async section cookie, the counter value, or the native section duration in nanoseconds.
+  int64_t Value{0};
+
+  std::string Args;
+};
+
+// Maps trace profile names to small integer IDs.
+// IDs are assigned in the order names are first seen, starting from 0, and never change.
+class TraceNameTable {
+ public:
+  uint32_t Intern(std::string_view name);
+  const std::string &Name(uint32_t id) const noexcept;
+  size_t Size() const noexcept;
+
+ private:
+  mutable std::shared_mutex m_mutex;
+  // Keys point to the strings in m_names, which do not move when the deque grows.
+  std::unordered_map<std::string_view, uint32_t> m_ids;
+  std::deque<std::string> m_names;
+};
+
+// The events delivered by one flush. They are valid only during the flush callback.
+class TraceEventBatch {
+ public:
+  TraceEventBatch(const TraceEvent *events, size_t size) noexcept : m_events{events}, m_size{size} {}
+
+  const TraceEvent *begin() const noexcept {
+    return m_events;
+  }
+
+  const TraceEvent *end() const noexcept {
+    return m_events + m_size;
+  }
+
+  size_t size() const noexcept {
+    return m_size;
+  }
+
+  const TraceEvent &operator[](size_t index) const noexcept {
+    return m_events[index];
+  }
+
+ private:
+  const TraceEvent *m_events;
+  size_t m_size;
+};
+
+// Single producer, single consumer ring of trace events.
+// The slots are reused, so recording an event does not allocate once the Args strings have grown.
+class TraceEventBuffer {
+ public:
+  // The capacity is rounded up to a power of two. threadId is the ThreadId of the events.
+  explicit TraceEventBuffer(size_t capacity, uint32_t threadId = 0);
+
+  // Called only by the producer thread. Returns false if the buffer is full.
+  bool TryPush(
+      TraceEventKind kind,
+      uint32_t nameId,
+      int64_t value,
+      const char *args,
+      std::chrono::steady_clock::time_point timestamp);
+
+  // Called only by the consumer. Copies the events into events starting at index count, and returns the new count.
+  // The events already in the vector are overwritten, so their Args strings are reused, and the slots keep theirs.
+  size_t Drain(std::vector<TraceEvent> &events, size_t count);
+
+ private:
+  std::vector<TraceEvent> m_slots;
+  const size_t m_mask;
+  const uint32_t m_threadId;
+  alignas(64) std::atomic<size_t> m_head{0}; // Next slot to read.
+  alignas(64) std::atomic<size_t> m_tail{0}; // Next slot to write.
+};
+
+// INativeTraceHandler that records the events into per-thread buffers instead of handling them on the caller's thread.
+// The events are delivered in batches by Flush, or by the background thread started with StartFlushing.
+// The order of the events is kept for each recording thread, but not across threads.
+class TraceEventRecorder final : public INativeTraceHandler {
+ public:
+  using FlushCallback = std::function<void(const TraceEventBatch &events)>;
+
+  explicit TraceEventRecorder(size_t capacityPerThread = 8192);
+  ~TraceEventRecorder() noexcept;
+
+  // Records one out of every sampleRate top-level sections together with the sections nested in them,
+  // one out of every sampleRate counter values, and the async sections with cookies divisible by sampleRate.
+  // A sample rate of 1 records everything.
+  void SetSampleRate(uint32_t sampleRate) noexcept;
+
+  // Starts a background thread that flushes the recorded events every interval.
+  // Does nothing if the thread is already running.
+  void StartFlushing(FlushCallback &&callback, std::chrono::milliseconds interval);
+
+  // Flushes the events recorded so far and stops the background thread.
+  // The callback is not called after StopFlushing returns.
+  void StopFlushing() noexcept;
+
+  // Delivers the recorded events to callback in one batch on the calling thread.
+  // Returns the number of delivered events.
+  size_t Flush(const FlushCallback &callback);
+
+  const std::string &Name(uint32_t nameId) const noexcept;
+
+  // The number of events that were not recorded because the buffer of their thread was full.
+  uint64_t DroppedEventCount() const noexcept;
+
+ public: // INativeTraceHandler
+  void JSBeginSection(const char *profileName, const char *args) noexcept override;
+  void JSEndSection() noexcept override;
+  void JSBeginAsyncSection(const char *profileName, int cookie) noexcept override;
+  void JSEndAsyncSection(const char *profileName, int cookie) noexcept override;
+  void JSCounter(const char *profileName, int value) noexcept override;
+  void NativeBeginSection(const char *profileName, const char *args) noexcept override;
+  void NativeEndSection(const char *profileName, const char *args, std::chrono::nanoseconds duration) noexcept override;
+
+ private:
+  // Decides which nested sections are sampled. Used only by the recording thread.
+  struct SectionSampler {
+    bool Begin(uint32_t sampleRate) noexcept;
+    bool End(uint32_t sampleRate) noexcept;
+
+    uint32_t Depth{0};
+    uint64_t Sequence{0};
+    bool IsSampled{true};
+  };
+
+  // A recently interned profile name. Name points to the string in m_names.
+  struct RecentName {
+    const char *ProfileName{nullptr};
+    const std::string *Name{nullptr};
+    uint32_t Id{0};
+  };
+
+  struct ThreadState {
+    ThreadState(size_t capacity, uint32_t threadId) : Buffer{capacity, threadId} {}
+
+    TraceEventBuffer Buffer;
+    SectionSampler JSSections;
+    SectionSampler NativeSections;
+    uint64_t CounterSequence{0};
+    // Indexed by the profile name pointer, so that names seen before are found without locking m_names.
+    std::array<RecentName, 64> RecentNames;
+  };
+
+  // Returns nullptr and counts the event as dropped if the state cannot be allocated.
+  ThreadState *CurrentThreadState() noexcept;
+  uint32_t InternName(ThreadState &state, const char *profileName);
+  void Record(
+      ThreadState &state,
+      TraceEventKind kind,
+      const char *profileName,
+      int64_t value,
+      const char *args) noexcept;
+  void FlushLoop(FlushCallback callback, std::chrono::milliseconds interval) noexcept;
+
+ private:
+  const uint64_t m_id;
+  const size_t m_capacityPerThread;
+  std::atomic<uint32_t> m_sampleRate{1};
+  std::atomic<uint64_t> m_droppedEventCount{0};
+  TraceNameTable m_names;
+
+  std::mutex m_threadsMutex;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadState>> m_threads;
+
+  // Only one thread at a time drains the buffers.
+  std::mutex m_flushMutex;
+  // Never shrinks, so that the strings of the events are reused by the next flushes.
+  std::vector<TraceEvent> m_batch;
+
+  std::mutex m_flushThreadMutex;
+  std::condition_variable m_flushThreadWakeUp;
+  bool m_stopFlushing{false};
+  std::thread m_flushThread;
+};
+
+} // namespace react
+} // namespace facebook
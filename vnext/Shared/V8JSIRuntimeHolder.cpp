@@ -4,9 +4,11 @@
 #include "pch.h"
 
 #include <V8JsiRuntime.h>
+#include "DelayedTaskScheduler.h"
 #include "V8JSIRuntimeHolder.h"
 
 #include <atomic>
+#include <chrono>
 #include <queue>
 
 using namespace facebook;
@@ -15,118 +17,120 @@ using namespace facebook::react;
 namespace facebook {
 namespace react {
 
-class ReactQueueBackedTaskRunner {
+// Runs V8 foreground tasks on the JS queue. Delayed tasks are kept by a timer
+// thread until their deadline, and idle tasks run in short slices when the JS
+// queue has no other work from V8 pending.
+class ReactQueueBackedTaskRunner : public std::enable_shared_from_this<ReactQueueBackedTaskRunner> {
  public:
   ReactQueueBackedTaskRunner(std::shared_ptr<facebook::react::MessageQueueThread> jsQueue)
-      : jsQueue_(std::move(jsQueue)) {
-    // This thread handles the delayed tasks
-    std::thread(&ReactQueueBackedTaskRunner::TimerFunc, this).detach();
-  }
-
-  ~ReactQueueBackedTaskRunner() {
-    stop_requested_ = true;
-
-    delayed_tasks_available_cond_.notify_all();
-
-    // Wait until the thread is done
-    std::unique_lock<std::mutex> worker_stopped_lock(delayed_queue_access_mutex_);
-    delayed_tasks_available_cond_.wait(worker_stopped_lock, [this]() { return timer_stopped_; });
-  }
+      : jsQueue_(std::move(jsQueue)),
+        delayedTaskScheduler_([this](std::function<void()> &&task) { PostToQueue(std::move(task)); }) {}
 
   void PostTask(std::unique_ptr<v8runtime::JSITask> task) {
     std::shared_ptr<v8runtime::JSITask> shared_task(task.release());
-    jsQueue_->runOnQueue([shared_task2 = std::move(shared_task)]() { shared_task2->run(); });
+    PostToQueue([shared_task2 = std::move(shared_task)]() { shared_task2->run(); });
   }
 
   void PostDelayedTask(std::unique_ptr<v8runtime::JSITask> task, double delay_in_seconds) {
-    if (delay_in_seconds == 0) {
+    if (delay_in_seconds <= 0) {
       PostTask(std::move(task));
       return;
-    } else
-      return;
-
-    double deadline = std::chrono::steady_clock::now().time_since_epoch().count() +
-        delay_in_seconds * std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::seconds(1)).count();
+    }
 
-    std::lock_guard<std::mutex> lock(delayed_queue_access_mutex_);
-    delayed_task_queue_.push(std::make_pair(deadline, std::move(task)));
-    delayed_tasks_available_cond_.notify_all();
+    std::shared_ptr<v8runtime::JSITask> shared_task(task.release());
+    delayedTaskScheduler_.PostDelayedTask(
+        [shared_task2 = std::move(shared_task)]() { shared_task2->run(); },
+        std::chrono::duration<double>(delay_in_seconds));
   }
 
   void PostIdleTask(std::unique_ptr<v8runtime::JSIIdleTask> task) {
-    std::abort(); // Not supported as of now.
+    {
+      std::lock_guard<std::mutex> lock(idle_queue_access_mutex_);
+      idle_task_queue_.push(std::move(task));
+    }
+
+    ScheduleIdleSlice();
   }
 
   bool IdleTasksEnabled() {
-    return false;
+    return true;
   };
 
  private:
-  void TimerFunc() {
-    while (true) {
-      std::unique_lock<std::mutex> delayed_lock(delayed_queue_access_mutex_);
-      delayed_tasks_available_cond_.wait(
-          delayed_lock, [this]() { return !delayed_task_queue_.empty() || stop_requested_; });
-
-      if (stop_requested_)
-        break;
-
-      if (delayed_task_queue_.empty())
-        continue; // Loop back and block the thread.
-
-      std::queue<std::unique_ptr<v8runtime::JSITask>> new_ready_tasks;
-
-      do {
-        const DelayedEntry &delayed_entry = delayed_task_queue_.top();
-        if (delayed_entry.first < std::chrono::steady_clock::now().time_since_epoch().count()) {
-          new_ready_tasks.push(std::move(const_cast<DelayedEntry &>(delayed_entry).second));
-          delayed_task_queue_.pop();
-        } else {
-          // The rest are not ready ..
-          break;
-        }
+  void PostToQueue(std::function<void()> &&task) {
+    ++pending_task_count_;
+    jsQueue_->runOnQueue([weak_this = weak_from_this(), task2 = std::move(task)]() {
+      task2();
+      if (auto strong_this = weak_this.lock()) {
+        --strong_this->pending_task_count_;
+      }
+    });
+  }
 
-      } while (!delayed_task_queue_.empty());
+  void ScheduleIdleSlice() {
+    if (idle_slice_scheduled_.exchange(true)) {
+      return;
+    }
 
-      delayed_lock.unlock();
+    jsQueue_->runOnQueue([weak_this = weak_from_this()]() {
+      if (auto strong_this = weak_this.lock()) {
+        strong_this->RunIdleSlice();
+      }
+    });
+  }
+
+  // The JS queue runs its tasks in order, so by the time this runs everything
+  // that was queued before it has completed. If V8 posted more work since then,
+  // we let it run first and try again after it. The queue cannot tell whether
+  // bridge calls were posted in the meantime, so slices are kept short and the
+  // next one is queued behind them.
+  void RunIdleSlice() {
+    idle_slice_scheduled_ = false;
+    if (pending_task_count_ > 0) {
+      ScheduleIdleSlice();
+      return;
+    }
 
-      if (!new_ready_tasks.empty()) {
-        do {
-          PostTask(std::move(new_ready_tasks.front()));
-        } while (!new_ready_tasks.empty());
+    const auto deadline = std::chrono::steady_clock::now() + s_idleSliceDuration;
+    const double deadline_in_seconds = std::chrono::duration<double>(deadline.time_since_epoch()).count();
+
+    while (std::chrono::steady_clock::now() < deadline && pending_task_count_ == 0) {
+      std::unique_ptr<v8runtime::JSIIdleTask> task;
+      {
+        std::lock_guard<std::mutex> lock(idle_queue_access_mutex_);
+        if (idle_task_queue_.empty()) {
+          return;
+        }
+
+        task = std::move(idle_task_queue_.front());
+        idle_task_queue_.pop();
       }
 
-      if (!delayed_task_queue_.empty()) {
-        std::this_thread::sleep_for(std::chrono::seconds(1)); // Wait for a second and loop back and recompute again.
-      } // else loop back and block the thread.
+      task->run(deadline_in_seconds);
     }
 
-    timer_stopped_ = true;
-    delayed_tasks_available_cond_.notify_all();
+    std::lock_guard<std::mutex> lock(idle_queue_access_mutex_);
+    if (!idle_task_queue_.empty()) {
+      ScheduleIdleSlice();
+    }
   }
 
  private:
-  using DelayedEntry = std::pair<double, std::unique_ptr<v8runtime::JSITask>>;
-
-  // Define a comparison operator for the delayed_task_queue_ to make sure
-  // that the unique_ptr in the DelayedEntry is not accessed in the priority
-  // queue. This is necessary because we have to reset the unique_ptr when we
-  // remove a DelayedEntry from the priority queue.
-  struct DelayedEntryCompare {
-    bool operator()(DelayedEntry &left, DelayedEntry &right) {
-      return left.first > right.first;
-    }
-  };
+  // The longest time idle tasks may run before yielding back to the JS queue.
+  // It bounds the delay of the bridge calls that wait behind a slice.
+  static constexpr std::chrono::milliseconds s_idleSliceDuration{4};
 
   std::shared_ptr<facebook::react::MessageQueueThread> jsQueue_;
 
-  std::priority_queue<DelayedEntry, std::vector<DelayedEntry>, DelayedEntryCompare> delayed_task_queue_;
+  std::atomic<int32_t> pending_task_count_{0};
+  std::atomic<bool> idle_slice_scheduled_{false};
 
-  std::mutex delayed_queue_access_mutex_;
-  std::condition_variable delayed_tasks_available_cond_;
+  std::mutex idle_queue_access_mutex_;
+  std::queue<std::unique_ptr<v8runtime::JSIIdleTask>> idle_task_queue_;
 
-  std::atomic<bool> stop_requested_{false};
-  bool timer_stopped_{false};
+  // It must be the last field: destroying it joins the timer thread before the
+  // rest of the runner goes away.
+  DelayedTaskScheduler<> delayedTaskScheduler_;
 };
 
 class TaskRunnerAdapter : public v8runtime::JSITaskRunner {
@@ -142,11 +146,11 @@ class TaskRunnerAdapter : public v8runtime::JSITaskRunner {
   }
 
   void postIdleTask(std::unique_ptr<v8runtime::JSIIdleTask> task) override {
-    std::abort();
+    taskRunner_->PostIdleTask(std::move(task));
   }
 
   bool IdleTasksEnabled() override {
-    return false;
+    return taskRunner_->IdleTasksEnabled();
   }
 
  private:
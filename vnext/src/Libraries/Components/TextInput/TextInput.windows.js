@@ -67,6 +67,14 @@ export type ChangeEvent = SyntheticEvent<
     eventCount: number,
     target: number,
     text: string,
+    // [Windows
+    // Set when `textChangeDeltas` is enabled and `text` only holds the text
+    // that replaced this range of the previous text.
+    range?: $ReadOnly<{|
+      start: number,
+      end: number,
+    |}>,
+    // Windows]
   |}>,
 >;
 
@@ -697,6 +705,18 @@ export type Props = $ReadOnly<{|
    */
   contextMenuHidden?: ?boolean,
 
+  // [Windows
+  /**
+   * If `true`, change events only carry the edited range and the inserted
+   * text instead of the whole text, which keeps typing fast in large
+   * documents. `onChangeText` still receives the whole text, and `onChange`
+   * receives the edit in `nativeEvent.range` and `nativeEvent.text`.
+   * The default value is `false`.
+   * @platform windows
+   */
+  textChangeDeltas?: ?boolean,
+  // Windows]
+
   forwardedRef?: ?ReactRefSetter<
     React.ElementRef<HostComponent<mixed>> & ImperativeMethods,
   >,
@@ -843,6 +863,10 @@ function InternalTextInput(props: Props): React.Node {
   const [mostRecentEventCount, setMostRecentEventCount] = useState<number>(0);
 
   const [lastNativeText, setLastNativeText] = useState<?Stringish>(props.value);
+  // [Windows
+  // Whole text of the last change event, which the next edit applies to.
+  const nativeTextRef = useRef<string>('');
+  // Windows]
   const [lastNativeSelectionState, setLastNativeSelection] = useState<{|
     selection: ?Selection,
     mostRecentEventCount: number,
@@ -1007,7 +1031,18 @@ function InternalTextInput(props: Props): React.Node {
       });
     }
 
-    const text = event.nativeEvent.text;
+    // [Windows
+    let text = event.nativeEvent.text;
+    const range = event.nativeEvent.range;
+    if (range != null) {
+      const previousText = nativeTextRef.current;
+      text =
+        previousText.slice(0, range.start) +
+        text +
+        previousText.slice(range.end);
+    }
+    nativeTextRef.current = text;
+    // Windows]
     props.onChange && props.onChange(event);
     props.onChangeText && props.onChangeText(text);
 